@@ -0,0 +1,107 @@
+#!/bin/python
+
+# Running run_star_maker_ordering_test.py does the following:
+
+# - Runs Enzo-E twice for the star maker selected by --flavor, once
+#   checking the expensive star formation criteria only on candidate
+#   cells (Method:star_maker:select_candidates = true), and once
+#   checking all criteria on every active cell (select_candidates =
+#   false).  Both runs use the same Method:random_seed.
+# - Reads the star particles of the final snapshot of each run, and
+#   tests that the same stars formed: the same number of particles with
+#   the same positions, masses and creation times.  The test fails if
+#   no stars formed, since it would then test nothing.
+# - Deletes the snapshot directories.
+
+# Arguments:
+# --launch_cmd: the command used to run Enzo-E.
+#               To run Enzo-E as a serial program, set this to `/path/to/bin/enzo-e`.
+#               To run Enzo-E as a parallel program, set this to (for example)
+#               `"/path/to/bin/charmrun +p4 ++local /path/to/bin/enzo-e"`
+#
+# --flavor: Can be set to `stochastic` or `STARSS`, the star maker to test.
+
+import argparse
+import os
+import sys
+import shutil
+import subprocess
+import glob
+
+import numpy as np
+import yt
+
+from testing_utils import testing_context
+
+yt.mylog.setLevel(30) # set yt log level to "WARNING"
+
+def run_test(executable, prefix):
+
+    param_file = f"input/StarMaker/{prefix}.in"
+    command = executable + ' ' + param_file
+    subprocess.call(command,shell = True)
+
+def read_stars(prefix):
+    """
+    Return an array with one row (x, y, z, mass, creation_time) per
+    star particle in the last snapshot, sorted by rows
+    """
+
+    ds_list = sorted(glob.glob(f"{prefix}_????/{prefix}_????.block_list"))
+    if len(ds_list) == 0:
+        print(f"FAILED: no snapshot found for {prefix}")
+        return None
+
+    data = yt.load(ds_list[-1]).all_data()
+    stars = np.column_stack([data["star",name].v for name in
+                             ["x", "y", "z", "mass", "creation_time"]])
+    return stars[np.lexsort(stars.T[::-1])]
+
+def analyze_test(flavor):
+
+    select = read_stars(f"{flavor}_select")
+    scan   = read_stars(f"{flavor}_scan")
+    if select is None or scan is None:
+        return False
+
+    print(f"{flavor}: {len(select)} stars with candidate selection, "
+          f"{len(scan)} stars without")
+
+    if len(select) == 0:
+        print("FAILED: no stars formed")
+        return False
+    if select.shape != scan.shape or not np.array_equal(select, scan):
+        print("FAILED: candidate selection changed the stars formed")
+        return False
+    return True
+
+def cleanup(flavor):
+    dir_list = glob.glob(f"{flavor}_select_????") + glob.glob(f"{flavor}_scan_????")
+    for dir_name in dir_list:
+        if os.path.isdir(dir_name):
+            shutil.rmtree(dir_name)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--launch_cmd', required=True,type=str)
+    parser.add_argument('--flavor', choices=['stochastic', 'STARSS'], required=True, type=str)
+    args = parser.parse_args()
+
+    flavor = args.flavor.lower()
+
+    with testing_context():
+
+        # run the test with and without candidate selection
+        run_test(args.launch_cmd, f"{flavor}_select")
+        run_test(args.launch_cmd, f"{flavor}_scan")
+
+        # analyze the test
+        tests_passed = analyze_test(flavor)
+
+        # cleanup
+        cleanup(flavor)
+
+    if tests_passed:
+        sys.exit(0)
+    else:
+        sys.exit(3)
@@ -86,6 +86,7 @@ class FieldFace;
 #include "data_Scalar.hpp"
 
 #include "data_FieldDescr.hpp"
+#include "data_DerivedFieldCache.hpp"
 #include "data_FieldData.hpp"
 #include "data_Field.hpp"
 #include "data_FieldFace.hpp"
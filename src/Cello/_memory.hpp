@@ -15,13 +15,22 @@
 #include <stdio.h>
 
 #include <stack>
+#include <map>
+#include <string>
 #include <memory>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <typeinfo>
 
 //----------------------------------------------------------------------
 // Component class includes
 //----------------------------------------------------------------------
 
 #include "memory_Memory.hpp"
+#include "memory_MemoryAccount.hpp"
+#include "memory_Scratch.hpp"
+#include "memory_SharedTable.hpp"
 
 #endif /* _MEMORY_HPP */
 
@@ -95,6 +95,7 @@ enum adapt_type {
 #include <sstream>
 #include <vector>
 #include <memory>
+#include <map>
 
 //----------------------------------------------------------------------
 // Component class includes
@@ -12,8 +12,10 @@
 // System includes
 //----------------------------------------------------------------------
 
+#include <chrono>
 #include <vector>
 #include <map>
+#include <set>
 #include <stack>
 #include <string>
 #include <sstream>
@@ -34,7 +36,9 @@
 #ifdef CONFIG_USE_PAPI  
 #include "performance_Papi.hpp"
 #endif
+#include "performance_Histogram.hpp"
 #include "performance_Performance.hpp"
+#include "performance_Tracer.hpp"
 
 
 #endif /* _PERFORMANCE_HPP */
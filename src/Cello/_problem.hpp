@@ -55,6 +55,7 @@ extern void method_close_files_mutex_init();
 #include "problem_Value.hpp"
 //#include "problem_MaskPng.hpp"
 //#include "problem_ExprValue.hpp"
+#include "problem_MethodGraph.hpp"
 #include "problem_Problem.hpp"
 #include "problem_Stopping.hpp"
 #include "problem_Initial.hpp"
@@ -69,6 +70,8 @@ extern void method_close_files_mutex_init();
 #include "problem_MethodFluxCorrect.hpp"
 #include "problem_MethodNull.hpp"
 #include "problem_MethodOrderMorton.hpp"
+#include "problem_MortonHistogram.hpp"
+#include "problem_MethodOrderSfc.hpp"
 #include "problem_MethodOutput.hpp"
 #include "problem_MethodRefresh.hpp"
 #include "problem_MethodTrace.hpp"
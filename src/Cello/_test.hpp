@@ -20,6 +20,7 @@
 
 #include "performance_Timer.hpp"
 #include "test_Unit.hpp"
+#include "benchmark_Benchmark.hpp"
 
 #endif /* _TEST_HPP */
 
@@ -0,0 +1,65 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     benchmark_Benchmark.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Implementation of the Benchmark class
+
+#include "test.hpp"
+
+//----------------------------------------------------------------------
+
+void Benchmark::add (std::string name, double seconds,
+                     double cells, double bytes) throw()
+{
+  Result result = { name, seconds, cells, bytes };
+  results_.push_back(result);
+
+  const double ns_per_cell = (cells > 0) ? 1e9*seconds/cells : 0.0;
+  const double gb_per_s    = (seconds > 0) ? 1e-9*bytes/seconds : 0.0;
+
+  PARALLEL_PRINTF ("BENCHMARK %s %-32s %10.3f ns/cell %8.3f GB/s\n",
+                   suite_.c_str(), name.c_str(), ns_per_cell, gb_per_s);
+  fflush(stdout);
+}
+
+//----------------------------------------------------------------------
+
+bool Benchmark::write (std::string file_name) const throw()
+{
+  FILE * fp = fopen (file_name.c_str(),"w");
+  if (fp == NULL) {
+    WARNING1 ("Benchmark::write()",
+              "Cannot open benchmark file %s", file_name.c_str());
+    return false;
+  }
+
+  fprintf (fp,"{\n  \"suite\": \"%s\",\n",suite_.c_str());
+  const char * precision =
+    (sizeof(cello_float) == sizeof(float))  ? "single" :
+    (sizeof(cello_float) == sizeof(double)) ? "double" : "quadruple";
+  fprintf (fp,"  \"precision\": \"%s\",\n",precision);
+
+  fprintf (fp,"  \"parameters\": {");
+  for (size_t i=0; i<parameter_name_.size(); i++) {
+    fprintf (fp,"%s\n    \"%s\": %g", (i==0) ? "" : ",",
+             parameter_name_[i].c_str(), parameter_value_[i]);
+  }
+  fprintf (fp,"\n  },\n");
+
+  fprintf (fp,"  \"results\": [");
+  for (size_t i=0; i<results_.size(); i++) {
+    const Result & r = results_[i];
+    const double ns_per_cell = (r.cells > 0) ? 1e9*r.seconds/r.cells : 0.0;
+    const double gb_per_s    = (r.seconds > 0) ? 1e-9*r.bytes/r.seconds : 0.0;
+    fprintf (fp,"%s\n    { \"name\": \"%s\", \"seconds\": %.6e,"
+             " \"cells\": %.0f, \"bytes\": %.0f,"
+             " \"ns_per_cell\": %.6g, \"gb_per_s\": %.6g }",
+             (i==0) ? "" : ",", r.name.c_str(), r.seconds,
+             r.cells, r.bytes, ns_per_cell, gb_per_s);
+  }
+  fprintf (fp,"\n  ]\n}\n");
+
+  fclose (fp);
+  return true;
+}
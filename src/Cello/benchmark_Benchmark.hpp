@@ -0,0 +1,77 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     benchmark_Benchmark.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Test] Declaration of the Benchmark class
+
+#ifndef BENCHMARK_BENCHMARK_HPP
+#define BENCHMARK_BENCHMARK_HPP
+
+class Benchmark {
+
+  /// @class    Benchmark
+  /// @ingroup  Test
+  /// @brief    [\ref Test] Collect, print, and write kernel timings
+  ///
+  /// Used by the benchmark_* programs to report the time per cell and
+  /// memory bandwidth of kernels applied to synthetic blocks, and to
+  /// write them as JSON so that results can be compared between
+  /// versions.  Bandwidth is computed from the number of bytes a
+  /// kernel must read and write, not from hardware counters.
+
+public: // interface
+
+  /// Create a Benchmark for the named suite of kernels
+  Benchmark(std::string suite) throw()
+    : suite_(suite),
+      parameter_name_(),
+      parameter_value_(),
+      results_()
+  { }
+
+  /// Record a parameter of the suite, e.g. the block size
+  void set_parameter (std::string name, double value) throw()
+  {
+    parameter_name_.push_back(name);
+    parameter_value_.push_back(value);
+  }
+
+  /// Record and print the total time in seconds for a kernel applied
+  /// to the given total number of cells, reading and writing the
+  /// given total number of bytes
+  void add (std::string name, double seconds,
+            double cells, double bytes) throw();
+
+  /// Return the number of results recorded
+  int num_results () const throw()
+  { return results_.size(); }
+
+  /// Write the parameters and results to the given file in JSON
+  /// format.  Return false if the file cannot be written
+  bool write (std::string file_name) const throw();
+
+private: // classes
+
+  struct Result {
+    std::string name;
+    double seconds;
+    double cells;
+    double bytes;
+  };
+
+private: // attributes
+
+  /// Name of the benchmark suite
+  std::string suite_;
+
+  /// Names and values of suite parameters
+  std::vector<std::string> parameter_name_;
+  std::vector<double> parameter_value_;
+
+  /// Kernel results in the order added
+  std::vector<Result> results_;
+
+};
+
+#endif /* BENCHMARK_BENCHMARK_HPP */
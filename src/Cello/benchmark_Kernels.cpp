@@ -0,0 +1,323 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     benchmark_Kernels.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Benchmark of Cello data kernels on synthetic blocks
+///
+/// Usage: benchmark_kernels [ block-size [ iterations [ json-file ] ] ]
+///
+/// Times FieldFace packing and unpacking of ghost zones, CelloArray
+/// subarray access, Param floating-point expression evaluation, and
+/// ParticleData insert / scatter / delete on synthetic blocks without
+/// running a Simulation, and reports ns/cell (or ns/particle) and GB/s,
+/// optionally writing them to a JSON file.
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "data.hpp"
+#include "parameters.hpp"
+
+//----------------------------------------------------------------------
+
+void benchmark_field_face_ (Benchmark & benchmark, int nb, int ni)
+{
+  // hydro-like set of double-precision fields with 3 ghost zones
+
+  const int nf = 8;
+  const int ng = 3;
+
+  FieldDescr * field_descr = new FieldDescr;
+  std::vector<int> field_list;
+  for (int i_f=0; i_f<nf; i_f++) {
+    char name[20];
+    snprintf (name,sizeof(name),"field_%d",i_f);
+    const int id = field_descr->insert_permanent(name);
+    field_descr->set_precision(id,precision_double);
+    field_descr->set_ghost_depth(id,ng,ng,ng);
+    field_list.push_back(id);
+  }
+
+  FieldData * field_data_src = new FieldData (field_descr,nb,nb,nb);
+  FieldData * field_data_dst = new FieldData (field_descr,nb,nb,nb);
+  field_data_src->allocate_permanent(field_descr,true);
+  field_data_dst->allocate_permanent(field_descr,true);
+
+  Field field_src (field_descr,field_data_src);
+  Field field_dst (field_descr,field_data_dst);
+
+  const int m = (nb+2*ng)*(nb+2*ng)*(nb+2*ng);
+  for (int i_f=0; i_f<nf; i_f++) {
+    double * values = (double *) field_src.values(i_f);
+    for (int i=0; i<m; i++) values[i] = sin(0.37*i) + i_f;
+  }
+
+  Refresh refresh;
+  refresh.set_field_list(field_list);
+
+  Timer timer_pack;
+  Timer timer_unpack;
+  double bytes = 0.0;
+  double cells = 0.0;
+
+  std::vector<char> array;
+
+  for (int iter=0; iter<ni; iter++) {
+    for (int axis=0; axis<3; axis++) {
+      for (int face=-1; face<=1; face+=2) {
+
+        FieldFace field_face (3);
+        field_face.set_refresh_type(refresh_same);
+        field_face.set_ghost(1,1,1);
+        field_face.set_face(axis==0 ? face : 0,
+                            axis==1 ? face : 0,
+                            axis==2 ? face : 0);
+        field_face.set_refresh(&refresh,false);
+
+        const int n = field_face.num_bytes_array(field_src);
+        array.resize(n);
+
+        timer_pack.start();
+        field_face.face_to_array (field_src,array.data());
+        timer_pack.stop();
+
+        field_face.set_face(axis==0 ? -face : 0,
+                            axis==1 ? -face : 0,
+                            axis==2 ? -face : 0);
+
+        timer_unpack.start();
+        field_face.array_to_face (array.data(),field_dst);
+        timer_unpack.stop();
+
+        bytes += 2.0*n;
+        cells += n / (nf*sizeof(double));
+      }
+    }
+  }
+
+  benchmark.add ("field_face:pack",  timer_pack.value(),  cells, bytes);
+  benchmark.add ("field_face:unpack",timer_unpack.value(),cells, bytes);
+
+  delete field_data_dst;
+  delete field_data_src;
+  delete field_descr;
+}
+
+//----------------------------------------------------------------------
+
+void benchmark_cello_array_ (Benchmark & benchmark, int nb, int ni)
+{
+  const int ng = 3;
+  const int m = nb + 2*ng;
+
+  CelloArray<double,3> array (m,m,m);
+  CelloArray<double,3> result (m,m,m);
+  for (int iz=0; iz<m; iz++) {
+    for (int iy=0; iy<m; iy++) {
+      for (int ix=0; ix<m; ix++) {
+        array(iz,iy,ix) = ix + m*(iy + m*iz);
+      }
+    }
+  }
+
+  Timer timer_subarray;
+  Timer timer_pointer;
+
+  for (int iter=0; iter<ni; iter++) {
+
+    // interior access through subarrays
+
+    timer_subarray.start();
+    CelloArray<double,3> a = array.subarray
+      (CSlice(ng,-ng),CSlice(ng,-ng),CSlice(ng,-ng));
+    CelloArray<double,3> r = result.subarray
+      (CSlice(ng,-ng),CSlice(ng,-ng),CSlice(ng,-ng));
+    for (int iz=0; iz<nb; iz++) {
+      for (int iy=0; iy<nb; iy++) {
+        for (int ix=0; ix<nb; ix++) {
+          r(iz,iy,ix) = 2.0*a(iz,iy,ix) + 1.0;
+        }
+      }
+    }
+    timer_subarray.stop();
+
+    // same access through raw pointers for reference
+
+    timer_pointer.start();
+    const double * pa = array.data();
+    double * pr = result.data();
+    for (int iz=ng; iz<nb+ng; iz++) {
+      for (int iy=ng; iy<nb+ng; iy++) {
+        const int i0 = m*(iy + m*iz);
+        for (int ix=ng; ix<nb+ng; ix++) {
+          pr[i0+ix] = 2.0*pa[i0+ix] + 1.0;
+        }
+      }
+    }
+    timer_pointer.stop();
+  }
+
+  const double cells = double(ni)*nb*nb*nb;
+  const double bytes = 2.0*cells*sizeof(double);
+  benchmark.add ("cello_array:subarray",timer_subarray.value(),cells,bytes);
+  benchmark.add ("cello_array:pointer", timer_pointer.value(), cells,bytes);
+}
+
+//----------------------------------------------------------------------
+
+void benchmark_param_ (Benchmark & benchmark, int nb, int ni)
+{
+  const char * file_name = "benchmark_kernels.in";
+  FILE * fp = fopen (file_name,"w");
+  fprintf (fp,"Benchmark {\n");
+  fprintf (fp,"  value = sin(x)*cos(y) + 0.5*z*z - t;\n");
+  fprintf (fp,"}\n");
+  fclose (fp);
+
+  Parameters parameters;
+  parameters.read(file_name);
+  parameters.group_set(0,"Benchmark");
+
+  // evaluate over one row of cells at a time, as Initial objects do
+
+  std::vector<double> x(nb),y(nb),z(nb),result(nb),deflt(nb,0.0);
+  for (int ix=0; ix<nb; ix++) x[ix] = (ix + 0.5)/nb;
+
+  Timer timer;
+  for (int iter=0; iter<ni; iter++) {
+    for (int iz=0; iz<nb; iz++) {
+      for (int iy=0; iy<nb; iy++) {
+        std::fill(y.begin(),y.end(),(iy + 0.5)/nb);
+        std::fill(z.begin(),z.end(),(iz + 0.5)/nb);
+        timer.start();
+        parameters.evaluate_float
+          ("value",nb,result.data(),deflt.data(),
+           x.data(),y.data(),z.data(),0.0);
+        timer.stop();
+      }
+    }
+  }
+
+  const double cells = double(ni)*nb*nb*nb;
+  const double bytes = 4.0*cells*sizeof(double);
+  benchmark.add ("param:evaluate_float",timer.value(),cells,bytes);
+}
+
+//----------------------------------------------------------------------
+
+void benchmark_particle_ (Benchmark & benchmark, int nb, int ni)
+{
+  // one particle per cell, with about 10% leaving the block each
+  // iteration and scattered among 26 neighbors
+
+  const int np = nb*nb*nb;
+  const int n_neighbor = 26;
+
+  ParticleDescr * particle_descr = new ParticleDescr;
+  particle_descr->set_batch_size(1024);
+  const int it = particle_descr->new_type("dark");
+  const char * attributes[] = {"position_x","position_y","position_z",
+                               "velocity_x","velocity_y","velocity_z",
+                               "mass"};
+  for (int ia=0; ia<7; ia++) {
+    particle_descr->new_attribute(it,attributes[ia],type_double);
+  }
+  particle_descr->set_position(it,0,1,2);
+
+  const int particle_bytes = particle_descr->particle_bytes(it);
+
+  Timer timer_insert;
+  Timer timer_scatter;
+  Timer timer_delete;
+  double np_moved = 0.0;
+
+  for (int iter=0; iter<ni; iter++) {
+
+    ParticleData * particle_data = new ParticleData;
+    std::vector<ParticleData *> neighbors(n_neighbor);
+    for (int k=0; k<n_neighbor; k++) neighbors[k] = new ParticleData;
+
+    Particle particle (particle_descr,particle_data);
+
+    timer_insert.start();
+    particle.insert_particles(it,np);
+    timer_insert.stop();
+
+    const int nb_batch = particle.num_batches(it);
+    for (int ib=0; ib<nb_batch; ib++) {
+      const int npb = particle.num_particles(it,ib);
+      bool * mask = new bool [npb];
+      int * index = new int [npb];
+      for (int ip=0; ip<npb; ip++) {
+        const int i = ip + 1024*ib;
+        mask[ip]  = ((i*7919) % 10 == 0);
+        index[ip] = i % n_neighbor;
+      }
+
+      timer_scatter.start();
+      particle.scatter (it,ib,npb,mask,index,n_neighbor,neighbors.data());
+      timer_scatter.stop();
+
+      timer_delete.start();
+      np_moved += particle.delete_particles (it,ib,mask);
+      timer_delete.stop();
+
+      delete [] index;
+      delete [] mask;
+    }
+
+    for (int k=0; k<n_neighbor; k++) delete neighbors[k];
+    delete particle_data;
+  }
+
+  const double particles = double(ni)*np;
+  benchmark.add ("particle:insert", timer_insert.value(),
+                 particles, particles*particle_bytes);
+  benchmark.add ("particle:scatter",timer_scatter.value(),
+                 particles, 2.0*np_moved*particle_bytes);
+  benchmark.add ("particle:delete", timer_delete.value(),
+                 particles, 2.0*particles*particle_bytes);
+
+  delete particle_descr;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("Benchmark");
+
+  const int nb = (PARALLEL_ARGC > 1) ? atoi(PARALLEL_ARGV[1]) : 32;
+  const int ni = (PARALLEL_ARGC > 2) ? atoi(PARALLEL_ARGV[2]) : 20;
+
+  PARALLEL_PRINTF ("block %d^3  iterations %d\n",nb,ni);
+
+  Benchmark benchmark("kernels");
+  benchmark.set_parameter("block_size",nb);
+  benchmark.set_parameter("iterations",ni);
+
+  benchmark_field_face_  (benchmark,nb,ni);
+  benchmark_cello_array_ (benchmark,nb,ni);
+  benchmark_param_       (benchmark,nb,ni);
+  benchmark_particle_    (benchmark,nb,ni);
+
+  unit_func("kernels");
+  unit_assert (benchmark.num_results() == 10);
+
+  if (PARALLEL_ARGC > 3) {
+    unit_func("write");
+    unit_assert (benchmark.write(PARALLEL_ARGV[3]));
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -0,0 +1,152 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     benchmark_Prolong.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Benchmark comparing specialized and generic prolongation
+///           and restriction kernels
+///
+/// Usage: benchmark_prolong [ block-size [ iterations [ json-file ] ] ]
+///
+/// Applies ProlongLinear (generic, specialized and face-only kernels) and
+/// RestrictLinear to a synthetic 3D block and reports ns/cell and
+/// GB/s for single and double precision, optionally writing them to
+/// a JSON file.  Results of the specialized kernels are checked for
+/// bitwise agreement with the generic kernel.
+
+#include "main.hpp"
+#include "test.hpp"
+#include "mesh.hpp"
+
+//----------------------------------------------------------------------
+
+template <class T>
+void fill_ (T * values, int n, double a)
+{
+  for (int i=0; i<n; i++) values[i] = sin(a*i) + 0.001*i;
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void benchmark_ (Benchmark & benchmark,
+                 precision_type precision, const char * name,
+                 int nb, int ni)
+{
+  ProlongLinear prolong_generic(false);
+  ProlongLinear prolong_special(true);
+  // face-only with the default ghost depth
+  ProlongLinear prolong_face(true,4);
+  RestrictLinear restrict_linear;
+
+  // fine block with 2*nb cells per axis; coarse block includes one
+  // ghost layer so that the interior prolongation weights are used
+
+  int mf3[3] = {2*nb,2*nb,2*nb};
+  int of3[3] = {0,0,0};
+  int nf3[3] = {2*nb,2*nb,2*nb};
+  int mc3[3] = {nb+2,nb+2,nb+2};
+  int oc3[3] = {0,0,0};
+  int nc3[3] = {nb+2,nb+2,nb+2};
+  int ir3[3] = {1,1,1};
+  int nr3[3] = {nb,nb,nb};
+
+  const int mf = mf3[0]*mf3[1]*mf3[2];
+  const int mc = mc3[0]*mc3[1]*mc3[2];
+
+  T * values_c = new T [mc];
+  T * values_f = new T [mf];
+  T * values_g = new T [mf];
+  T * values_h = new T [mf];
+
+  fill_ (values_c,mc,0.37);
+
+  Timer timer_generic;
+  Timer timer_special;
+  Timer timer_face;
+  Timer timer_restrict;
+
+  for (int iter=0; iter<ni; iter++) {
+    timer_generic.start();
+    prolong_generic.apply (precision, values_g, mf3,of3,nf3,
+                           values_c, mc3,oc3,nc3);
+    timer_generic.stop();
+    timer_special.start();
+    prolong_special.apply (precision, values_f, mf3,of3,nf3,
+                           values_c, mc3,oc3,nc3);
+    timer_special.stop();
+    timer_face.start();
+    prolong_face.apply (precision, values_h, mf3,of3,nf3,
+                        values_c, mc3,oc3,nc3);
+    timer_face.stop();
+    timer_restrict.start();
+    restrict_linear.apply (precision, values_c, mc3,ir3,nr3,
+                           values_f, mf3,of3,nf3);
+    timer_restrict.stop();
+  }
+
+  // check agreement using the final (restricted) coarse values
+
+  prolong_generic.apply (precision, values_g, mf3,of3,nf3,
+                         values_c, mc3,oc3,nc3, true);
+  prolong_special.apply (precision, values_f, mf3,of3,nf3,
+                         values_c, mc3,oc3,nc3, true);
+  bool l_equal = true;
+  for (int i=0; i<mf; i++) l_equal = l_equal && (values_f[i] == values_g[i]);
+
+  unit_func (name);
+  unit_assert (l_equal);
+
+  // bytes read and written per iteration: coarse block read and fine
+  // block written, and conversely for restriction
+
+  const double ncells = double(ni)*mf;
+  const double bytes_prolong  = double(ni)*(mc + mf)*sizeof(T);
+  const double bytes_restrict = double(ni)*(mf + nb*nb*nb)*sizeof(T);
+  const std::string prefix = std::string(name) + ":";
+  benchmark.add (prefix + "prolong_generic",
+                 timer_generic.value(), ncells, bytes_prolong);
+  benchmark.add (prefix + "prolong_specialized",
+                 timer_special.value(), ncells, bytes_prolong);
+  benchmark.add (prefix + "prolong_face",
+                 timer_face.value(), ncells, bytes_prolong);
+  benchmark.add (prefix + "restrict",
+                 timer_restrict.value(), ncells, bytes_restrict);
+
+  delete [] values_c;
+  delete [] values_f;
+  delete [] values_g;
+  delete [] values_h;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("ProlongLinear");
+
+  const int nb = (PARALLEL_ARGC > 1) ? atoi(PARALLEL_ARGV[1]) : 32;
+  const int ni = (PARALLEL_ARGC > 2) ? atoi(PARALLEL_ARGV[2]) : 100;
+
+  PARALLEL_PRINTF ("coarse block %d^3  iterations %d\n",nb,ni);
+
+  Benchmark benchmark("prolong");
+  benchmark.set_parameter("block_size",nb);
+  benchmark.set_parameter("iterations",ni);
+
+  benchmark_<float>  (benchmark,precision_single,"single",nb,ni);
+  benchmark_<double> (benchmark,precision_double,"double",nb,ni);
+
+  if (PARALLEL_ARGC > 3) benchmark.write(PARALLEL_ARGV[3]);
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
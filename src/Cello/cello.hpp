@@ -40,6 +40,7 @@
 
 #include "cello_defines.hpp"
 #include "cello_Sync.hpp"
+#include "cello_Random.hpp"
 
 // #define DEBUG_CHECK
 
@@ -0,0 +1,126 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     cello_Random.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Cello] Declaration of the Random class
+///
+/// Counter-based random number generator (Philox4x32-10, Salmon et
+/// al. 2011).  Each draw is a pure function of (seed, stream, item,
+/// draw), so values do not depend on the order in which they are
+/// requested, on the number of threads, or on whether the run was
+/// restarted.
+
+#ifndef CELLO_RANDOM_HPP
+#define CELLO_RANDOM_HPP
+
+class Random {
+
+  /// @class    Random
+  /// @ingroup  Cello
+  /// @brief    [\ref Cello] Stateless counter-based random numbers
+  ///
+  /// The 64-bit key is formed from the user seed and a stream
+  /// identifier (e.g. a Method name); the 128-bit counter from the
+  /// stream position (e.g. Block Index and cycle), the item (e.g. cell
+  /// or particle index) and the draw number within the item.
+
+public:
+
+  /// Create a generator for the given seed, stream, and 64-bit
+  /// position within the stream
+  Random (uint64_t seed = 0, uint64_t stream = 0, uint64_t position = 0)
+    : key_(mix64(seed ^ mix64(stream))),
+      position_(mix64(position))
+  { }
+
+  /// Return four independent 32-bit random integers for the given
+  /// item and draw number
+  void bits4 (uint64_t item, uint32_t draw, uint32_t r[4]) const
+  {
+    uint32_t c[4] = { uint32_t(item), uint32_t(item >> 32),
+                      draw ^ uint32_t(position_),
+                      uint32_t(position_ >> 32) };
+    philox4x32_10 (c, uint32_t(key_), uint32_t(key_ >> 32));
+    r[0] = c[0]; r[1] = c[1]; r[2] = c[2]; r[3] = c[3];
+  }
+
+  /// Return a random 64-bit integer for the given item and draw
+  uint64_t bits64 (uint64_t item, uint32_t draw = 0) const
+  {
+    uint32_t r[4];
+    bits4 (item,draw,r);
+    return (uint64_t(r[1]) << 32) | r[0];
+  }
+
+  /// Return a uniform double in [0,1) with 53 random bits
+  double uniform (uint64_t item, uint32_t draw = 0) const
+  { return (bits64(item,draw) >> 11) * (1.0 / 9007199254740992.0); }
+
+  /// Return a standard normal deviate (Box-Muller)
+  double normal (uint64_t item, uint32_t draw = 0) const
+  {
+    uint32_t r[4];
+    bits4 (item,draw,r);
+    const double u1 = ((((uint64_t(r[1]) << 32) | r[0]) >> 11) + 1.0)
+      * (1.0 / 9007199254740992.0);
+    const double u2 = (((uint64_t(r[3]) << 32) | r[2]) >> 11)
+      * (1.0 / 9007199254740992.0);
+    return std::sqrt(-2.0*std::log(u1)) * std::cos(6.283185307179586*u2);
+  }
+
+  /// Hash a string (e.g. a Method name) to a 64-bit stream identifier
+  static uint64_t stream (const std::string & name)
+  {
+    // FNV-1a
+    uint64_t h = 14695981039346656037ull;
+    for (size_t i=0; i<name.size(); i++) {
+      h ^= uint64_t((unsigned char)(name[i]));
+      h *= 1099511628211ull;
+    }
+    return h;
+  }
+
+  /// SplitMix64 finalizer, used to combine key and position words
+  static uint64_t mix64 (uint64_t z)
+  {
+    z += 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+  }
+
+  /// Philox4x32 with 10 rounds applied in place to counter c
+  static void philox4x32_10 (uint32_t c[4], uint32_t k0, uint32_t k1)
+  {
+    for (int round=0; round<10; round++) {
+      const uint64_t p0 = uint64_t(0xD2511F53u) * c[0];
+      const uint64_t p1 = uint64_t(0xCD9E8D57u) * c[2];
+      const uint32_t hi0 = uint32_t(p0 >> 32), lo0 = uint32_t(p0);
+      const uint32_t hi1 = uint32_t(p1 >> 32), lo1 = uint32_t(p1);
+      c[0] = hi1 ^ c[1] ^ k0;
+      c[1] = lo1;
+      c[2] = hi0 ^ c[3] ^ k1;
+      c[3] = lo0;
+      k0 += 0x9E3779B9u;
+      k1 += 0xBB67AE85u;
+    }
+  }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    p | key_;
+    p | position_;
+  }
+
+private: // attributes
+
+  /// Philox key derived from seed and stream
+  uint64_t key_;
+
+  /// Upper 64 counter bits derived from the stream position
+  uint64_t position_;
+};
+
+#endif /* CELLO_RANDOM_HPP */
@@ -219,6 +219,8 @@ MsgCoarsen * MsgCoarsen::unpack(void * buffer)
   // 3. Save the input buffer for freeing later
 
   msg->buffer_ = buffer;
+  msg->memory_account_.set
+    (memory_category_message, pc - (char *) buffer);
 
   return msg;
 }
@@ -279,5 +281,6 @@ void MsgCoarsen::update (Data * data)
   if (!is_local_) {
     CkFreeMsg (buffer_);
     buffer_ = nullptr;
+    memory_account_.clear();
   }
 }
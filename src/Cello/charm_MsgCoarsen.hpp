@@ -75,6 +75,9 @@ protected: // attributes
   /// Saved Charm++ buffer for deleting after unpack()
   void * buffer_;
 
+  /// Bytes of the saved buffer reported to Memory categories
+  MemoryAccount memory_account_;
+
   /// Mesh connectivity of child block to update parent's
   Adapt * adapt_child_;
   
@@ -175,6 +175,8 @@ MsgInitial * MsgInitial::unpack(void * buffer)
   // Save the input buffer for freeing later
 
   msg->buffer_ = buffer;
+  msg->memory_account_.set
+    (memory_category_message, pc - (char *) buffer);
 
   return msg;
 }
@@ -188,6 +190,7 @@ void MsgInitial::update (Data * data)
   if (!is_local_) {
     CkFreeMsg (buffer_);
     buffer_ = nullptr;
+    memory_account_.clear();
   } 
 }
 
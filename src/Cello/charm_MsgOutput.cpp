@@ -224,6 +224,8 @@ MsgOutput * MsgOutput::unpack(void * buffer)
   // Save the input buffer for freeing later
 
   msg->buffer_ = buffer;
+  msg->memory_account_.set
+    (memory_category_message, pc - (char *) buffer);
 
   return msg;
 }
@@ -240,6 +242,7 @@ void MsgOutput::update (Data * data)
   if (!is_local_) {
     CkFreeMsg (buffer_);
     buffer_ = nullptr;
+    memory_account_.clear();
   }
 }
 
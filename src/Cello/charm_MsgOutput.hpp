@@ -136,6 +136,9 @@ protected: // attributes
   /// Saved Charm++ buffers for deleting after unpack()
   void * buffer_;
 
+  /// Bytes of the saved buffer reported to Memory categories
+  MemoryAccount memory_account_;
+
   /// Random hex tag for tracking messages for debugging
   char tag_[TAG_LEN+1];
 
@@ -311,6 +311,8 @@ MsgRefine * MsgRefine::unpack(void * buffer)
   //  CkPrintf ("%s:%d DEBUG_MSG_REFINE CkFreeMsg (%p)\n",__FILE__,__LINE__,buffer);
 #endif  
   msg->buffer_ = buffer;
+  msg->memory_account_.set
+    (memory_category_message, pc - (char *) buffer);
   
   return msg;
 }
@@ -372,6 +374,7 @@ void MsgRefine::update (Data * data)
   if (! is_local_) {
     CkFreeMsg (buffer_);
     buffer_ = nullptr;
+    memory_account_.clear();
   }
 }
 
@@ -106,6 +106,9 @@ protected:
   /// Saved Charm++ buffers for deleting after unpack()
   void * buffer_;
 
+  /// Bytes of the saved buffer reported to Memory categories
+  MemoryAccount memory_account_;
+
 };
 
 #endif /* CHARM_MSG_HPP */
@@ -139,6 +139,8 @@ MsgRefresh * MsgRefresh::unpack(void * buffer)
   // 3. Save the input buffer for freeing later
 
   msg->buffer_ = buffer;
+  msg->memory_account_.set
+    (memory_category_message, pc - (char *) buffer);
 
   return msg;
 }
@@ -154,6 +156,7 @@ void MsgRefresh::update (Data * data)
   if (!is_local_) {
       CkFreeMsg (buffer_);
       buffer_ = nullptr;
+      memory_account_.clear();
   }
 }
 
@@ -71,6 +71,9 @@ protected: // attributes
   /// Saved Charm++ buffer for deleting after unpack()
   void * buffer_;
 
+  /// Bytes of the saved buffer reported to Memory categories
+  MemoryAccount memory_account_;
+
 };
 
 #endif /* CHARM_MSG_HPP */
@@ -16,11 +16,11 @@ CkReductionMsg * r_reduce_performance(int n, CkReductionMsg ** msgs)
 
   const int length = 2 + num_sum + num_max;
   std::vector<long long> accum;
+  // allow for Method time histograms
   ASSERT1 ("r_reduce_performance",
 	   "Sanity check failed on expected accumulator array %d",
-	   length, (length < 500));
-  accum.resize(length);
-  accum.clear();
+	   length, (length < 100000));
+  accum.assign(length,0);
 
   // save length
   accum [0] = num_sum;
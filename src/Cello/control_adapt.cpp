@@ -56,6 +56,7 @@
 void Block::adapt_enter_()
 {
   TRACE_ADAPT("adapt_enter_",this);
+  trace_begin_("adapt");
   if ( do_adapt_()) {
 
     adapt_begin_();
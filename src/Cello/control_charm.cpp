@@ -77,9 +77,16 @@ void Block::adapt_exit_()
   fflush(stdout);
 #endif  
   TRACE_CONTROL("adapt_exit");
+  trace_end_("adapt");
 
   //  verify_neighbors();
 
+  // neighbors may have changed: forget fields sent to them
+  if (do_adapt_()) {
+    refresh_epoch_sent_.clear();
+    refresh_write_count_sent_.clear();
+  }
+
   control_sync_quiescence(CkIndex_Main::p_output_enter());
 }
 
@@ -90,6 +97,7 @@ void Block::output_exit_()
   performance_start_(perf_output);
 
   TRACE_CONTROL("output_exit");
+  trace_end_("output");
 
   if (index_.is_root()) {
     cello::simulation()->monitor_output();
@@ -111,8 +119,17 @@ void Block::output_exit_()
 void Block::stopping_exit_()
 {
   TRACE_CONTROL("stopping_exit");
+  trace_end_("stopping");
 
-  if (cello::simulation()->cycle_changed()) {
+  Simulation * simulation = cello::simulation();
+
+  if (simulation->cycle_changed()) {
+    // write timeline events once per process if scheduled
+    Schedule * schedule_trace = simulation->schedule_trace();
+    if (schedule_trace && schedule_trace->write_this_cycle(cycle_,time_)) {
+      simulation->trace_write(cycle_);
+      schedule_trace->next();
+    }
     // if performance counters haven't started yet for this cycle
     int cycle_initial = cello::config()->initial_cycle;
     if (cycle_ > cycle_initial) {
@@ -144,6 +161,7 @@ void Block::stopping_exit_()
 void Block::compute_exit_ ()
 {
   TRACE_CONTROL("compute_exit");
+  trace_end_("compute");
 
   control_sync_barrier(CkIndex_Block::r_adapt_enter(NULL));
 }
@@ -190,6 +208,7 @@ void Block::control_sync (int entry_point, int sync_type, int id_sync,
 
 void Block::control_sync_quiescence (int entry_point)
 {
+  trace_instant_("sync_quiescence");
   if (index_.is_root())
     CkStartQD(CkCallback (entry_point,proxy_main));
 }
@@ -198,6 +217,7 @@ void Block::control_sync_quiescence (int entry_point)
 
 void Block::control_sync_barrier (int entry_point)
 {
+  trace_instant_("sync_barrier");
   contribute(CkCallback (entry_point,thisProxy));
 }
 
@@ -210,6 +230,7 @@ void Block::control_sync_neighbor(int entry_point, int id_sync,
 {
   TRACE_CONTROL("control_sync_neighbor");
   TRACE_SYNC("control_sync_neighbhor()");
+  trace_instant_("sync_neighbor");
 
   if ( ! is_leaf() ) {
 
@@ -268,6 +289,7 @@ void Block::control_sync_face(int entry_point, int id_sync, int min_face_rank)
 
   TRACE_CONTROL("control_sync_face");
   TRACE_SYNC("control_sync_face()");
+  trace_instant_("sync_face");
 
   int num_faces = 0;
 
@@ -22,6 +22,7 @@
 void Block::compute_enter_ ()
 {
   performance_start_(perf_compute,__FILE__,__LINE__);
+  trace_begin_("compute");
   compute_begin_();
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
@@ -56,9 +57,39 @@ void Block::compute_next_ ()
 
     int ir_post = method->refresh_id_post();
 
-    cello::refresh(ir_post)->set_active (is_leaf());
+    Refresh * refresh = cello::refresh(ir_post);
 
-    refresh_start (ir_post,CkIndex_Block::p_compute_continue());
+    refresh->set_active (is_leaf());
+
+    // face data may have been sent while the previous Method computed
+
+    const bool is_sent = (index_refresh_prefetch_ == index_method_);
+    index_refresh_prefetch_ = -1;
+
+    const bool is_overlap =
+      method->overlap_refresh() && method->schedule() == NULL;
+
+    if (is_sent || is_overlap) {
+
+      const bool is_active = is_sent ?
+        refresh->is_active() : refresh_send (ir_post);
+
+      // update interior cells while face data are in transit, then
+      // wait for ghost zones before compute() updates the rest
+
+      if (is_overlap) compute_interior_();
+
+      if (is_active) {
+        refresh_wait (ir_post,CkIndex_Block::p_compute_continue());
+      } else {
+        refresh_exit (*refresh);
+      }
+
+    } else {
+
+      refresh_start (ir_post,CkIndex_Block::p_compute_continue());
+
+    }
 
   } else {
 
@@ -69,6 +100,25 @@ void Block::compute_next_ ()
 
 //----------------------------------------------------------------------
 
+void Block::compute_interior_ ()
+{
+  Method * method = this->method();
+
+#ifdef DEBUG_COMPUTE
+  if (cycle() >= CYCLE)
+    CkPrintf ("%d %s DEBUG_COMPUTE Block::compute_interior_(%s)\n",
+              CkMyPe(),name().c_str(),method->name().c_str());
+#endif
+
+  const long long time_start = Performance::time_nsec();
+
+  method->compute_interior (this);
+
+  method_time_interior_ = Performance::time_nsec() - time_start;
+}
+
+//----------------------------------------------------------------------
+
 void Block::compute_continue_ ()
 {
   performance_start_(perf_compute,__FILE__,__LINE__);
@@ -82,6 +132,24 @@ void Block::compute_continue_ ()
 #endif
 
   Method * method = this->method();
+
+  // send the next Method's face data now if this Method does not
+  // change them, so they are in transit while this Method computes
+
+  const int index_next = index_method_ + 1;
+  if (cello::problem()->method_graph()->prefetch_refresh(index_next)) {
+    const int ir_next =
+      cello::problem()->method(index_next)->refresh_id_post();
+    cello::refresh(ir_next)->set_active (is_leaf());
+    // copy face values when sending: a local neighbor applies them
+    // only when it reaches the refresh, and by then this Block may
+    // have completed the refresh and updated its fields in the Method
+    refresh_copy_faces_ = true;
+    refresh_send (ir_next);
+    refresh_copy_faces_ = false;
+    index_refresh_prefetch_ = index_next;
+  }
+
   Schedule * schedule = method->schedule();
   bool is_scheduled = 
     (schedule==NULL) ||
@@ -99,8 +167,16 @@ void Block::compute_continue_ ()
 #endif
     // Apply the method to the Block
 
+    cello::simulation()->performance()->start_method_counters();
+    // include time spent in compute_interior(), if any, but not the
+    // time waiting for the refresh
+    method_time_start_ = Performance::time_nsec() - method_time_interior_;
+    method_time_interior_ = 0;
+
     method->compute (this);
-    
+
+    compute_record_time_();
+
     performance_stop_(perf_compute,__FILE__,__LINE__);
 
   } else {
@@ -119,12 +195,42 @@ void Block::compute_done ()
   if (cycle() >= CYCLE)
     CkPrintf ("%d %s DEBUG_COMPUTE Block::compute_done_()\n", CkMyPe(),name().c_str());
 #endif
+  compute_record_time_();
+  refresh_count_writes_();
   index_method_++;
   compute_next_();
 }
 
 //----------------------------------------------------------------------
 
+void Block::compute_record_time_ ()
+{
+  // Method::compute() may call compute_done() before returning, which
+  // may in turn start the next Method, so the time is recorded by
+  // whichever comes first to count only this Method's own time
+
+  if (method_time_start_ == 0) return;
+
+  const long long time = Performance::time_nsec() - method_time_start_;
+  method_time_ += time;
+
+  Performance * performance = cello::simulation()->performance();
+  performance->stop_method_counters(index_method_,time);
+  if (performance->histograms()) {
+    performance->record_method_time(index_method_,time);
+  }
+
+  Tracer * tracer = Tracer::instance();
+  if (tracer->is_active()) {
+    Method * method = cello::problem()->method(index_method_);
+    tracer->complete(tracer->intern(method->name()),trace_id_(),
+                     method_time_start_,time);
+  }
+  method_time_start_ = 0;
+}
+
+//----------------------------------------------------------------------
+
 void Block::compute_end_ ()
 {
 #ifdef DEBUG_COMPUTE
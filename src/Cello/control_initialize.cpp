@@ -58,6 +58,8 @@ void Simulation::initialize() throw()
 
   cello::finalize_fields();
 
+  problem_->initialize_method_graph (config_);
+
   initialize_hierarchy_();
 
   // initialize_block_array() is called in charm_initialize
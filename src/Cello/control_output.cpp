@@ -26,6 +26,7 @@
 void Block::output_enter_ ()
 {
   TRACE_OUTPUT("Block::output_enter_()");
+  trace_begin_("output");
   performance_start_(perf_output);
   output_begin_();
   performance_stop_(perf_output);
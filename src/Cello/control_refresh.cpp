@@ -41,16 +41,35 @@
 //======================================================================
 
 void Block::refresh_start (int id_refresh, int callback)
+{
+  if (refresh_send (id_refresh)) {
+
+    refresh_wait(id_refresh,callback);
+
+  } else {
+
+    refresh_exit(*cello::refresh(id_refresh));
+
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool Block::refresh_send (int id_refresh)
 {
   CHECK_ID(id_refresh);
   Refresh * refresh = cello::refresh(id_refresh);
   Sync * sync = sync_(id_refresh);
 
+  trace_begin_("refresh");
+
   // Send field and/or particle data associated with the given refresh
   // object to corresponding neighbors
   if ( refresh->is_active() ) {
 
-    ASSERT1 ("Block::refresh_start()",
+    const long long time_send = Performance::time_nsec();
+
+    ASSERT1 ("Block::refresh_send()",
 	     "refresh[%d] state is not inactive",
 	     id_refresh,
 	     (sync->state() == RefreshState::INACTIVE));
@@ -79,8 +98,14 @@ void Block::refresh_start (int id_refresh, int callback)
 
     const int count = count_field + count_particle + count_flux;
 
+    Tracer * tracer = Tracer::instance();
+    if (tracer->is_active()) {
+      tracer->complete("refresh_send",trace_id_(),
+                       time_send, Performance::time_nsec() - time_send);
+    }
+
     // Make sure sync counter is not active
-    ASSERT4 ("Block::refresh_start()",
+    ASSERT4 ("Block::refresh_send()",
 	     "refresh[%d] sync object %p is active (%d/%d)",
 	     id_refresh, sync, sync->value(), sync->stop(),
 	     (sync->value() == 0 && sync->stop() == 0));
@@ -88,13 +113,9 @@ void Block::refresh_start (int id_refresh, int callback)
     // Initialize sync counter
     sync->set_stop(count);
 
-    refresh_wait(id_refresh,callback);
-
-  } else {
-
-    refresh_exit(*refresh);
-
   }
+
+  return refresh->is_active();
 }
 
 //----------------------------------------------------------------------
@@ -204,6 +225,8 @@ void Block::p_refresh_recv (MsgRefresh * msg_refresh)
 
   Sync * sync = sync_(id_refresh);
 
+  trace_instant_("refresh_recv");
+
   if (sync->state() == RefreshState::READY) {
 
     // unpack message data into Block data if ready
@@ -230,6 +253,7 @@ void Block::p_refresh_recv (MsgRefresh * msg_refresh)
 void Block::refresh_exit (Refresh & refresh)
 {
   CHECK_ID(refresh.id());
+  trace_end_("refresh");
   update_boundary_();
   control_sync (refresh.callback(),
   		refresh.sync_type(),
@@ -245,6 +269,12 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
 {
   int count = 0;
 
+  // epochs of fields that may be skipped if unchanged, computed once
+  // for all faces
+
+  const std::vector<int> epoch = refresh_field_epochs_(refresh);
+  const std::vector<int> * epoch_same = epoch.empty() ? nullptr : &epoch;
+
   const int min_face_rank = refresh.min_face_rank();
   const int neighbor_type = refresh.neighbor_type();
 
@@ -275,18 +305,23 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
 	(level_face == level)     ? refresh_same :
 	(level_face == level + 1) ? refresh_fine : refresh_unknown;
 
+      // no message either way if neither Block can have changed it
+
+      if (refresh_type == refresh_same &&
+          refresh_face_unchanged_(refresh,index_neighbor,if3)) continue;
+
       // handle padded interpolation special case if needed
       Prolong * prolong = refresh.prolong();
       int pad = refresh.coarse_padding(prolong);
 
       if (pad == 0) {
         refresh_load_field_face_
-          (refresh,refresh_type,index_neighbor,if3,ic3);
+          (refresh,refresh_type,index_neighbor,if3,ic3,epoch_same);
         ++count;
       } else {
         if (level_face == level) {
           refresh_load_field_face_
-            (refresh,refresh_type,index_neighbor,if3,ic3);
+            (refresh,refresh_type,index_neighbor,if3,ic3,epoch_same);
           ++count;
         } else {
           count += refresh_load_coarse_face_
@@ -316,8 +351,10 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
 
       if ( ! is_leaf() || face_level(if3) >= level()) {
 	Index index_face = it_face.index();
+        if (refresh_face_unchanged_(refresh,index_face,if3)) continue;
 	int ic3[3] = {0,0,0};
-	refresh_load_field_face_ (refresh,refresh_same,index_face,if3,ic3);
+	refresh_load_field_face_
+          (refresh,refresh_same,index_face,if3,ic3,epoch_same);
 	++count;
 
       }
@@ -331,7 +368,8 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
 
 void Block::refresh_load_field_face_
 ( Refresh & refresh,  int refresh_type,
-  Index index_neighbor,  int if3[3], int ic3[3])
+  Index index_neighbor,  int if3[3], int ic3[3],
+  const std::vector<int> * epoch)
 {
   // create refresh message
 
@@ -345,15 +383,29 @@ void Block::refresh_load_field_face_
   FieldFace * field_face = create_face
     (if3, ic3, g3, refresh_type, &refresh,false);
 
-  // create data message
-  DataMsg * data_msg = new DataMsg;
-  // initialize data message
-  data_msg -> set_field_face (field_face,true);
-  data_msg -> set_field_data (data()->field_data(),false);
+  // skip fields unchanged since last sent to the same-level neighbor
+
+  if (refresh_type == refresh_same && epoch != nullptr) {
+    field_face = refresh_skip_unchanged_
+      (refresh,field_face,index_neighbor,if3,*epoch);
+  }
 
   // initialize refresh message
   msg_refresh->set_refresh_id (refresh.id());
-  msg_refresh->set_data_msg (data_msg);
+
+  if (field_face) {
+    // create data message
+    DataMsg * data_msg = new DataMsg;
+    // initialize data message
+    data_msg -> set_field_face (field_face,true);
+    data_msg -> set_field_data (data()->field_data(),false);
+    if (refresh_copy_faces_) data_msg->copy_field_face();
+
+    msg_refresh->set_data_msg (data_msg);
+  }
+
+  // message is sent even if empty: the neighbor cannot tell which
+  // fields changed, so it expects one
 
   thisProxy[index_neighbor].p_refresh_recv (msg_refresh);
 
@@ -361,6 +413,154 @@ void Block::refresh_load_field_face_
 
 //----------------------------------------------------------------------
 
+std::vector<int> Block::refresh_field_epochs_ (Refresh & refresh)
+{
+  std::vector<int> epoch;
+
+  if (! cello::config()->field_refresh_skip_unchanged) return epoch;
+
+  // only Method post-refreshes: other refreshes, e.g. by Solvers, may
+  // follow writes through pointers acquired earlier in the Method,
+  // which only advance epochs when the Method completes
+
+  if (! cello::problem()->method_graph()->is_method_refresh(refresh.id())) {
+    return epoch;
+  }
+
+  const std::vector<int> field_list_src = refresh.field_list_src();
+  const std::vector<int> field_list_dst = refresh.field_list_dst();
+
+  // fields with differing source and destination (including
+  // accumulated fields) are always refreshed
+
+  if (field_list_src != field_list_dst) return epoch;
+
+  const FieldDescr * field_descr = cello::field_descr();
+  const FieldData * field_data = data()->field_data();
+
+  epoch.assign(field_descr->field_count(),-1);
+  for (int id_field : field_list_src) {
+    // temporary fields are reallocated each cycle: always refresh
+    if (field_descr->is_permanent(id_field)) {
+      epoch[id_field] = field_data->epoch(id_field);
+    }
+  }
+  return epoch;
+}
+
+//----------------------------------------------------------------------
+
+FieldFace * Block::refresh_skip_unchanged_
+( Refresh & refresh, FieldFace * field_face,
+  Index index_neighbor, const int if3[3],
+  const std::vector<int> & epoch)
+{
+  const std::vector<int> field_list_src = refresh.field_list_src();
+  const int nf = field_list_src.size();
+
+  const std::vector<int> field_list = Refresh::changed_fields
+    (field_list_src, epoch,
+     refresh_epoch_sent_[refresh_face_key_(refresh,index_neighbor,if3)]);
+
+  if (int(field_list.size()) == nf) return field_face;
+
+  // count skipped bytes
+
+  Field field = data()->field();
+  long long bytes = field_face->num_bytes_array(field);
+
+  if (field_list.size() == 0) {
+
+    delete field_face;
+    field_face = nullptr;
+
+  } else {
+
+    Refresh * refresh_dirty = new Refresh(refresh);
+    refresh_dirty->set_field_list(field_list);
+    field_face->set_refresh(refresh_dirty,true);
+    bytes -= field_face->num_bytes_array(field);
+
+  }
+
+  Refresh::bytes_skipped[cello::index_static()] += bytes;
+
+  return field_face;
+}
+
+//----------------------------------------------------------------------
+
+bool Block::refresh_face_unchanged_
+(Refresh & refresh, Index index_neighbor, const int if3[3])
+{
+  if (! cello::config()->field_refresh_skip_unchanged) return false;
+
+  // only Method post-refreshes: other refreshes, e.g. by Solvers, may
+  // follow writes within a Method
+
+  if (! cello::problem()->method_graph()->is_method_refresh(refresh.id())) {
+    return false;
+  }
+
+  const std::vector<int> field_list_src = refresh.field_list_src();
+  const std::vector<int> field_list_dst = refresh.field_list_dst();
+
+  if (field_list_src.empty() || field_list_src != field_list_dst) {
+    return false;
+  }
+
+  const FieldDescr * field_descr = cello::field_descr();
+  for (int id_field : field_list_src) {
+    if (! field_descr->is_permanent(id_field)) return false;
+  }
+
+  // counts start at zero in new Blocks: only changes since the last
+  // exchange matter
+
+  field_write_count_.resize(field_descr->field_count(),0);
+
+  const std::vector<int> field_changed = Refresh::changed_fields
+    (field_list_src, field_write_count_,
+     refresh_write_count_sent_[refresh_face_key_(refresh,index_neighbor,if3)]);
+
+  return field_changed.empty();
+}
+
+//----------------------------------------------------------------------
+
+void Block::refresh_count_writes_ ()
+{
+  const MethodGraph * method_graph = cello::problem()->method_graph();
+
+  const int num_fields = cello::field_descr()->field_count();
+
+  std::vector<int> field_list;
+  if (method_graph->is_known(index_method_)) {
+    field_list = method_graph->field_write(index_method_);
+  } else {
+    for (int id_field=0; id_field<num_fields; id_field++) {
+      field_list.push_back(id_field);
+    }
+  }
+
+  // advance epochs of written fields, including writes through
+  // pointers acquired before the Method, e.g. by cached bindings
+
+  FieldData * field_data = data()->field_data();
+  for (int id_field : field_list) {
+    field_data->mark_modified(id_field);
+  }
+
+  if (! cello::config()->field_refresh_skip_unchanged) return;
+
+  field_write_count_.resize(num_fields,0);
+  for (int id_field : field_list) {
+    ++field_write_count_[id_field];
+  }
+}
+
+//----------------------------------------------------------------------
+
 int Block::refresh_load_coarse_face_
 (Refresh refresh, int refresh_type,
  Index index_neighbor, int if3[3], int ic3[3])
@@ -36,6 +36,7 @@
 
 void Block::stopping_enter_()
 {
+  trace_begin_("stopping");
   stopping_begin_();
 }
 
@@ -103,6 +104,7 @@ void Block::stopping_begin_()
     CkPrintf ("%s %s:%d DEBUG_CONTRIBUTE\n",
 	      name().c_str(),__FILE__,__LINE__); fflush(stdout);
 #endif    
+    trace_begin_("stopping_reduce");
     contribute(2*sizeof(double), min_reduce, CkReduction::min_double, callback);
 
   } else {
@@ -120,6 +122,7 @@ void Block::r_stopping_compute_timestep(CkReductionMsg * msg)
   performance_start_(perf_stopping);
   
   TRACE_STOPPING("Block::r_stopping_compute_timestep");
+  trace_end_("stopping_reduce");
   
   ++age_;
 
@@ -234,6 +237,14 @@ void Block::stopping_load_balance_()
 
 //----------------------------------------------------------------------
 
+void Block::UserSetLBLoad()
+{
+  setObjTime(1e-9*method_time_);
+  method_time_ = 0;
+}
+
+//----------------------------------------------------------------------
+
 void Block::ResumeFromSync()
 {
   // Monitor * monitor = simulation()->monitor();
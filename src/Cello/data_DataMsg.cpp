@@ -194,7 +194,11 @@ char * DataMsg::save_data (char * buffer) const
   }
     // save field array
   if (n_ff > 0 && n_fa > 0) {
-    ff->face_to_array(field,pc);
+    if (field_array_copy_.empty()) {
+      ff->face_to_array(field,pc);
+    } else {
+      memcpy(pc,field_array_copy_.data(),n_fa);
+    }
     pc += n_fa;
   }
   // save particle data
@@ -328,6 +332,18 @@ char * DataMsg::load_data (char * buffer)
 
 //----------------------------------------------------------------------
 
+void DataMsg::copy_field_face ()
+{
+  if (field_face_ == nullptr || field_data_u_ == nullptr) return;
+
+  Field field (cello::field_descr(), field_data_u_);
+
+  field_array_copy_.resize(field_face_->num_bytes_array(field));
+  field_face_->face_to_array(field,field_array_copy_.data());
+}
+
+//----------------------------------------------------------------------
+
 void DataMsg::update (Data * data, bool is_local, bool is_kept)
 {
   TRACE_DATA_MSG("update()");
@@ -357,7 +373,15 @@ void DataMsg::update (Data * data, bool is_local, bool is_kept)
 
     Field field_dst = data->field();
 
-    if (is_local) {
+    if (is_local && ! field_array_copy_.empty()) {
+
+      // invert face since incoming not outgoing
+
+      ff->invert_face();
+
+      ff->array_to_face(field_array_copy_.data(),field_dst);
+
+    } else if (is_local) {
 
       Field field_src(cello::field_descr(),field_data_u_);
 
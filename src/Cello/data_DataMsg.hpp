@@ -24,6 +24,7 @@ public: // interface
       field_face_delete_   (false),
       field_data_u_(nullptr),
       field_data_delete_   (false),
+      field_array_copy_(),
       particle_data_(nullptr),
       particle_data_delete_(false),
       face_fluxes_list_(),
@@ -125,6 +126,11 @@ public: // interface
     field_data_delete_ = is_new;
   }
 
+  /// Copy the FieldFace values from the FieldData now, so that a
+  /// local destination receives them rather than values the source
+  /// fields have when the message is applied
+  void copy_field_face ();
+
   /// --------------------
   /// PARTICLE DATA
   /// --------------------
@@ -235,6 +241,9 @@ protected: // attributes
   };
   /// Whether FieldData data should be deleted in destructor
   bool field_data_delete_;
+
+  /// FieldFace values copied by copy_field_face(), if any
+  std::vector<char> field_array_copy_;
   
   /// Particle data
   ParticleData * particle_data_;
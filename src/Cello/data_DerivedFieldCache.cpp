@@ -0,0 +1,52 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_DerivedFieldCache.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Implementation of the DerivedFieldCache class
+
+#include "data.hpp"
+
+//----------------------------------------------------------------------
+
+long long DerivedFieldCache::num_hits[CONFIG_NODE_SIZE] = {0};
+long long DerivedFieldCache::num_misses[CONFIG_NODE_SIZE] = {0};
+
+//----------------------------------------------------------------------
+
+bool DerivedFieldCache::is_current
+(const std::string & name, const std::vector<long long> & key) throw()
+{
+  auto it = entries_.find(name);
+  const bool is_current = (it != entries_.end()) && (it->second.key == key);
+
+  const int in = cello::index_static();
+  if (is_current) {
+    ++num_hits[in];
+  } else {
+    ++num_misses[in];
+  }
+  return is_current;
+}
+
+//----------------------------------------------------------------------
+
+void DerivedFieldCache::invalidate (const std::string & name) throw()
+{
+  if (name == "") {
+    entries_.clear();
+  } else {
+    entries_.erase(name);
+  }
+}
+
+//----------------------------------------------------------------------
+
+size_t DerivedFieldCache::bytes () const throw()
+{
+  size_t bytes = 0;
+  for (const auto & entry : entries_) {
+    bytes += entry.second.values.capacity();
+  }
+  return bytes;
+}
@@ -0,0 +1,87 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_DerivedFieldCache.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Data] Declaration of the DerivedFieldCache class
+
+#ifndef DATA_DERIVED_FIELD_CACHE_HPP
+#define DATA_DERIVED_FIELD_CACHE_HPP
+
+class DerivedFieldCache {
+
+  /// @class    DerivedFieldCache
+  /// @ingroup  Data
+  /// @brief    [\ref Data] Validity and storage of derived fields of a Block
+  ///
+  /// Quantities derived from a Block's fields (e.g. pressure or
+  /// temperature) are computed by whichever Method or Refine object
+  /// first needs them, and reused by others until the fields they
+  /// depend on change.  Each derived field is identified by name and
+  /// validated by a key, typically the modification epochs of its
+  /// input fields and the ghost epoch together with any parameters of
+  /// the computation.  Values may be stored in a permanent field, in
+  /// which case only the key is kept here, or in storage owned by the
+  /// cache.  The cache is not pup'ed, since field epochs restart
+  /// after migration.
+
+public: // interface
+
+  /// Create an empty cache
+  DerivedFieldCache() throw()
+    : entries_()
+  { }
+
+  /// Return whether the named derived field is current for the given
+  /// key, counting a hit or miss for this process
+  bool is_current (const std::string & name,
+                   const std::vector<long long> & key) throw();
+
+  /// Record the key for which the named derived field is current
+  void set_current (const std::string & name,
+                    const std::vector<long long> & key) throw()
+  { entries_[name].key = key; }
+
+  /// Return storage owned by the cache for n values of the named
+  /// derived field.  Existing values are kept if the size is unchanged
+  template <class T>
+  T * values (const std::string & name, size_t n) throw()
+  {
+    std::vector<char> & values = entries_[name].values;
+    values.resize(n*sizeof(T));
+    return (T *) values.data();
+  }
+
+  /// Discard the named derived field, or all derived fields if name
+  /// is empty
+  void invalidate (const std::string & name = "") throw();
+
+  /// Return the number of bytes stored by the cache
+  size_t bytes () const throw();
+
+public: // static attributes
+
+  /// Number of lookups of current derived fields on each process
+  static long long num_hits[CONFIG_NODE_SIZE];
+
+  /// Number of lookups of missing or stale derived fields on each
+  /// process
+  static long long num_misses[CONFIG_NODE_SIZE];
+
+private: // classes
+
+  struct Entry {
+    /// Key for which the derived field is current
+    std::vector<long long> key;
+    /// Values if stored in the cache
+    std::vector<char> values;
+  };
+
+private: // attributes
+
+  /// Derived fields by name
+  std::map<std::string,Entry> entries_;
+
+};
+
+#endif /* DATA_DERIVED_FIELD_CACHE_HPP */
@@ -250,10 +250,38 @@ public: // interface
   /// Return array for the corresponding field, which may or may not
   /// contain ghosts depending on if they're allocated
   const char * values (int id_field, int index_history=0) const throw ()
-  { return field_data_->values(field_descr_,id_field,index_history); }
+  {
+    return ((const FieldData *)field_data_)->values
+      (field_descr_,id_field,index_history);
+  }
 
   const char * values (std::string name, int index_history=0) const throw ()
-  { return field_data_->values(field_descr_,name,index_history); }
+  {
+    return ((const FieldData *)field_data_)->values
+      (field_descr_,name,index_history);
+  }
+
+  /// Return array for the corresponding field without advancing its
+  /// modification epoch, for updates such as writing ghost zones that
+  /// leave the field's active values unchanged
+  char * values_unmarked (int id_field) throw ()
+  { return field_data_->values_unmarked(field_descr_,id_field); }
+
+  /// Return the modification epoch of the given field
+  int epoch (int id_field) const throw ()
+  { return field_data_->epoch(id_field); }
+
+  /// Return the ghost epoch, advanced when a refresh writes ghost zones
+  int ghost_epoch () const throw ()
+  { return field_data_->ghost_epoch(); }
+
+  /// Advance the ghost epoch
+  void mark_ghosts_modified () throw ()
+  { field_data_->mark_ghosts_modified(); }
+
+  /// Return the cache of quantities derived from the fields
+  DerivedFieldCache * derived_cache () throw ()
+  { return field_data_->derived_cache(); }
 
   /// Return a CelloArray that acts as a view of the corresponding field
   ///
@@ -282,13 +310,19 @@ public: // interface
   CelloArray<const T, 3> view(int id_field,
                               ghost_choice choice = ghost_choice::include,
 			      int index_history=0) const throw()
-  { return field_data_->view<T>(field_descr_,id_field,choice,index_history); }
+  {
+    return ((const FieldData *)field_data_)->view<T>
+      (field_descr_,id_field,choice,index_history);
+  }
 
   template<class T>
   CelloArray<const T, 3> view(std::string name,
                               ghost_choice choice = ghost_choice::include,
                               int index_history=0) const throw()
-  { return field_data_->view<T>(field_descr_,name,choice,index_history); }
+  {
+    return ((const FieldData *)field_data_)->view<T>
+      (field_descr_,name,choice,index_history);
+  }
 
   /// Return array for the corresponding coarse field
   char * coarse_values (int id_field) throw ()
@@ -324,10 +358,16 @@ public: // interface
   { return field_data_->unknowns(field_descr_,name,index_history); }
 
   const char * unknowns (int id_field, int index_history=0) const throw ()
-  { return field_data_->unknowns(field_descr_,id_field,index_history); }
+  {
+    return ((const FieldData *)field_data_)->unknowns
+      (field_descr_,id_field,index_history);
+  }
 
   const char * unknowns (std::string name, int index_history=0) const throw ()
-  { return field_data_->unknowns(field_descr_,name,index_history); }
+  {
+    return ((const FieldData *)field_data_)->unknowns
+      (field_descr_,name,index_history);
+  }
 
   /// Return raw pointer to the array of all fields.  Const since
   /// otherwise dangerous due to varying field sizes, precisions,
@@ -361,11 +401,14 @@ public: // interface
   void allocate_permanent(bool ghosts_allocated = false) throw()
   { field_data_->allocate_permanent(field_descr_,ghosts_allocated); }
 
-  /// Allocate storage for the temporary fields
-  void allocate_temporary(std::string field) throw ()
-  { allocate_temporary(field_id(field)); }
-  void allocate_temporary(int id) throw ()
-  { field_data_->allocate_temporary(field_descr_,id); }
+  /// Allocate storage for the temporary fields, accounted for in the
+  /// given Memory category
+  void allocate_temporary
+  (std::string field, int category = memory_category_field_temporary) throw ()
+  { allocate_temporary(field_id(field),category); }
+  void allocate_temporary
+  (int id, int category = memory_category_field_temporary) throw ()
+  { field_data_->allocate_temporary(field_descr_,id,category); }
 
   /// Deallocate storage for the temporary fields
   void deallocate_temporary(std::string field) throw ()
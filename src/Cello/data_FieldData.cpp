@@ -19,13 +19,18 @@ FieldData::FieldData
   : array_permanent_(),
     temporary_size_(),
     array_temporary_(),
+    temporary_category_(),
     offsets_(),
     ghosts_allocated_(true),
     history_id_(),
     history_time_(),
     units_scaling_(),
     coarse_dimensions_(),
-    array_coarse_()
+    array_coarse_(),
+    epoch_(),
+    ghost_epoch_(0),
+    derived_cache_(),
+    memory_account_()
 {
   if (nx != 0) {
     size_[0] = nx;
@@ -97,6 +102,7 @@ void FieldData::pup(PUP::er &p)
   p | history_time_;
   p | units_scaling_;
 
+  if (p.isUnpacking()) update_memory_();
 }
 
 
@@ -134,12 +140,22 @@ const char * FieldData::values
   int id_field, int index_history ) const throw ()
 {
   return (const char *)
-    ((FieldData *)this) -> values(field_descr,id_field, index_history);
+    ((FieldData *)this) -> values_(field_descr,id_field, index_history);
 }
 
 //----------------------------------------------------------------------
 
 char * FieldData::values
+(const FieldDescr * field_descr,
+ int id_field, int index_history ) throw ()
+{
+  if (index_history == 0) mark_modified(id_field);
+  return values_(field_descr,id_field,index_history);
+}
+
+//----------------------------------------------------------------------
+
+char * FieldData::values_
 (const FieldDescr * field_descr,
  int id_field, int index_history ) throw ()
 {
@@ -209,12 +225,22 @@ const char * FieldData::unknowns
   int id_field, int index_history ) const throw ()
 {
   return (const char *)
-    ((FieldData *)this) -> unknowns(field_descr,id_field);
+    ((FieldData *)this) -> unknowns_(field_descr,id_field,index_history);
 }
 
 //----------------------------------------------------------------------
 
 char * FieldData::unknowns
+(const FieldDescr * field_descr,
+ int id_field, int index_history  ) throw ()
+{
+  if (index_history == 0) mark_modified(id_field);
+  return unknowns_(field_descr,id_field,index_history);
+}
+
+//----------------------------------------------------------------------
+
+char * FieldData::unknowns_
 (const FieldDescr * field_descr,
  int id_field, int index_history  ) throw ()
 {
@@ -230,7 +256,7 @@ char * FieldData::unknowns
 
   // First get values including ghosts
   // (note index_history ommitted since already have updated id_field)
-  char * unknowns = values(field_descr,id_field);
+  char * unknowns = values_(field_descr,id_field,0);
 
   // Then adjust for ghost zones
   if ( ghosts_allocated() && unknowns ) {
@@ -408,12 +434,14 @@ void FieldData::allocate_permanent
       allocate_temporary (field_descr,history_id_[i]);
     }
   }
+
+  update_memory_();
 }
 
 //----------------------------------------------------------------------
 
 void FieldData::allocate_temporary (const FieldDescr * field_descr,
-				    int id_field) throw ()
+				    int id_field, int category) throw ()
 
 {
   allocate_coarse(field_descr,id_field);
@@ -423,6 +451,11 @@ void FieldData::allocate_temporary (const FieldDescr * field_descr,
     array_temporary_.resize(index_field+1);
     temporary_size_. resize(index_field+1);
   }
+  if (! (index_field < int(temporary_category_.size()))) {
+    temporary_category_.resize
+      (index_field+1,memory_category_field_temporary);
+  }
+  temporary_category_[index_field] = category;
 
   if (array_temporary_[index_field].size() == 0) {
     int mx,my,mz;
@@ -442,6 +475,7 @@ void FieldData::allocate_temporary (const FieldDescr * field_descr,
       WARNING("FieldData::allocate_temporary",
 	      "Calling allocate_temporary() on already-allocated Field");
     }
+    update_memory_();
   }
 }
 
@@ -496,7 +530,7 @@ void FieldData::allocate_coarse (const FieldDescr * field_descr, int id_field) t
       WARNING("FieldData::allocate_coarse",
               "Calling allocate_coarse() on already-allocated Field");
     }
-
+    update_memory_();
   }
 }
 
@@ -517,6 +551,7 @@ void FieldData::deallocate_temporary (const FieldDescr * field_descr,
     array_temporary_[index_field].clear();
   }
   temporary_size_ [index_field] = 0;
+  update_memory_();
 }
 
 //----------------------------------------------------------------------
@@ -536,6 +571,7 @@ void FieldData::deallocate_coarse (int index_field) throw()
   if (index_field < (int)array_coarse_.size()) {
     array_coarse_[index_field].clear();
     coarse_dimensions_ [index_field] = 0;
+    update_memory_();
   }
 }
 //----------------------------------------------------------------------
@@ -579,6 +615,7 @@ void FieldData::deallocate_permanent () throw()
 
     array_permanent_.clear();
     offsets_.clear();
+    update_memory_();
   }
 }
 
@@ -1106,6 +1143,8 @@ char * FieldData::load_data (FieldDescr * field_descr,
   LOAD_VECTOR_TYPE(pc,int,coarse_dimensions_);
   LOAD_VECTOR_VECTOR_TYPE(pc,char,array_coarse_);
 
+  update_memory_();
+
   ASSERT2("FieldData::load_data()",
 	  "Buffer has size %ld but expecting size %d",
 	  (pc-buffer),data_size(field_descr),
@@ -1287,6 +1326,34 @@ void FieldData::set_history_(const FieldDescr * field_descr)
 }
 //----------------------------------------------------------------------
 
+void FieldData::update_memory_() throw()
+{
+  // vector capacities are used since clear() does not release storage
+
+  int64_t bytes_temporary = 0;
+  int64_t bytes_solver    = 0;
+  for (size_t i=0; i<array_temporary_.size(); i++) {
+    const int64_t bytes = array_temporary_[i].capacity();
+    if (i < temporary_category_.size() &&
+        temporary_category_[i] == memory_category_solver) {
+      bytes_solver += bytes;
+    } else {
+      bytes_temporary += bytes;
+    }
+  }
+  int64_t bytes_coarse = 0;
+  for (size_t i=0; i<array_coarse_.size(); i++) {
+    bytes_coarse += array_coarse_[i].capacity();
+  }
+  memory_account_.set
+    (memory_category_field_permanent,array_permanent_.capacity());
+  memory_account_.set (memory_category_field_temporary,bytes_temporary);
+  memory_account_.set (memory_category_solver,bytes_solver);
+  memory_account_.set (memory_category_field_coarse,bytes_coarse);
+}
+
+//----------------------------------------------------------------------
+
 namespace{
 
   template<class T>
@@ -1355,11 +1422,11 @@ CelloArray<T, 3> FieldData::make_view_
     bool includes_ghost;
     switch (choice){
     case ghost_choice::permit:
-      ptr = this->values(field_descr, id_field, index_history);
+      ptr = this->values_(field_descr, id_field, index_history);
       includes_ghost = this->ghosts_allocated();
       break;
     case ghost_choice::include:
-      ptr = this->values(field_descr, id_field, index_history);
+      ptr = this->values_(field_descr, id_field, index_history);
       ASSERT("FieldData::make_view_",
              ("ghost zones must be allocated when ghost_choice::include is "
               "specified and loading non-coarse data"),
@@ -1367,7 +1434,7 @@ CelloArray<T, 3> FieldData::make_view_
       includes_ghost = true;
       break;
     case ghost_choice::exclude:
-      ptr = this->unknowns(field_descr, id_field, index_history);
+      ptr = this->unknowns_(field_descr, id_field, index_history);
       includes_ghost = false;
       break;
     default:
@@ -54,7 +54,8 @@ public: // interface
   void size(int * nx, int * ny = 0, int * nz = 0) const throw();
 
   /// Return array for the corresponding field, which may or may not
-  /// contain ghosts depending on if they're allocated
+  /// contain ghosts depending on if they're allocated.  The field is
+  /// assumed to be modified, so its modification epoch is advanced
   char * values (const FieldDescr *,
 		 int id_field, int history=0) throw ();
   char * values (const FieldDescr * field_descr,
@@ -87,6 +88,7 @@ public: // interface
                         int history=0) throw()
   {
     using noconst_T = typename std::remove_cv<T>::type;
+    if (! std::is_const<T>::value && history == 0) mark_modified(id_field);
     return make_view_<noconst_T>(field_descr, id_field, choice, history, false);
   }
 
@@ -101,8 +103,9 @@ public: // interface
                               ghost_choice choice = ghost_choice::include,
                               int history=0) const throw()
   {
-    return const_cast<FieldData*>(this)->view<T>(field_descr, id_field,
-                                                 choice, history);
+    using noconst_T = typename std::remove_cv<T>::type;
+    return const_cast<FieldData*>(this)->make_view_<noconst_T>
+      (field_descr, id_field, choice, history, false);
   }
 
   template<class T>
@@ -180,6 +183,43 @@ public: // interface
 			 std::string name, int history=0) const throw ()
   { return unknowns (field_descr,field_descr->field_id(name),history); }
 
+  /// Return array for the corresponding field without advancing its
+  /// modification epoch.  Used for updates that leave the field's
+  /// active values unchanged, such as writing ghost zones
+  char * values_unmarked (const FieldDescr * field_descr,
+                          int id_field) throw ()
+  { return values_(field_descr,id_field,0); }
+
+  /// Return the modification epoch of the given field, which is
+  /// advanced whenever the field is accessed for writing, and by
+  /// Block for fields that Methods declare writing
+  int epoch (int id_field) const throw ()
+  {
+    return (0 <= id_field && id_field < int(epoch_.size())) ?
+      epoch_[id_field] : 0;
+  }
+
+  /// Advance the modification epoch of the given field
+  void mark_modified (int id_field) throw ()
+  {
+    if (id_field < 0) return;
+    if (id_field >= int(epoch_.size())) epoch_.resize(id_field+1,0);
+    ++epoch_[id_field];
+  }
+
+  /// Return the ghost epoch, which is advanced whenever ghost zones of
+  /// any field are written by a refresh
+  int ghost_epoch () const throw ()
+  { return ghost_epoch_; }
+
+  /// Advance the ghost epoch
+  void mark_ghosts_modified () throw ()
+  { ++ghost_epoch_; }
+
+  /// Return the cache of quantities derived from the fields
+  DerivedFieldCache * derived_cache () throw ()
+  { return &derived_cache_; }
+
   /// Return raw pointer to the array of all permanent fields.  Const since
   /// otherwise dangerous due to varying field sizes, precisions,
   /// padding and alignment
@@ -209,8 +249,11 @@ public: // interface
   void allocate_permanent(const FieldDescr *,
 			  bool ghosts_allocated = false) throw();
 
-  /// Allocate storage for the temporary fields
-  void allocate_temporary(const FieldDescr *, int id) throw ();
+  /// Allocate storage for the temporary fields, accounted for in the
+  /// given Memory category
+  void allocate_temporary(const FieldDescr *, int id,
+                          int category = memory_category_field_temporary)
+    throw ();
 
   /// Reallocate storage for the field data, e.g. when changing
   /// from ghosts to non-ghosts [ costly for large blocks ]
@@ -327,6 +370,16 @@ private: // functions
 	      int gx, int gy, int gz) const throw();
 
 
+  /// Return array for the corresponding field without advancing its
+  /// modification epoch
+  char * values_ (const FieldDescr *,
+                  int id_field, int history) throw ();
+
+  /// Return array excluding ghosts without advancing its modification
+  /// epoch
+  char * unknowns_ (const FieldDescr *,
+                    int id_field, int history) throw ();
+
   /// Given field size and padding, compute offset to start of the next field
   int adjust_padding_ (int size, int padding) const throw();
 
@@ -347,6 +400,9 @@ private: // functions
   /// (Re-)initialize temporary fields for history
   void set_history_ (const FieldDescr * field_descr);
 
+  /// Report bytes held by field arrays to the Memory categories
+  void update_memory_ () throw();
+
   /// Allocate (more) units_scaling_ array values
   void units_allocate_ (int n)
   {
@@ -391,6 +447,10 @@ private: // attributes
   /// Array of temporary fields
   std::vector< std::vector<char> > array_temporary_;
 
+  /// Memory category of each temporary field.  Not pup'ed: unpacked
+  /// temporary fields are accounted for as field temporaries
+  std::vector<int> temporary_category_;
+
   /// Offsets into values_ of the first element of each field
   std::vector<int> offsets_;
 
@@ -416,6 +476,19 @@ private: // attributes
   /// Coarse fields with one ghost zone for padded Prolong
   std::vector< std::vector<char> > array_coarse_;
 
+  /// Modification epoch of each field.  Not pup'ed: epochs restart
+  /// after migration, which only forces a full refresh
+  std::vector<int> epoch_;
+
+  /// Ghost zone epoch.  Not pup'ed
+  int ghost_epoch_;
+
+  /// Derived fields keyed by epochs.  Not pup'ed, like the epochs
+  DerivedFieldCache derived_cache_;
+
+  /// Bytes of field arrays reported to Memory categories
+  MemoryAccount memory_account_;
+
 };   
 
 #endif /* DATA_FIELD_DATA_HPP */
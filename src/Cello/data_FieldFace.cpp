@@ -244,7 +244,8 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
 
     precision_type precision = field.precision(index_field);
 
-    void * field_face = field.values(index_field);
+    // reading only: don't advance the field's modification epoch
+    void * field_face = field.values_unmarked(index_field);
 
     char * array_face  = &array[index_array];
 
@@ -325,6 +326,8 @@ void FieldFace::array_to_face (char * array, Field field) throw()
 {
   size_t index_array = 0;
 
+  field.mark_ghosts_modified();
+
   auto field_list_src = refresh_->field_list_src();
   auto field_list_dst = refresh_->field_list_dst();
 
@@ -336,7 +339,12 @@ void FieldFace::array_to_face (char * array, Field field) throw()
     
     precision_type precision = field.precision(index_field);
 
-    char * field_ghost = field.values(index_field);
+    const bool accumulate = refresh_->accumulate(i_f);
+
+    // only accumulating modifies active values, otherwise only ghost
+    // zones are written and the modification epoch is unchanged
+    char * field_ghost = accumulate ?
+      field.values(index_field) : field.values_unmarked(index_field);
     
     char * array_ghost  = array + index_array;
 
@@ -346,8 +354,6 @@ void FieldFace::array_to_face (char * array, Field field) throw()
     field.ghost_depth(index_field,g3,g3+1,g3+2);
     field.centering  (index_field,c3,c3+1,c3+2);
 
-    const bool accumulate = refresh_->accumulate(i_f);
-
     int i3[3], n3[3];
 
     // adjust face relative to sender
@@ -441,6 +447,8 @@ void FieldFace::face_to_face (Field field_src, Field field_dst)
 {
   auto field_list_src = refresh_->field_list_src();
   auto field_list_dst = refresh_->field_list_dst();
+
+  field_dst.mark_ghosts_modified();
   
 #ifdef CONFIG_SMP_MODE
   CmiLock(field_face_node_lock);
@@ -488,8 +496,9 @@ void FieldFace::face_to_face (Field field_src, Field field_dst)
 
     precision_type precision = field_src.precision(index_src);
     
-    char * values_src = field_src.values(index_src);
-    char * values_dst = field_dst.values(index_dst);
+    char * values_src = field_src.values_unmarked(index_src);
+    char * values_dst = accumulate ?
+      field_dst.values(index_dst) : field_dst.values_unmarked(index_dst);
 
     // scale by density if needed to convert to conservative form
     mul_by_density_(field_src,index_src,is3,ns3,m3);
@@ -867,11 +876,11 @@ void FieldFace::mul_by_density_
   if (field.is_temporary(index_field)) return;
   
   precision_type precision = field.precision(index_field);
-  void * field_face = field.values(index_field);
+  void * field_face = field.values_unmarked(index_field);
 
   Grouping * groups = cello::field_groups();
 
-  void * field_density = field.values("density");
+  void * field_density = field.values_unmarked(field.field_id("density"));
   
   const std::string field_name = field.field_name(index_field);
 
@@ -927,11 +936,11 @@ void FieldFace::div_by_density_
   if (field.is_temporary(index_field)) return;
 
   precision_type precision = field.precision(index_field);
-  void * field_face = field.values(index_field);
+  void * field_face = field.values_unmarked(index_field);
 
   Grouping * groups = cello::field_groups();
 
-  void * field_density = field.values("density");
+  void * field_density = field.values_unmarked(field.field_id("density"));
  
   const std::string field_name = field.field_name(index_field);
 
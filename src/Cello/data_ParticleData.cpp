@@ -18,7 +18,8 @@ int64_t ParticleData::id_counter[CONFIG_NODE_SIZE] = {0};
 ParticleData::ParticleData()
   : attribute_array_(),
     attribute_align_(),
-    particle_count_()
+    particle_count_(),
+    memory_account_()
 {
   ++counter[cello::index_static()];
 }
@@ -40,6 +41,8 @@ void ParticleData::pup (PUP::er &p)
   p | attribute_array_;
   p | attribute_align_;
   p | particle_count_;
+
+  if (p.isUnpacking()) update_memory_();
 }
 
 //----------------------------------------------------------------------
@@ -1074,6 +1077,8 @@ char * ParticleData::load_data (ParticleDescr * particle_descr,
     }
   }
 
+  update_memory_();
+
   ASSERT2("ParticleData::load_data()",
 	  "Buffer has size %ld but expecting size %d",
 	  (pc-buffer),data_size(particle_descr),
@@ -1183,7 +1188,10 @@ void ParticleData::resize_attribute_array_
 	    "Trying to allocate negative particles: new_size = %ld",
 	    new_size, new_size >= 0);
 
+    const int64_t capacity = attribute_array_[it][ib].capacity();
     attribute_array_[it][ib].resize(new_size);
+    memory_account_.add (memory_category_particle,
+                         attribute_array_[it][ib].capacity() - capacity);
     char * array = &attribute_array_[it][ib][0];
     uintptr_t iarray = (uintptr_t) array;
     int defect = (iarray % PARTICLE_ALIGN);
@@ -1193,6 +1201,19 @@ void ParticleData::resize_attribute_array_
 
 //----------------------------------------------------------------------
 
+void ParticleData::update_memory_() throw()
+{
+  int64_t bytes = 0;
+  for (size_t it=0; it<attribute_array_.size(); it++) {
+    for (size_t ib=0; ib<attribute_array_[it].size(); ib++) {
+      bytes += attribute_array_[it][ib].capacity();
+    }
+  }
+  memory_account_.set (memory_category_particle,bytes);
+}
+
+//----------------------------------------------------------------------
+
 void ParticleData::check_arrays_ (ParticleDescr * particle_descr,
 		    std::string file, int line) const
 {
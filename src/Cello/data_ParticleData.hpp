@@ -39,6 +39,8 @@ public: // interface
     attribute_align_ = particle_data.attribute_align_;
     particle_count_  = particle_data.particle_count_;
 
+    update_memory_();
+
     ParticleDescr * particle_descr = cello::particle_descr();
     id_counter[cello::index_static()] = num_particles(particle_descr);
   }
@@ -188,6 +190,9 @@ private: /// functions
   /// with updated attribute_align_
   void resize_attribute_array_ (ParticleDescr *, int it, int ib, int np);
 
+  /// Report bytes held by particle batches to the Memory categories
+  void update_memory_ () throw();
+
   void check_arrays_ (ParticleDescr * particle_descr,
 		      std::string file, int line) const;
 
@@ -237,6 +242,9 @@ private: /// attributes
   /// Number of particles in the batch particle_count_[it][ib];
   std::vector < std::vector < int > > particle_count_;
 
+  /// Bytes of particle batches reported to Memory categories
+  MemoryAccount memory_account_;
+
 };
 
 #endif /* DATA_PARTICLE_DATA_HPP */
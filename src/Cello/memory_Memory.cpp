@@ -13,6 +13,11 @@
 Memory Memory::instance_[CONFIG_NODE_SIZE]; // (singleton design pattern)
 #endif
 
+int64_t Memory::category_bytes_
+[CONFIG_NODE_SIZE][memory_num_categories] = {{0}};
+int64_t Memory::category_bytes_high_
+[CONFIG_NODE_SIZE][memory_num_categories] = {{0}};
+
 //======================================================================
 
 void Memory::initialize_()
@@ -316,6 +321,57 @@ void Memory::reset_high()
 #endif
 }
 
+//----------------------------------------------------------------------
+
+int64_t Memory::category_bytes_node (int category)
+{
+  const int ip0 = CkNodeFirst(CkMyNode());
+  int64_t bytes = 0;
+  for (int i=0; i<CkMyNodeSize(); i++) {
+    bytes += category_bytes_[(ip0 + i) % CONFIG_NODE_SIZE][category];
+  }
+  return bytes;
+}
+
+//----------------------------------------------------------------------
+
+int64_t Memory::category_bytes_high_sum_node (int category)
+{
+  const int ip0 = CkNodeFirst(CkMyNode());
+  int64_t bytes = 0;
+  for (int i=0; i<CkMyNodeSize(); i++) {
+    bytes += category_bytes_high_[(ip0 + i) % CONFIG_NODE_SIZE][category];
+  }
+  return bytes;
+}
+
+//----------------------------------------------------------------------
+
+void Memory::category_reset_high ()
+{
+  const int in = cello::index_static();
+  for (int ic=0; ic<memory_num_categories; ic++) {
+    category_bytes_high_[in][ic] = category_bytes_[in][ic];
+  }
+}
+
+//----------------------------------------------------------------------
+
+const char * Memory::category_name (int category)
+{
+  static const char * name[memory_num_categories] = {
+    "field-permanent",
+    "field-temporary",
+    "field-coarse",
+    "particle",
+    "message",
+    "scratch",
+    "solver"
+  };
+  return (0 <= category && category < memory_num_categories) ?
+    name[category] : "unknown";
+}
+
 //======================================================================
 
 #ifdef CONFIG_USE_MEMORY
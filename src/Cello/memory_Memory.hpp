@@ -9,6 +9,19 @@
 #ifndef MEMORY_MEMORY_HPP
 #define MEMORY_MEMORY_HPP
 
+/// Categories of long-lived storage whose bytes are always accounted
+/// for, independent of CONFIG_USE_MEMORY
+enum memory_category_type {
+  memory_category_field_permanent,  // permanent Field arrays with ghosts
+  memory_category_field_temporary,  // temporary and history Field arrays
+  memory_category_field_coarse,     // coarse arrays for ghost interpolation
+  memory_category_particle,         // Particle attribute batches
+  memory_category_message,          // received message buffers
+  memory_category_scratch,          // method scratch space
+  memory_category_solver,           // linear solver temporary Fields
+  memory_num_categories
+};
+
 class Memory {
 
   /// @class    Memory
@@ -182,6 +195,50 @@ public: // interface
 #endif
  }
 
+  //----------------------------------------------------------------------
+  // Category accounting (always active)
+  //----------------------------------------------------------------------
+
+  /// Add (or if negative remove) bytes in the given category for
+  /// this process
+  static void category_add (int category, int64_t bytes)
+  {
+    const int in = cello::index_static();
+    int64_t & curr = category_bytes_[in][category];
+    curr += bytes;
+    if (curr > category_bytes_high_[in][category]) {
+      category_bytes_high_[in][category] = curr;
+    }
+  }
+
+  /// Current bytes in the given category for this process
+  static int64_t category_bytes (int category)
+  { return category_bytes_[cello::index_static()][category]; }
+
+  /// Maximum bytes in the given category for this process since the
+  /// last call to category_reset_high()
+  static int64_t category_bytes_high (int category)
+  { return category_bytes_high_[cello::index_static()][category]; }
+
+  /// Current bytes in the given category summed over processes in
+  /// this node.  Other processes' counters are read without
+  /// synchronization, so the result is approximate while they are
+  /// allocating
+  static int64_t category_bytes_node (int category);
+
+  /// Sum over processes in this node of each process's maximum bytes
+  /// in the given category.  This is not the node high-water mark
+  /// but an upper bound on it, since processes may reach their
+  /// maxima at different times
+  static int64_t category_bytes_high_sum_node (int category);
+
+  /// Reset the high-water marks of all categories to the current
+  /// values for this process
+  static void category_reset_high ();
+
+  /// Return the name of the given category
+  static const char * category_name (int category);
+
   //======================================================================
 
 private: // functions
@@ -235,6 +292,12 @@ private: // attributes
 
 #endif
 
+  /// Current bytes in each category for each process in the node
+  static int64_t category_bytes_[CONFIG_NODE_SIZE][memory_num_categories];
+
+  /// High-water bytes in each category for each process in the node
+  static int64_t category_bytes_high_[CONFIG_NODE_SIZE][memory_num_categories];
+
   /// The current group index, or 0 if none
   int index_group_;
 
@@ -0,0 +1,73 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_MemoryAccount.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Memory] Declaration of the MemoryAccount class
+
+#ifndef MEMORY_MEMORY_ACCOUNT_HPP
+#define MEMORY_MEMORY_ACCOUNT_HPP
+
+class MemoryAccount {
+
+  /// @class    MemoryAccount
+  /// @ingroup  Memory
+  /// @brief    [\ref Memory] Bytes an object has added to Memory categories
+  ///
+  /// An object that owns storage holds a MemoryAccount and reports its
+  /// current bytes per category with set(); only the change since the
+  /// last report is added to the per-process Memory category counters,
+  /// and everything still reported is removed when the account is
+  /// destroyed.  Accounts are not copied or serialized: a copied or
+  /// unpacked owner starts with an empty account and must call set()
+  /// for the storage it holds on its new process.
+
+public: // interface
+
+  /// Create an empty account
+  MemoryAccount() throw()
+  { std::fill_n (bytes_,int(memory_num_categories),int64_t(0)); }
+
+  /// Copies start with an empty account
+  MemoryAccount(const MemoryAccount &) throw()
+  { std::fill_n (bytes_,int(memory_num_categories),int64_t(0)); }
+
+  /// Assignment leaves the account unchanged
+  MemoryAccount & operator= (const MemoryAccount &) throw()
+  { return *this; }
+
+  /// Remove all bytes reported by this account
+  ~MemoryAccount() throw()
+  { clear(); }
+
+  /// Report the current number of bytes held in the given category
+  void set (int category, int64_t bytes) throw()
+  {
+    if (bytes != bytes_[category]) {
+      Memory::category_add (category, bytes - bytes_[category]);
+      bytes_[category] = bytes;
+    }
+  }
+
+  /// Report a change in the number of bytes held in the given category
+  void add (int category, int64_t bytes) throw()
+  { set (category, bytes_[category] + bytes); }
+
+  /// Return the number of bytes reported in the given category
+  int64_t bytes (int category) const throw()
+  { return bytes_[category]; }
+
+  /// Remove all bytes reported by this account
+  void clear () throw()
+  {
+    for (int ic=0; ic<memory_num_categories; ic++) set (ic,0);
+  }
+
+private: // attributes
+
+  /// Bytes currently reported in each category
+  int64_t bytes_[memory_num_categories];
+
+};
+
+#endif /* MEMORY_MEMORY_ACCOUNT_HPP */
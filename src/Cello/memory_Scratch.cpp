@@ -0,0 +1,128 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_Scratch.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Implementation of the Scratch per-process arena
+
+#include "cello.hpp"
+
+#include "memory.hpp"
+
+/// Alignment of every allocation, in bytes
+#define SCRATCH_ALIGN 64
+
+/// Minimum size of a new chunk, in bytes
+#define SCRATCH_CHUNK_MIN (1 << 20)
+
+Scratch Scratch::instance_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+void Scratch::rewind (size_t mark) throw()
+{
+  ASSERT2 ("Scratch::rewind()",
+           "mark %lu is above the top of the arena %lu",
+           mark,top_,
+           (mark <= top_));
+
+  top_ = mark;
+  while (index_chunk_ > 0 && chunk_base_[index_chunk_] > top_) {
+    --index_chunk_;
+  }
+
+  // When the arena is empty, replace multiple chunks with a single
+  // one large enough for the high-water mark, so that steady-state
+  // use is served from one contiguous chunk
+
+  if (top_ == 0 && chunk_.size() > 1) {
+    deallocate_();
+    add_chunk_(bytes_high_);
+  }
+}
+
+//----------------------------------------------------------------------
+
+size_t Scratch::bytes_reserved() const throw()
+{
+  size_t bytes = 0;
+  for (size_t i=0; i<chunk_size_.size(); i++) bytes += chunk_size_[i];
+  return bytes;
+}
+
+//----------------------------------------------------------------------
+
+void * Scratch::allocate_bytes_ (size_t n)
+{
+  n = std::max(n,size_t(1));
+
+  if (chunk_.size() > 0) {
+    // try the current chunk, then the next one if it exists
+    for (size_t ic = index_chunk_;
+         ic < chunk_.size() && ic <= index_chunk_ + 1; ic++) {
+      const size_t base = chunk_base_[ic];
+      size_t offset = std::max(top_,base) - base;
+      offset = (offset + SCRATCH_ALIGN - 1) & ~size_t(SCRATCH_ALIGN - 1);
+      if (offset + n <= chunk_size_[ic]) {
+        index_chunk_ = ic;
+        top_ = base + offset + n;
+        bytes_high_ = std::max(bytes_high_,top_);
+        return chunk_[ic] + offset;
+      }
+    }
+  }
+
+  // otherwise discard any (unused) chunks above the current one and
+  // add a new chunk
+
+  while (chunk_.size() > index_chunk_ + 1) {
+    Memory::category_add (memory_category_scratch,-int64_t(chunk_size_.back()));
+    free (chunk_.back());
+    chunk_.pop_back();
+    chunk_size_.pop_back();
+    chunk_base_.pop_back();
+  }
+  add_chunk_(std::max(n,bytes_reserved()));
+
+  index_chunk_ = chunk_.size() - 1;
+  top_ = chunk_base_[index_chunk_] + n;
+  bytes_high_ = std::max(bytes_high_,top_);
+  return chunk_[index_chunk_];
+}
+
+//----------------------------------------------------------------------
+
+void Scratch::add_chunk_ (size_t n)
+{
+  n = std::max(n,size_t(SCRATCH_CHUNK_MIN));
+  n = (n + SCRATCH_ALIGN - 1) & ~size_t(SCRATCH_ALIGN - 1);
+
+  void * chunk = nullptr;
+  const int err = posix_memalign (&chunk, SCRATCH_ALIGN, n);
+
+  ASSERT1 ("Scratch::add_chunk_()",
+           "Failed to allocate %lu bytes",
+           n, (err == 0 && chunk != nullptr));
+
+  const size_t base = chunk_.empty() ?
+    0 : chunk_base_.back() + chunk_size_.back();
+
+  Memory::category_add (memory_category_scratch,int64_t(n));
+
+  chunk_.push_back((char *)chunk);
+  chunk_size_.push_back(n);
+  chunk_base_.push_back(base);
+}
+
+//----------------------------------------------------------------------
+
+void Scratch::deallocate_ () throw()
+{
+  Memory::category_add (memory_category_scratch,-int64_t(bytes_reserved()));
+  for (size_t i=0; i<chunk_.size(); i++) free (chunk_[i]);
+  chunk_.clear();
+  chunk_size_.clear();
+  chunk_base_.clear();
+  index_chunk_ = 0;
+  top_ = 0;
+}
@@ -0,0 +1,156 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_Scratch.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Memory] Declaration of the Scratch and ScratchFrame classes
+///
+/// Scratch is a per-process stack (bump) allocator for short-lived
+/// temporary arrays, e.g. full-Block work arrays used within a single
+/// Method::compute() call.  Memory is retained between uses, so
+/// repeated requests of similar size do not reach the system
+/// allocator.  ScratchFrame releases everything allocated through it
+/// when it goes out of scope.
+
+#ifndef MEMORY_SCRATCH_HPP
+#define MEMORY_SCRATCH_HPP
+
+class Scratch {
+
+  /// @class    Scratch
+  /// @ingroup  Memory
+  /// @brief    [\ref Memory] Per-process arena for temporary arrays
+
+public: // interface
+
+  /// Get the Scratch arena for this process
+  static Scratch * instance()
+  { return & instance_[cello::index_static()]; }
+
+  /// Create an empty arena
+  Scratch() throw()
+    : chunk_(),
+      chunk_size_(),
+      chunk_base_(),
+      index_chunk_(0),
+      top_(0),
+      bytes_high_(0)
+  { }
+
+  /// Delete the arena and all of its memory
+  ~Scratch() throw()
+  { deallocate_(); }
+
+  /// Return uninitialized storage for n values of type T, aligned to
+  /// a cache line.  Valid until rewind() to a mark at or before this
+  /// allocation
+  template <class T>
+  T * allocate (size_t n)
+  { return (T *) allocate_bytes_(n*sizeof(T)); }
+
+  /// Return storage for n values of type T initialized to zero
+  template <class T>
+  T * allocate_zero (size_t n)
+  {
+    T * values = allocate<T>(n);
+    std::fill_n (values,n,T(0));
+    return values;
+  }
+
+  /// Return the current top of the arena, for a later rewind()
+  size_t mark() const throw()
+  { return top_; }
+
+  /// Release all allocations made since the given mark
+  void rewind (size_t mark) throw();
+
+  /// Return the number of bytes currently allocated
+  size_t bytes() const throw()
+  { return top_; }
+
+  /// Return the maximum number of bytes allocated at any one time
+  size_t bytes_high() const throw()
+  { return bytes_high_; }
+
+  /// Return the number of bytes reserved from the system
+  size_t bytes_reserved() const throw();
+
+private: // functions
+
+  /// Copying the per-process arena is not allowed
+  Scratch (const Scratch &);
+  Scratch & operator = (const Scratch &);
+
+  /// Allocate n bytes from the top of the arena
+  void * allocate_bytes_ (size_t n);
+
+  /// Add a chunk of at least n bytes after the current chunk
+  void add_chunk_ (size_t n);
+
+  /// Return all chunks to the system
+  void deallocate_ () throw();
+
+private: // attributes
+
+  /// Single instance per process
+  static Scratch instance_[CONFIG_NODE_SIZE];
+
+  /// Chunks of memory, each aligned to a cache line
+  std::vector<char *> chunk_;
+
+  /// Size in bytes of each chunk
+  std::vector<size_t> chunk_size_;
+
+  /// Offset of each chunk from the bottom of the arena
+  std::vector<size_t> chunk_base_;
+
+  /// Chunk containing the top of the arena
+  size_t index_chunk_;
+
+  /// Offset of the top of the arena from its bottom
+  size_t top_;
+
+  /// Maximum value of top_
+  size_t bytes_high_;
+};
+
+//----------------------------------------------------------------------
+
+class ScratchFrame {
+
+  /// @class    ScratchFrame
+  /// @ingroup  Memory
+  /// @brief    [\ref Memory] Scoped allocations from the Scratch arena
+
+public: // interface
+
+  ScratchFrame() throw()
+    : scratch_(Scratch::instance()),
+      mark_(scratch_->mark())
+  { }
+
+  ~ScratchFrame() throw()
+  { scratch_->rewind(mark_); }
+
+  /// Return uninitialized storage for n values of type T
+  template <class T>
+  T * allocate (size_t n)
+  { return scratch_->allocate<T>(n); }
+
+  /// Return storage for n values of type T initialized to zero
+  template <class T>
+  T * allocate_zero (size_t n)
+  { return scratch_->allocate_zero<T>(n); }
+
+private: // functions
+
+  ScratchFrame (const ScratchFrame &);
+  ScratchFrame & operator = (const ScratchFrame &);
+
+private: // attributes
+
+  Scratch * scratch_;
+  size_t mark_;
+};
+
+#endif /* MEMORY_SCRATCH_HPP */
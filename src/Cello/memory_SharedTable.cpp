@@ -0,0 +1,88 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_SharedTable.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Implementation of the SharedTable class
+
+#include "cello.hpp"
+
+#include "memory.hpp"
+
+//----------------------------------------------------------------------
+
+/// Registered table and the name of its type
+struct shared_table_entry {
+  std::string type;
+  std::shared_ptr<const void> table;
+};
+
+static std::map<std::string,shared_table_entry> shared_table_map;
+
+static CmiNodeLock shared_table_node_lock;
+void mutex_init_shared_table()
+{  shared_table_node_lock = CmiCreateLock(); }
+
+//----------------------------------------------------------------------
+
+bool SharedTable::contains (const std::string & key)
+{
+  CmiLock(shared_table_node_lock);
+  const bool found = (shared_table_map.find(key) != shared_table_map.end());
+  CmiUnlock(shared_table_node_lock);
+  return found;
+}
+
+//----------------------------------------------------------------------
+
+int SharedTable::num_tables ()
+{
+  CmiLock(shared_table_node_lock);
+  const int n = shared_table_map.size();
+  CmiUnlock(shared_table_node_lock);
+  return n;
+}
+
+//----------------------------------------------------------------------
+
+void SharedTable::clear ()
+{
+  CmiLock(shared_table_node_lock);
+  shared_table_map.clear();
+  CmiUnlock(shared_table_node_lock);
+}
+
+//======================================================================
+
+std::shared_ptr<const void> SharedTable::get_
+(const std::string & key, const char * type,
+ std::function<std::shared_ptr<const void> ()> create)
+{
+  // hold the lock while creating, so that other PEs requesting the
+  // same key wait for the table rather than loading it again
+
+  CmiLock(shared_table_node_lock);
+
+  auto it = shared_table_map.find(key);
+  if (it == shared_table_map.end()) {
+    shared_table_entry entry;
+    entry.type  = type;
+    entry.table = create();
+    it = shared_table_map.emplace(key,entry).first;
+  }
+  const shared_table_entry & entry = it->second;
+
+  ASSERT3 ("SharedTable::get_",
+           "Table \"%s\" requested as type %s but created as type %s",
+           key.c_str(),type,entry.type.c_str(),
+           entry.type == type);
+  ASSERT1 ("SharedTable::get_",
+           "Table \"%s\" could not be created",
+           key.c_str(), entry.table != nullptr);
+
+  std::shared_ptr<const void> table = entry.table;
+
+  CmiUnlock(shared_table_node_lock);
+
+  return table;
+}
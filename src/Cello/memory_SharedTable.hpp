@@ -0,0 +1,60 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_SharedTable.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Memory] Declaration of the SharedTable class
+
+#ifndef MEMORY_SHARED_TABLE_HPP
+#define MEMORY_SHARED_TABLE_HPP
+
+class SharedTable {
+
+  /// @class    SharedTable
+  /// @ingroup  Memory
+  /// @brief    [\ref Memory] Read-only tables shared by all PEs in a process
+  ///
+  /// Large read-only data such as lookup tables are created once per
+  /// process, by the first PE to request a given key, and later
+  /// requests for the key return the same table.  In SMP builds all
+  /// PEs on a node share a process, so each table is loaded once per
+  /// node rather than once per PE.  Owners should keep only the key
+  /// and the returned pointer, and request the table again after
+  /// unpacking rather than pup'ing its contents.
+
+public: // interface
+
+  /// Return the table with the given key, calling create() to
+  /// allocate it if it does not yet exist in this process
+  template <class T>
+  static std::shared_ptr<const T> get
+  (const std::string & key, std::function<T * ()> create)
+  {
+    std::shared_ptr<const void> table = get_
+      (key, typeid(T).name(),
+       [&create]() { return std::shared_ptr<const void>
+           (std::shared_ptr<const T>(create())); });
+    return std::static_pointer_cast<const T>(table);
+  }
+
+  /// Return whether a table with the given key exists in this process
+  static bool contains (const std::string & key);
+
+  /// Return the number of tables in this process
+  static int num_tables ();
+
+  /// Remove all tables from the registry.  Tables are deallocated
+  /// once no owners hold them
+  static void clear ();
+
+private: // functions
+
+  /// Return the table with the given key and type name, creating it
+  /// if needed
+  static std::shared_ptr<const void> get_
+  (const std::string & key, const char * type,
+   std::function<std::shared_ptr<const void> ()> create);
+
+};
+
+#endif /* MEMORY_SHARED_TABLE_HPP */
@@ -31,6 +31,7 @@
 extern void mutex_init_hierarchy();
 extern void mutex_init_initial_value();
 extern void mutex_init_field_face();
+extern void mutex_init_shared_table();
 //----------------------------------------------------------------------
 
 #endif /* MESH_HPP */
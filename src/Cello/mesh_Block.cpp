@@ -68,6 +68,11 @@ Block::Block ( process_type ip_source, MsgType msg_type )
     ip_next_(-1),
     name_(""),
     index_method_(-1),
+    index_refresh_prefetch_(-1),
+    refresh_copy_faces_(false),
+    method_time_start_(0),
+    method_time_interior_(0),
+    method_time_(0),
     index_solver_(),
     refresh_()
 {
@@ -81,6 +86,7 @@ Block::Block ( process_type ip_source, MsgType msg_type )
 
   init_refresh_();
   usesAtSync = true;
+  usesAutoMeasure = (cello::config()->balance_cost != "method");
 
   thisIndex.array(array_,array_+1,array_+2);
 
@@ -156,6 +162,11 @@ Block::Block ( MsgRefine * msg )
     ip_next_(-1),
     name_(""),
     index_method_(-1),
+    index_refresh_prefetch_(-1),
+    refresh_copy_faces_(false),
+    method_time_start_(0),
+    method_time_interior_(0),
+    method_time_(0),
     index_solver_(),
     refresh_()
 {
@@ -169,6 +180,7 @@ Block::Block ( MsgRefine * msg )
 
   init_refresh_();
   usesAtSync = true;
+  usesAutoMeasure = (cello::config()->balance_cost != "method");
 
   thisIndex.array(array_,array_+1,array_+2);
 #ifdef TRACE_BLOCK
@@ -395,6 +407,11 @@ void Block::pup(PUP::er &p)
   p | ip_next_;
   p | name_;
   p | index_method_;
+  // SKIP index_refresh_prefetch_: no refresh in progress when migrating
+  // SKIP refresh_copy_faces_: only set while sending
+  // SKIP method_time_start_: not timing when migrating
+  // SKIP method_time_interior_: not timing when migrating
+  p | method_time_;
   p | index_solver_;
   p | refresh_;
   // SKIP method_: initialized when needed
@@ -404,6 +421,9 @@ void Block::pup(PUP::er &p)
     if (simulation != NULL) simulation->data_insert_block(this);
   }
   p | refresh_sync_list_;
+  // SKIP refresh_epoch_sent_: field epochs restart when migrating
+  p | field_write_count_;
+  p | refresh_write_count_sent_;
 
   int len=refresh_msg_list_.size();
   p | len;
@@ -727,6 +747,11 @@ Block::Block ()
     ip_next_(-1),
     name_(""),
     index_method_(-1),
+    index_refresh_prefetch_(-1),
+    refresh_copy_faces_(false),
+    method_time_start_(0),
+    method_time_interior_(0),
+    method_time_(0),
     index_solver_(),
     refresh_()
 {
@@ -833,6 +858,17 @@ std::string Block::name() const throw()
 
 //----------------------------------------------------------------------
 
+Random Block::random (const std::string & stream) const throw()
+{
+  const MortonKey key = index_.morton_key();
+  const uint64_t position =
+    Random::mix64(key.hi ^ Random::mix64(key.lo ^ Random::mix64(cycle_)));
+  return Random (cello::config()->method_random_seed,
+                 Random::stream(stream), position);
+}
+
+//----------------------------------------------------------------------
+
 std::string Block::name(Index index) const throw()
 {
   int blocking[3] = {1,1,1};
@@ -138,6 +138,11 @@ public: // interface
   const Index & index() const
   { return index_; }
 
+  /// Return a counter-based random number generator for the given
+  /// stream (e.g. Method name), keyed by the global seed and this
+  /// Block's Index and cycle
+  Random random (const std::string & stream) const throw();
+
   int face_level (const int if3[3]) const
   { return adapt_.face_level(if3,Adapt::LevelType::curr); }
 
@@ -344,10 +349,16 @@ protected: // methods
   void compute_begin_();
   /// Initiate computing the next Method in the sequence
   void compute_next_();
+  /// Update interior cells of the current Method while its refresh
+  /// is in progress
+  void compute_interior_();
   /// Return after performing any Refresh operations
   void compute_continue_();
   /// Cleanup after all Methods have been applied
   void compute_end_();
+  /// Record the time spent in the current Method's compute(), if
+  /// not already recorded
+  void compute_record_time_();
   /// Exit control compute phase
   void compute_exit_();
 
@@ -547,6 +558,11 @@ public:
   /// Begin a refresh operation, optionally waiting then invoking callback
   void refresh_start (int id_refresh, int callback);
 
+  /// Send face data for a refresh operation without waiting for
+  /// neighbor data, returning whether the refresh is active.  Must be
+  /// followed by refresh_wait() if active, or refresh_exit() if not
+  bool refresh_send (int id_refresh);
+
   /// Wait for a refresh operation to complete, then continue with the callback
   void refresh_wait (int id_refresh, int callback);
 
@@ -570,7 +586,44 @@ public:
   int refresh_load_flux_faces_ (Refresh & refresh);
 
   void refresh_load_field_face_
-  (Refresh & refresh, int refresh_type, Index index, int if3[3], int ic3[3]);
+  (Refresh & refresh, int refresh_type, Index index, int if3[3], int ic3[3],
+   const std::vector<int> * epoch = nullptr);
+
+  /// Return the current modification epochs of the Refresh's fields
+  /// if unchanged fields may be skipped, else an empty vector.
+  /// Temporary fields have epoch -1 so are always sent
+  std::vector<int> refresh_field_epochs_ (Refresh & refresh);
+
+  /// Remove fields from the FieldFace whose epochs are unchanged
+  /// since last sent to the same-level neighbor.  Returns nullptr if
+  /// no fields remain
+  FieldFace * refresh_skip_unchanged_
+  (Refresh & refresh, FieldFace * field_face,
+   Index index_neighbor, const int if3[3],
+   const std::vector<int> & epoch);
+
+  /// Return whether no Method has declared writing any field of the
+  /// Method post-refresh since it was last exchanged with the
+  /// same-level neighbor.  The neighbor decides the same for the
+  /// opposite face, so neither sends nor expects a message
+  bool refresh_face_unchanged_
+  (Refresh & refresh, Index index_neighbor, const int if3[3]);
+
+  /// Return the key identifying a same-level neighbor face, with the
+  /// ghost depth since refreshes with different depths update
+  /// different ghost zones
+  std::pair<Index,int> refresh_face_key_
+  (Refresh & refresh, Index index_neighbor, const int if3[3]) const
+  {
+    const int face = (if3[0]+1) + 3*((if3[1]+1) + 3*(if3[2]+1));
+    return std::make_pair(index_neighbor, face + 27*refresh.ghost_depth());
+  }
+
+  /// Count the fields the current Method declares that it writes, or
+  /// all fields if it does not declare them, and advance their
+  /// modification epochs
+  void refresh_count_writes_ ();
+
   /// Send particles in list to corresponding indices
   void particle_send_(Refresh & refresh, int nl,Index index_list[],
                       ParticleData * particle_list[]);
@@ -591,6 +644,11 @@ public:
   void p_method_order_morton_weight(int ic3[3], int weight, Index index);
   void p_method_order_morton_index(int index, int count);
 
+  void r_method_order_sfc(CkReductionMsg * msg);
+  void p_method_order_sfc_gather(Index index);
+  void p_method_order_sfc_index
+  (long long index, long long count, Index index_next);
+
   void p_method_output_next (MsgOutput * msg);
   void p_method_output_write (MsgOutput * msg);
   void r_method_output_continue(CkReductionMsg * msg);
@@ -760,6 +818,26 @@ protected:
   void performance_stop_
   (int index_region, std::string file="", int line=0);
 
+  /// Record the beginning, end, or occurrence of an event of this
+  /// Block, such as a control phase, in the timeline event Tracer
+  void trace_begin_ (const char * name) const
+  { Tracer * t = Tracer::instance(); if (t->is_active()) t->begin(name,trace_id_()); }
+  void trace_end_ (const char * name) const
+  { Tracer * t = Tracer::instance(); if (t->is_active()) t->end(name,trace_id_()); }
+  void trace_instant_ (const char * name) const
+  { Tracer * t = Tracer::instance(); if (t->is_active()) t->instant(name,trace_id_()); }
+
+  /// Return an identifier for this Block in timeline events
+  long long trace_id_ () const
+  {
+    int v3[3];
+    index_.values(v3);
+    unsigned long long id = (unsigned)v3[0];
+    id = id*0x9E3779B97F4A7C15ULL + (unsigned)v3[1];
+    id = id*0x9E3779B97F4A7C15ULL + (unsigned)v3[2];
+    return (long long)(id);
+  }
+
   //--------------------------------------------------
   // TESTING
   //--------------------------------------------------
@@ -805,6 +883,10 @@ public: // virtual functions
 
   void ResumeFromSync();
 
+  /// Set the Charm++ load balancing load to the time spent in Method
+  /// compute() since the last load balance (Balance:cost = "method")
+  virtual void UserSetLBLoad();
+
   FieldFace * create_face
   (int if3[3], int ic3[3], int g3[3],
    int refresh_type,
@@ -1006,6 +1088,28 @@ protected: // attributes
   /// Index of currently-active Method
   int index_method_;
 
+  /// Index of the Method whose post-refresh face data were sent
+  /// before it was reached, or -1 if none
+  int index_refresh_prefetch_;
+
+  /// Whether refresh messages being created should copy their field
+  /// face values, rather than reference the Block's fields when the
+  /// neighbor is local.  Set while sending a prefetched refresh, since
+  /// this Block's fields may change before a local neighbor applies it
+  bool refresh_copy_faces_;
+
+  /// Start time in nanoseconds of the current Method's compute(), or
+  /// 0 if not being timed
+  long long method_time_start_;
+
+  /// Time in nanoseconds spent in the current Method's
+  /// compute_interior(), added to the time of its compute()
+  long long method_time_interior_;
+
+  /// Time in nanoseconds spent in Method compute() since the last
+  /// load balance
+  long long method_time_;
+
   /// Stack of currently active solvers
   std::vector<int> index_solver_;
 
@@ -1016,6 +1120,19 @@ protected: // attributes
   std::vector < Sync > refresh_sync_list_;
   std::vector < std::vector <MsgRefresh * > > refresh_msg_list_;
 
+  /// Field epochs last sent to each same-level neighbor face, used
+  /// for Field:refresh_skip_unchanged.  Not pup'ed: cleared after
+  /// migration or mesh adaptation, which only forces a full refresh
+  std::map < std::pair<Index,int>, std::vector<int> > refresh_epoch_sent_;
+
+  /// Number of Methods applied that declared writing each field
+  std::vector<int> field_write_count_;
+
+  /// Field write counts when last exchanged with each same-level
+  /// neighbor face.  Pup'ed, since the neighbor keeps its own copy
+  /// and both must agree on which faces are skipped
+  std::map < std::pair<Index,int>, std::vector<int> > refresh_write_count_sent_;
+
 };
 
 #endif /* COMM_BLOCK_HPP */
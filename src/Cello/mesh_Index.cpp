@@ -8,10 +8,44 @@
 
 #include "mesh.hpp"
 
+#ifdef __BMI2__
+#  include <immintrin.h>
+#endif
+
 // #define DEBUG_INDEX
 
 //----------------------------------------------------------------------
 
+namespace {
+
+  // Morton codes are computed with pdep/pext instructions if BMI2 is
+  // available, otherwise with the constexpr bit-spreading functions
+
+  const uint64_t morton_mask = 0x1249249249249249ull;
+
+  inline uint64_t morton_interleave_ (uint64_t x, uint64_t y, uint64_t z)
+  {
+#ifdef __BMI2__
+    return _pdep_u64(x,morton_mask)
+      |    _pdep_u64(y,morton_mask << 1)
+      |    _pdep_u64(z,morton_mask << 2);
+#else
+    return Index::morton_interleave(x,y,z);
+#endif
+  }
+
+  inline uint64_t morton_deinterleave_ (uint64_t m, int axis)
+  {
+#ifdef __BMI2__
+    return _pext_u64(m,morton_mask << axis);
+#else
+    return Index::morton_deinterleave(m,axis);
+#endif
+  }
+}
+
+//----------------------------------------------------------------------
+
 Index::Index() { clear(); }
 //----------------------------------------------------------------------
 
@@ -166,8 +200,78 @@ bool Index::is_on_boundary
 
 bool Index::is_in_same_subtree (Index index, int min_level, int root_level)
 {
-  return (index.index_ancestor (root_level,min_level)
-	  ==    index_ancestor (root_level,min_level));
+  ASSERT3 ("Index::is_in_same_subtree",
+	   "root level %d must be between min_level %d and levels %d",
+	   root_level,min_level,std::min(level(),index.level()),
+	   (min_level <= root_level &&
+	    root_level <= std::min(level(),index.level())));
+
+  // same ancestor in root_level iff Morton keys agree down to root_level
+  return (index.morton_key().prefix(root_level)
+	  ==    morton_key().prefix(root_level));
+}
+
+//----------------------------------------------------------------------
+
+bool Index::is_ancestor (Index index) const
+{
+  const int level = index.level();
+  return (level < this->level()) &&
+    (morton_key().prefix(level) == index.morton_key().prefix(level));
+}
+
+//----------------------------------------------------------------------
+
+MortonKey Index::morton_key() const
+{
+  // combine array and tree bits into one coordinate per axis,
+  // ignoring any bits finer than the Index level
+
+  const int level = this->level();
+  const uint32_t mask = ~((uint32_t(1) << (INDEX_BITS_TREE - level)) - 1);
+  uint64_t c3[3];
+  for (int axis=0; axis<3; axis++) {
+    c3[axis] = ((a_[axis].array << INDEX_BITS_TREE) | a_[axis].tree) & mask;
+  }
+
+  // interleave lower 21 bits and upper 9 bits separately
+
+  const uint64_t mask_lo = (uint64_t(1) << 21) - 1;
+  const uint64_t m_lo = morton_interleave_
+    (c3[0] & mask_lo, c3[1] & mask_lo, c3[2] & mask_lo);
+  const uint64_t m_hi = morton_interleave_
+    (c3[0] >> 21, c3[1] >> 21, c3[2] >> 21);
+
+  // key = (m_hi << 63 | m_lo) << INDEX_MORTON_BITS_LEVEL | level
+
+  MortonKey key;
+  key.hi = (m_hi << (INDEX_MORTON_BITS_LEVEL - 1))
+    |      (m_lo >> (64 - INDEX_MORTON_BITS_LEVEL));
+  key.lo = (m_lo << INDEX_MORTON_BITS_LEVEL)
+    |      uint64_t(level + INDEX_MORTON_LEVEL_OFFSET);
+  return key;
+}
+
+//----------------------------------------------------------------------
+
+void Index::set_morton_key (MortonKey key)
+{
+  const uint64_t mask_level = (uint64_t(1) << INDEX_MORTON_BITS_LEVEL) - 1;
+  const int level = int(key.lo & mask_level) - INDEX_MORTON_LEVEL_OFFSET;
+
+  const uint64_t m_lo = ((key.lo >> INDEX_MORTON_BITS_LEVEL)
+                         | (key.hi << (64 - INDEX_MORTON_BITS_LEVEL)))
+    & ((uint64_t(1) << 63) - 1);
+  const uint64_t m_hi = key.hi >> (INDEX_MORTON_BITS_LEVEL - 1);
+
+  const uint32_t mask_tree = (uint32_t(1) << INDEX_BITS_TREE) - 1;
+  for (int axis=0; axis<3; axis++) {
+    const uint64_t c = morton_deinterleave_(m_lo,axis)
+      |               (morton_deinterleave_(m_hi,axis) << 21);
+    a_[axis].array = c >> INDEX_BITS_TREE;
+    a_[axis].tree  = c & mask_tree;
+  }
+  set_level(level);
 }
 
 //----------------------------------------------------------------------
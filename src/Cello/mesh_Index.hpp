@@ -10,6 +10,55 @@
 #define INDEX_BITS_LEVEL   2
 
 #define INDEX_UNDEFINED_LEVEL -999
+
+// Morton key layout: 3 x (INDEX_BITS_ARRAY + INDEX_BITS_TREE) = 90
+// interleaved coordinate bits followed by INDEX_MORTON_BITS_LEVEL
+// bits of level (offset by INDEX_MORTON_LEVEL_OFFSET) = 96 bits
+
+#define INDEX_MORTON_BITS_LEVEL    6
+#define INDEX_MORTON_LEVEL_OFFSET 32
+
+//----------------------------------------------------------------------
+
+struct MortonKey {
+
+  /// @class    MortonKey
+  /// @ingroup  Mesh
+  /// @brief    [\ref Mesh] 128-bit Morton (Z-order) key of an Index
+  ///
+  /// Keys of Blocks compare in space-filling curve order, with
+  /// ancestors ordered before their descendants
+
+  uint64_t hi;
+  uint64_t lo;
+
+  bool operator == (const MortonKey & key) const
+  { return hi == key.hi && lo == key.lo; }
+
+  bool operator != (const MortonKey & key) const
+  { return ! (*this == key); }
+
+  bool operator < (const MortonKey & key) const
+  { return (hi < key.hi) || (hi == key.hi && lo < key.lo); }
+
+  /// Return the key with coordinate bits finer than the given level
+  /// and the level bits cleared
+  MortonKey prefix (int level) const
+  {
+    const int n = 3*(INDEX_BITS_TREE - level) + INDEX_MORTON_BITS_LEVEL;
+    MortonKey key = *this;
+    if (n >= 64) {
+      key.lo = 0;
+      key.hi &= ~((uint64_t(1) << (n - 64)) - 1);
+    } else {
+      key.lo &= ~((uint64_t(1) << n) - 1);
+    }
+    return key;
+  }
+};
+
+//----------------------------------------------------------------------
+
 class NodeBits {
 
   // original order ATL crashed in Charm++ during load balancing
@@ -115,6 +164,13 @@ public:
       (index_parent() == index.index_parent().index_parent()) : false;
   }
 
+  /// Whether given `index` is a proper ancestor of this Index
+  bool is_ancestor (Index index) const;
+
+  /// Whether given `index` is a proper descendant of this Index
+  bool is_descendant (Index index) const
+  { return index.is_ancestor(*this); }
+
   /// Return the dimensionality of shared face (0 corner, 1 edge, 2
   /// plane), or -1 if disjoint
   int adjacency (Index index, int rank, const int p3[3]) const;
@@ -141,6 +197,28 @@ public:
   }
 
 
+  /// Return the Morton key of the Index
+  MortonKey morton_key() const;
+
+  /// Set the Index from the given Morton key
+  void set_morton_key (MortonKey key);
+
+  /// Comparison function for sorting Indices in Morton order
+  static bool morton_less (const Index & x, const Index & y)
+  { return x.morton_key() < y.morton_key(); }
+
+  /// Interleave the lower 21 bits of x, y, and z into a 63-bit
+  /// Morton code, with x in the lowest bit
+  static constexpr uint64_t morton_interleave
+  (uint64_t x, uint64_t y, uint64_t z)
+  { return morton_spread_(x) | (morton_spread_(y) << 1)
+      | (morton_spread_(z) << 2); }
+
+  /// Extract the 21-bit coordinate along the given axis from a
+  /// 63-bit Morton code
+  static constexpr uint64_t morton_deinterleave (uint64_t m, int axis)
+  { return morton_compact_(m >> axis); }
+
   /// Set the level for this node
   void set_level(int level);
 
@@ -226,6 +304,40 @@ private: // methods
   void clean_ ();
 
   int num_bits_(int value) const;
+
+  /// Spread the lower 21 bits of x to every third bit
+  static constexpr uint64_t morton_spread_ (uint64_t x)
+  { return morton_spread_step_
+      (morton_spread_step_
+       (morton_spread_step_
+        (morton_spread_step_
+         (morton_spread_step_
+          (x & 0x1fffffull, 32, 0x1f00000000ffffull),
+          16, 0x1f0000ff0000ffull),
+         8, 0x100f00f00f00f00full),
+        4, 0x10c30c30c30c30c3ull),
+       2, 0x1249249249249249ull); }
+
+  /// Gather every third bit of x into the lower 21 bits
+  static constexpr uint64_t morton_compact_ (uint64_t x)
+  { return morton_compact_step_
+      (morton_compact_step_
+       (morton_compact_step_
+        (morton_compact_step_
+         (morton_compact_step_
+          (x & 0x1249249249249249ull, 2, 0x10c30c30c30c30c3ull),
+          4, 0x100f00f00f00f00full),
+         8, 0x1f0000ff0000ffull),
+        16, 0x1f00000000ffffull),
+       32, 0x1fffffull); }
+
+  static constexpr uint64_t morton_spread_step_
+  (uint64_t x, int shift, uint64_t mask)
+  { return (x | (x << shift)) & mask; }
+
+  static constexpr uint64_t morton_compact_step_
+  (uint64_t x, int shift, uint64_t mask)
+  { return (x ^ (x >> shift)) & mask; }
 	
   void print_ (FILE * fp,
 	       const char * msg,
@@ -46,6 +46,7 @@ void Config::pup (PUP::er &p)
 
   p | balance_schedule_index;
   p | balance_type;
+  p | balance_cost;
 
   // Boundary
 
@@ -75,6 +76,7 @@ void Config::pup (PUP::er &p)
   p | field_prolong;
   p | field_restrict;
   p | field_group_list;
+  p | field_refresh_skip_unchanged;
 
   // Initial
 
@@ -113,6 +115,8 @@ void Config::pup (PUP::er &p)
 
   p | num_method;
   p | method_courant_global;
+  p | method_random_seed;
+  p | method_prefetch_refresh;
   p | method_list;
   p | method_schedule_index;
   p | method_file_name;
@@ -209,10 +213,18 @@ void Config::pup (PUP::er &p)
   // Performance
 
   p | performance_papi_counters;
+  p | performance_papi_roofline_counters;
+  p | performance_papi_roofline_line_bytes;
+  p | performance_papi_roofline_peak_gflops;
+  p | performance_papi_roofline_peak_gbytes;
   p | performance_projections_on_at_start;
   p | performance_warnings;
+  p | performance_histograms;
   p | performance_on_schedule_index;
   p | performance_off_schedule_index;
+  p | performance_trace_schedule_index;
+  p | performance_trace_capacity;
+  p | performance_trace_file;
 
   // Physics
   
@@ -396,6 +408,13 @@ void Config::read_balance_ (Parameters * p) throw()
            ((balance_type == "charm") ||
             (balance_type == "cello")));
 
+  balance_cost = p->value_string ("Balance:cost","measured");
+  ASSERT1 ("Config::read_balance_",
+          "Unknown Balance:cost parameter %s; valid are \"measured\" or \"method\"",
+           balance_cost.c_str(),
+           ((balance_cost == "measured") ||
+            (balance_cost == "method")));
+
   const bool balance_scheduled = 
     (p->type("Balance:schedule:var") != parameter_unknown);
 
@@ -641,6 +660,9 @@ void Config::read_field_ (Parameters * p) throw()
 
   field_prolong   = p->value_string ("Field:prolong","enzo");
   field_restrict  = p->value_string ("Field:restrict","linear");
+
+  field_refresh_skip_unchanged =
+    p->value_logical ("Field:refresh_skip_unchanged",false);
 }
 
 //----------------------------------------------------------------------
@@ -822,6 +844,10 @@ void Config::read_method_ (Parameters * p) throw()
   method_type.resize(num_method);
   
   method_courant_global = p->value_float ("Method:courant",1.0);
+
+  method_random_seed = p->value_integer ("Method:random_seed",0);
+
+  method_prefetch_refresh = p->value_logical ("Method:prefetch_refresh",false);
   
   for (int index_method=0; index_method<num_method; index_method++) {
 
@@ -1443,10 +1469,51 @@ void Config::read_performance_ (Parameters * p) throw()
 	     i,performance_papi_counters[i].c_str());
     }
   }
+
+  // Per-Method roofline counters: floating-point operations, last-level
+  // cache misses (as a proxy for bytes moved), and cycles
+
+  performance_papi_roofline_counters.clear();
+  if (p->type("Performance:papi:roofline:counters") == parameter_list) {
+    const int length = p->list_length("Performance:papi:roofline:counters");
+    ASSERT1("Config::read_performance_()",
+            "Performance:papi:roofline:counters has length %d but must "
+            "have length 3 (flops, cache misses, cycles)",
+            length, (length == 3));
+    for (int i=0; i<length; i++) {
+      performance_papi_roofline_counters.push_back
+        (p->list_value_string(i,"Performance:papi:roofline:counters",""));
+    }
+  } else if (p->value_logical("Performance:papi:roofline:enable",false)) {
+    performance_papi_roofline_counters =
+      { "PAPI_FP_OPS", "PAPI_L3_TCM", "PAPI_TOT_CYC" };
+  }
+  performance_papi_roofline_line_bytes =
+    p->value_integer("Performance:papi:roofline:line_bytes",64);
+  performance_papi_roofline_peak_gflops =
+    p->value_float("Performance:papi:roofline:peak_gflops",0.0);
+  performance_papi_roofline_peak_gbytes =
+    p->value_float("Performance:papi:roofline:peak_gbytes",0.0);
 #endif  
 
   performance_warnings = p->value_logical("Performance:warnings",false);
 
+  performance_histograms = p->value_logical("Performance:histograms",false);
+
+  // Timeline event tracing
+
+  if (p->type("Performance:trace:schedule:var") != parameter_unknown) {
+    p->group_set(0,"Performance");
+    p->group_push("trace");
+    p->group_push("schedule");
+    performance_trace_schedule_index = read_schedule_(p,"trace");
+    p->group_clear();
+  }
+  performance_trace_capacity = p->value_integer
+    ("Performance:trace:capacity",100000);
+  performance_trace_file = p->value_string
+    ("Performance:trace:file","trace-%06d-%04d.json");
+
 #ifdef CONFIG_USE_PROJECTIONS
   
   int i_on = -1;
@@ -40,6 +40,7 @@ public: // interface
     adapt_schedule_index(),
     balance_schedule_index(0),
     balance_type(),
+    balance_cost(),
     num_boundary(0),
     boundary_list(),
     boundary_type(),
@@ -56,6 +57,7 @@ public: // interface
     field_prolong(""),
     field_restrict(""),
     field_group_list(),
+    field_refresh_skip_unchanged(false),
     num_initial(0),
     initial_new(false),
     initial_list(),
@@ -78,6 +80,8 @@ public: // interface
     mesh_max_initial_level(0),
     num_method(0),
     method_courant_global(1.0),
+    method_random_seed(0),
+    method_prefetch_refresh(false),
     method_list(),
     method_schedule_index(),
     method_file_name(),
@@ -158,10 +162,18 @@ public: // interface
     particle_batch_size(0),
     particle_group_list(),
     performance_papi_counters(),
+    performance_papi_roofline_counters(),
+    performance_papi_roofline_line_bytes(64),
+    performance_papi_roofline_peak_gflops(0.0),
+    performance_papi_roofline_peak_gbytes(0.0),
     performance_projections_on_at_start(true),
     performance_warnings(false),
+    performance_histograms(false),
     performance_on_schedule_index(-1),
     performance_off_schedule_index(-1),
+    performance_trace_schedule_index(-1),
+    performance_trace_capacity(0),
+    performance_trace_file(),
     num_physics(0),
     physics_list(),
     num_solvers(),
@@ -216,6 +228,7 @@ public: // interface
       adapt_schedule_index(),
       balance_schedule_index(-1),
       balance_type(),
+      balance_cost(),
       num_boundary(0),
       boundary_list(),
       boundary_type(),
@@ -232,6 +245,7 @@ public: // interface
       field_prolong(""),
       field_restrict(""),
       field_group_list(),
+      field_refresh_skip_unchanged(false),
       num_initial(0),
       initial_new(false),
       initial_list(),
@@ -254,6 +268,8 @@ public: // interface
       mesh_max_initial_level(0),
       num_method(0),
       method_courant_global(1.0),
+      method_random_seed(0),
+      method_prefetch_refresh(false),
       method_list(),
       method_schedule_index(),
       method_file_name(),
@@ -333,10 +349,18 @@ public: // interface
       particle_batch_size(0),
       particle_group_list(),
       performance_papi_counters(),
+      performance_papi_roofline_counters(),
+      performance_papi_roofline_line_bytes(64),
+      performance_papi_roofline_peak_gflops(0.0),
+      performance_papi_roofline_peak_gbytes(0.0),
       performance_projections_on_at_start(true),
       performance_warnings(false),
+      performance_histograms(false),
       performance_on_schedule_index(-1),
       performance_off_schedule_index(-1),
+      performance_trace_schedule_index(-1),
+      performance_trace_capacity(0),
+      performance_trace_file(),
       num_physics(0),
       physics_list(),
       num_solvers(),
@@ -409,6 +433,7 @@ public: // attributes
 
   int                        balance_schedule_index;
   std::string                balance_type;
+  std::string                balance_cost;
 
   // Boundary
 
@@ -439,6 +464,7 @@ public: // attributes
   std::string                field_prolong;
   std::string                field_restrict;
   std::vector< std::vector<std::string> >  field_group_list;
+  bool                       field_refresh_skip_unchanged;
 
   // Initial
 
@@ -479,6 +505,8 @@ public: // attributes
 
   int                        num_method;
   double                     method_courant_global;
+  int                        method_random_seed;
+  bool                       method_prefetch_refresh;
   std::vector<std::string>   method_list;
 
   std::vector<int>           method_schedule_index;
@@ -584,10 +612,18 @@ public: // attributes
   // Performance
 
   std::vector<std::string>   performance_papi_counters;
+  std::vector<std::string>   performance_papi_roofline_counters;
+  int                        performance_papi_roofline_line_bytes;
+  double                     performance_papi_roofline_peak_gflops;
+  double                     performance_papi_roofline_peak_gbytes;
   bool                       performance_projections_on_at_start;
   bool                       performance_warnings;
+  bool                       performance_histograms;
   int                        performance_on_schedule_index;
   int                        performance_off_schedule_index;
+  int                        performance_trace_schedule_index;
+  int                        performance_trace_capacity;
+  std::string                performance_trace_file;
 
   // Physics
   
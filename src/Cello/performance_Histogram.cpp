@@ -0,0 +1,76 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_Histogram.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Implementation of the Histogram class
+
+#include "cello.hpp"
+
+#include "performance.hpp"
+
+//----------------------------------------------------------------------
+
+long long Histogram::count () const throw()
+{
+  long long count = 0;
+  for (int i=0; i<num_bins; i++) count += counts_[i];
+  return count;
+}
+
+//----------------------------------------------------------------------
+
+double Histogram::percentile (double p) const throw()
+{
+  const long long n = count();
+  if (n == 0) return 0.0;
+
+  // rank of the percentile among the counted values, 1 <= rank <= n
+  const long long rank =
+    std::max(1LL,std::min(n,(long long)(std::ceil(0.01*p*n))));
+
+  long long sum = 0;
+  for (int i=0; i<num_bins; i++) {
+    sum += counts_[i];
+    if (sum >= rank) {
+      // midpoint of the bin
+      if (i == 0) return 0.0;
+      const long long lower = bin_lower(i);
+      const long long upper = (i+1 < num_bins) ? bin_lower(i+1) : lower;
+      return 0.5*(lower + upper);
+    }
+  }
+  return double(bin_lower(num_bins-1));
+}
+
+//----------------------------------------------------------------------
+
+int Histogram::bin (long long value) throw()
+{
+  if (value <= 0) return 0;
+
+  // octave is the position of the leading bit, and the sub-bin is
+  // given by the following log2(bins_per_octave) bits
+
+  int octave = 0;
+  for (unsigned long long v = value; v > 1; v >>= 1) ++octave;
+
+  const int shift = octave - 2;
+  const int sub = (shift >= 0) ?
+    (int)((value >> shift) & 3) : (int)((value << (-shift)) & 3);
+
+  const int bin = 1 + bins_per_octave*octave + sub;
+  return std::min(bin, int(num_bins) - 1);
+}
+
+//----------------------------------------------------------------------
+
+long long Histogram::bin_lower (int bin) throw()
+{
+  if (bin <= 0) return 0;
+  const int octave = (bin - 1) / bins_per_octave;
+  const int sub    = (bin - 1) % bins_per_octave;
+  // smallest integer with the given leading bits (bins narrower than
+  // one in the lowest octaves are empty)
+  return (((4LL + sub) << octave) + 3) >> 2;
+}
@@ -0,0 +1,86 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_Histogram.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Performance] Declaration of the Histogram class
+
+#ifndef PERFORMANCE_HISTOGRAM_HPP
+#define PERFORMANCE_HISTOGRAM_HPP
+
+class Histogram {
+
+  /// @class    Histogram
+  /// @ingroup  Performance
+  /// @brief    [\ref Performance] Log-scaled histogram of non-negative values
+  ///
+  /// Values are counted in bins_per_octave bins per power of two, so
+  /// that percentiles are accurate to within about 10% over a range
+  /// of num_octaves powers of two.  Bin boundaries are fixed, so
+  /// histograms from different processes are merged by adding their
+  /// counts, e.g. in a sum reduction.
+
+public: // constants
+
+  enum {
+    bins_per_octave = 4,
+    num_octaves = 48,
+    num_bins = 1 + bins_per_octave*num_octaves
+  };
+
+public: // interface
+
+  /// Create an empty Histogram
+  Histogram() throw()
+    : counts_(num_bins,0)
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    // NOTE: change this function whenever attributes change
+    p | counts_;
+  }
+
+  /// Count the given value
+  void insert (long long value) throw()
+  { ++counts_[bin(value)]; }
+
+  /// Add the counts of another histogram
+  void merge (const Histogram & histogram) throw()
+  {
+    for (int i=0; i<num_bins; i++) counts_[i] += histogram.counts_[i];
+  }
+
+  /// Remove all counts
+  void clear () throw()
+  { std::fill(counts_.begin(),counts_.end(),0); }
+
+  /// Return the number of values counted
+  long long count () const throw();
+
+  /// Return an estimate of the given percentile (0 <= p <= 100) of
+  /// the values counted, or 0 if none
+  double percentile (double p) const throw();
+
+  /// Return the array of bin counts, e.g. for packing in a reduction
+  long long * counts () throw()
+  { return counts_.data(); }
+  const long long * counts () const throw()
+  { return counts_.data(); }
+
+  /// Return the bin of the given value
+  static int bin (long long value) throw();
+
+  /// Return the smallest value in the given bin
+  static long long bin_lower (int bin) throw();
+
+private: // attributes
+
+  /// Number of values in each bin
+  std::vector<long long> counts_;
+
+};
+
+#endif /* PERFORMANCE_HISTOGRAM_HPP */
@@ -33,7 +33,12 @@ Performance::Performance (Config * config)
   papi_counters_(0),
 #endif
   warnings_(config ? config->performance_warnings : false),
-  index_region_current_(perf_unknown)
+  index_region_current_(perf_unknown),
+  histograms_(config ? config->performance_histograms : false),
+  method_histograms_(),
+  method_events_(),
+  method_counters_start_(),
+  method_counters_()
 {
 
   const int in = cello::index_static();
@@ -343,3 +348,63 @@ Performance::region_counters(int index_region, long long * counters) throw()
 
 //======================================================================
 
+void Performance::set_method_counters
+(const std::vector<std::string> & events) throw()
+{
+  method_events_.clear();
+#ifdef CONFIG_USE_PAPI
+  for (size_t k=0; k<events.size(); k++) {
+    // reuse the event if it is already counted
+    int index = -1;
+    for (int i=0; i<papi_.num_events(); i++) {
+      if (papi_.event_name(i) == events[k]) index = i;
+    }
+    if (index == -1) {
+      const int num_events = papi_.num_events();
+      new_counter(counter_type_papi,events[k]);
+      if (papi_.num_events() > num_events) index = num_events;
+    }
+    if (index == -1) {
+      WARNING1 ("Performance::set_method_counters()",
+                "PAPI event %s is not available: "
+                "not measuring per-Method counters",
+                events[k].c_str());
+      method_events_.clear();
+      break;
+    }
+    method_events_.push_back(index);
+  }
+#endif
+  method_counters_start_.assign(method_events_.size(),0);
+}
+
+//----------------------------------------------------------------------
+
+void Performance::start_method_counters() throw()
+{
+#ifdef CONFIG_USE_PAPI
+  if (method_events_.empty()) return;
+  papi_.event_values(papi_counters_);
+  for (size_t k=0; k<method_events_.size(); k++) {
+    method_counters_start_[k] = papi_counters_[method_events_[k]];
+  }
+#endif
+}
+
+//----------------------------------------------------------------------
+
+void Performance::stop_method_counters
+(int index_method, long long time) throw()
+{
+#ifdef CONFIG_USE_PAPI
+  if (method_events_.empty()) return;
+  papi_.event_values(papi_counters_);
+  std::vector<long long> & counters = method_counters_vector_(index_method);
+  const size_t n = method_events_.size();
+  for (size_t k=0; k<n; k++) {
+    counters[k] +=
+      papi_counters_[method_events_[k]] - method_counters_start_[k];
+  }
+  counters[n] += time;
+#endif
+}
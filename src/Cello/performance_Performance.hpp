@@ -91,7 +91,12 @@ public: // interface
      papi_counters_(0),
 #endif
      warnings_(false),
-     index_region_current_(perf_unknown)
+     index_region_current_(perf_unknown),
+     histograms_(false),
+     method_histograms_(),
+     method_events_(),
+     method_counters_start_(),
+     method_counters_()
   {};
 
   /// Initialize a Performance object
@@ -125,6 +130,11 @@ public: // interface
 #endif    
     p | warnings_;
     p | index_region_current_;
+    p | histograms_;
+    p | method_histograms_;
+    p | method_events_;
+    p | method_counters_start_;
+    p | method_counters_;
   }
 
   /// Begin collecting performance data
@@ -198,6 +208,63 @@ public: // interface
   Papi * papi() { return &papi_; };
 #endif  
 
+  /// Return the current time in nanoseconds from a steady clock
+  static long long time_nsec () throw()
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>
+      (std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  /// Return whether per-Method time histograms are recorded
+  bool histograms() const throw()
+  { return histograms_; }
+
+  /// Record the time in nanoseconds of one Method compute() call
+  void record_method_time (int index_method, long long time) throw()
+  {
+    if (index_method >= int(method_histograms_.size()))
+      method_histograms_.resize(index_method+1);
+    method_histograms_[index_method].insert(time);
+  }
+
+  /// Return the number of Method time histograms
+  int num_method_histograms() const throw()
+  { return method_histograms_.size(); }
+
+  /// Return the time histogram of the given Method
+  Histogram & method_histogram (int index_method) throw()
+  {
+    if (index_method >= int(method_histograms_.size()))
+      method_histograms_.resize(index_method+1);
+    return method_histograms_[index_method];
+  }
+
+  /// Clear all Method time histograms
+  void clear_method_histograms() throw()
+  {
+    for (auto & histogram : method_histograms_) histogram.clear();
+  }
+
+  /// Measure the given PAPI events separately for each Method, adding
+  /// them as PAPI counters if needed.  Must be called before begin()
+  void set_method_counters (const std::vector<std::string> & events) throw();
+
+  /// Return the number of PAPI events measured per Method (0 if none)
+  int num_method_counters() const throw()
+  { return method_events_.size(); }
+
+  /// Read the per-Method PAPI events at the start of a Method compute()
+  void start_method_counters() throw();
+
+  /// Add the per-Method PAPI events since start_method_counters(), and
+  /// the given time in nanoseconds, to the totals of the given Method
+  void stop_method_counters (int index_method, long long time) throw();
+
+  /// Return the totals of the given Method: num_method_counters()
+  /// event counts followed by the time in nanoseconds
+  const long long * method_counters (int index_method) throw()
+  { return method_counters_vector_(index_method).data(); }
+
 private: // functions
 
   /// Refresh the array of current counter values
@@ -205,11 +272,15 @@ private: // functions
 
   /// Return the current time in usec
   long long time_real_ () const
+  { return time_nsec() / 1000; }
+
+  /// Return the per-Method event totals of the given Method
+  std::vector<long long> & method_counters_vector_ (int index_method) throw()
   {
-    struct timeval tv;
-    struct timezone tz;
-    gettimeofday (&tv,&tz);
-    return (long long )(1000000) * tv.tv_sec + tv.tv_usec;
+    if (index_method >= int(method_counters_.size()))
+      method_counters_.resize(index_method+1);
+    method_counters_[index_method].resize(method_events_.size()+1,0);
+    return method_counters_[index_method];
   }
 
   //==================================================
@@ -258,6 +329,22 @@ private: // attributes
 
   /// Last region index started
   int index_region_current_;
+
+  /// Whether to record per-Method time histograms
+  bool histograms_;
+
+  /// Histograms of Method compute() times in nanoseconds, one sample
+  /// per Block per call
+  std::vector<Histogram> method_histograms_;
+
+  /// Indices of the per-Method events in the Papi event set
+  std::vector<int> method_events_;
+
+  /// Per-Method event values at the start of the current compute()
+  std::vector<long long> method_counters_start_;
+
+  /// Per-Method event totals followed by time in nanoseconds
+  std::vector< std::vector<long long> > method_counters_;
 };
 
 #endif /* PERFORMANCE_PERFORMANCE_HPP */
@@ -0,0 +1,66 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_Tracer.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Implementation of the Tracer class
+
+#include "cello.hpp"
+
+#include "performance.hpp"
+
+//----------------------------------------------------------------------
+
+Tracer Tracer::instance_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+void Tracer::initialize (int capacity) throw()
+{
+  ASSERT1 ("Tracer::initialize()",
+           "Trace capacity %d must be non-negative",
+           capacity, (capacity >= 0));
+  events_.resize(capacity);
+  num_recorded_ = 0;
+}
+
+//----------------------------------------------------------------------
+
+const char * Tracer::intern (const std::string & name)
+{
+  return names_.insert(name).first->c_str();
+}
+
+//----------------------------------------------------------------------
+
+void Tracer::write (FILE * fp, int node, int process) const throw()
+{
+  fprintf (fp,"{\"traceEvents\":[\n");
+  fprintf (fp,"{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+           "\"args\":{\"name\":\"node %d\"}},\n",node,node);
+  fprintf (fp,"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,"
+           "\"args\":{\"name\":\"process %d\"}}",node,process,process);
+
+  // oldest event first
+
+  const long long size = events_.size();
+  const int n = num_events();
+  const long long i0 = num_recorded_ - n;
+  for (long long i=i0; i<i0+n; i++) {
+    const Event & event = events_[i % size];
+    fprintf (fp,",\n{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,"
+             "\"pid\":%d,\"tid\":%d",
+             event.name, event.phase, 1e-3*event.time, node, process);
+    if (event.phase == 'X') {
+      fprintf (fp,",\"dur\":%.3f,\"args\":{\"id\":\"0x%llx\"}}",
+               1e-3*event.duration, event.id);
+    } else if (event.phase == 'i') {
+      fprintf (fp,",\"s\":\"t\",\"args\":{\"id\":\"0x%llx\"}}",event.id);
+    } else {
+      // asynchronous events are matched by category and id
+      fprintf (fp,",\"cat\":\"block\",\"id\":\"0x%llx\"}",event.id);
+    }
+  }
+  fprintf (fp,"\n],\n\"displayTimeUnit\":\"ns\",");
+  fprintf (fp,"\"otherData\":{\"dropped\":\"%lld\"}}\n",num_dropped());
+}
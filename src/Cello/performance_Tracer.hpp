@@ -0,0 +1,132 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_Tracer.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Performance] Declaration of the Tracer class
+
+#ifndef PERFORMANCE_TRACER_HPP
+#define PERFORMANCE_TRACER_HPP
+
+class Tracer {
+
+  /// @class    Tracer
+  /// @ingroup  Performance
+  /// @brief    [\ref Performance] Ring buffer of timeline events
+  ///
+  /// Records time-stamped events such as the beginning and end of
+  /// Block control phases, Method compute() calls, and refresh
+  /// messages in a fixed-size ring buffer for each process, keeping
+  /// the most recent events if the buffer fills.  Recording an event
+  /// is a few stores when tracing is enabled and a single test when
+  /// it is not.  Events are written in the Chrome trace event JSON
+  /// format, which can be viewed in chrome://tracing or Perfetto.
+  /// Event names must be string literals or returned by intern(),
+  /// since only their pointers are stored.
+
+public: // interface
+
+  /// Create a disabled Tracer
+  Tracer() throw()
+    : events_(),
+      num_recorded_(0),
+      names_()
+  { }
+
+  /// Return the Tracer for this process
+  static Tracer * instance()
+  { return & instance_[cello::index_static()]; }
+
+  /// Enable tracing with the given number of events, or disable
+  /// tracing if capacity is 0
+  void initialize (int capacity) throw();
+
+  /// Return whether events are being recorded
+  bool is_active() const throw()
+  { return ! events_.empty(); }
+
+  /// Record the beginning of an asynchronous event, such as a
+  /// control phase of the Block with the given id
+  void begin (const char * name, long long id) throw()
+  { if (is_active()) record_('b',name,id,Performance::time_nsec(),0); }
+
+  /// Record the end of an asynchronous event
+  void end (const char * name, long long id) throw()
+  { if (is_active()) record_('e',name,id,Performance::time_nsec(),0); }
+
+  /// Record an instantaneous event
+  void instant (const char * name, long long id) throw()
+  { if (is_active()) record_('i',name,id,Performance::time_nsec(),0); }
+
+  /// Record an event with the given start time and duration in
+  /// nanoseconds
+  void complete (const char * name, long long id,
+                 long long time_start, long long duration) throw()
+  { if (is_active()) record_('X',name,id,time_start,duration); }
+
+  /// Return a persistent copy of the given name for use as an event
+  /// name
+  const char * intern (const std::string & name);
+
+  /// Return the number of events held in the buffer
+  int num_events() const throw()
+  { return std::min(num_recorded_,(long long)(events_.size())); }
+
+  /// Return the number of events overwritten since the last clear()
+  long long num_dropped() const throw()
+  { return num_recorded_ - num_events(); }
+
+  /// Discard all events
+  void clear() throw()
+  { num_recorded_ = 0; }
+
+  /// Write events in Chrome trace event JSON format, using node and
+  /// process as the trace's pid and tid
+  void write (FILE * fp, int node, int process) const throw();
+
+private: // classes
+
+  struct Event {
+    /// Start time in nanoseconds
+    long long time;
+    /// Duration in nanoseconds for complete events
+    long long duration;
+    /// Identifier, e.g. of the Block
+    long long id;
+    /// Event name
+    const char * name;
+    /// Chrome trace event phase: 'b', 'e', 'i', or 'X'
+    char phase;
+  };
+
+private: // functions
+
+  void record_ (char phase, const char * name, long long id,
+                long long time, long long duration) throw()
+  {
+    Event & event = events_[num_recorded_ % events_.size()];
+    event.time     = time;
+    event.duration = duration;
+    event.id       = id;
+    event.name     = name;
+    event.phase    = phase;
+    ++num_recorded_;
+  }
+
+private: // attributes
+
+  /// Single instance per process
+  static Tracer instance_[CONFIG_NODE_SIZE];
+
+  /// Ring buffer of events
+  std::vector<Event> events_;
+
+  /// Number of events recorded since the last clear()
+  long long num_recorded_;
+
+  /// Interned event names
+  std::set<std::string> names_;
+
+};
+
+#endif /* PERFORMANCE_TRACER_HPP */
@@ -71,4 +71,31 @@ void Method::set_schedule (Schedule * schedule) throw()
   schedule_ = schedule;
 }
 
+//----------------------------------------------------------------------
+
+void Method::interior_range_
+(Block * block, int id_field, int stencil, int il3[3], int ih3[3])
+  const throw()
+{
+  Field field = block->data()->field();
+
+  int m3[3], g3[3];
+  field.dimensions  (id_field,m3,m3+1,m3+2);
+  field.ghost_depth (id_field,g3,g3+1,g3+2);
+
+  for (int axis=0; axis<3; axis++) {
+    if (m3[axis] == 1) {
+      il3[axis] = 0;
+      ih3[axis] = 1;
+    } else {
+      // exclude cells whose stencil includes ghost zones, and cells
+      // that may be read for face data sent to neighbors, which
+      // includes 2g active cells for restriction to coarser neighbors
+      const int d = g3[axis] + std::max(stencil,2*g3[axis]);
+      il3[axis] = d;
+      ih3[axis] = std::max(d,m3[axis] - d);
+    }
+  }
+}
+
 //======================================================================
@@ -19,6 +19,14 @@ class Method : public PUP::able
 
 public: // interface
 
+  /// Fields and particle types read and written by a Method
+  struct Access {
+    std::vector<std::string> field_read;
+    std::vector<std::string> field_write;
+    std::vector<std::string> particle_read;
+    std::vector<std::string> particle_write;
+  };
+
   /// Create a new Method
   Method (double courant = 1.0) throw();
 
@@ -73,6 +81,39 @@ public: // virtual functions
     /* This function intentionally empty */
   }
 
+  /// Add the fields and particle types this Method reads and writes
+  ///
+  /// Returns false if they are not known, in which case the Method is
+  /// assumed to read and write all data.  Written data include any
+  /// ghost zones updated by the Method, including by refreshes other
+  /// than its post-refresh, and particles it creates, deletes, or
+  /// moves between Blocks.  Used by MethodGraph to find Methods that
+  /// do not depend on each other.
+  virtual bool data_access (Access & access) const throw()
+  { return false; }
+
+  /// Whether to call compute_interior() while the post-refresh is in
+  /// progress
+  ///
+  /// Methods that return true have `compute_interior()` called after
+  /// their post-refresh face data are sent but before ghost zones are
+  /// received, then `compute()` called once the refresh is complete.
+  /// This only applies to Methods without a Schedule.
+  virtual bool overlap_refresh () const throw()
+  { return false; }
+
+  /// Update the cells that do not depend on ghost zone values
+  ///
+  /// Called only if `overlap_refresh()` returns true.  Ghost zones
+  /// have not been refreshed and face data may still be read by
+  /// neighbors, so only cells in `interior_range_()` may be updated
+  /// here; the following `compute()` must update the remaining cells
+  /// and invoke `Block::compute_done()` as usual.
+  virtual void compute_interior ( Block * block) throw()
+  {
+    /* This function intentionally empty */
+  }
+
   /// Add a new refresh object
   int add_refresh_ (int neighbor_type = neighbor_leaf);
 
@@ -94,6 +135,11 @@ public: // virtual functions
 
 protected: // functions
 
+  /// Return the range [il3,ih3) of cells of the given field that may be
+  /// updated in compute_interior() by a stencil of the given half-width
+  void interior_range_ (Block * block, int id_field, int stencil,
+                        int il3[3], int ih3[3]) const throw();
+
   /// Perform vector copy X <- Y
   template <class T>
   void copy_ (T * X, const T * Y,
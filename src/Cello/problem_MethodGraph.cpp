@@ -0,0 +1,209 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     problem_MethodGraph.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Implementation of the MethodGraph class
+
+#include "problem.hpp"
+
+//----------------------------------------------------------------------
+
+/// Sort and remove duplicates from a list of ids
+static void sort_ids_ (std::vector<int> & ids)
+{
+  std::sort (ids.begin(),ids.end());
+  ids.erase (std::unique(ids.begin(),ids.end()),ids.end());
+}
+
+/// Return whether the sorted lists have any element in common
+static bool intersect_ (const std::vector<int> & a,
+                        const std::vector<int> & b)
+{
+  size_t i=0, j=0;
+  while (i < a.size() && j < b.size()) {
+    if      (a[i] < b[j]) ++i;
+    else if (b[j] < a[i]) ++j;
+    else return true;
+  }
+  return false;
+}
+
+/// Return the union of two sorted lists
+static std::vector<int> union_ (const std::vector<int> & a,
+                                const std::vector<int> & b)
+{
+  std::vector<int> c;
+  std::set_union (a.begin(),a.end(),b.begin(),b.end(),
+                  std::back_inserter(c));
+  return c;
+}
+
+//----------------------------------------------------------------------
+
+void MethodGraph::initialize (Problem * problem, bool prefetch_refresh) throw()
+{
+  const FieldDescr    * field_descr    = cello::field_descr();
+  const ParticleDescr * particle_descr = cello::particle_descr();
+
+  const int n = num_methods_ = problem->num_methods();
+
+  is_known_.assign       (n,0);
+  field_read_.assign     (n,std::vector<int>());
+  field_write_.assign    (n,std::vector<int>());
+  particle_read_.assign  (n,std::vector<int>());
+  particle_write_.assign (n,std::vector<int>());
+  refresh_field_src_.assign (n,std::vector<int>());
+  refresh_field_dst_.assign (n,std::vector<int>());
+  refresh_particle_.assign  (n,std::vector<int>());
+  refresh_id_.assign        (n,-1);
+
+  for (int im=0; im<n; im++) {
+
+    Method * method = problem->method(im);
+
+    // data declared by the Method
+
+    Method::Access access;
+    is_known_[im] = method->data_access(access);
+
+    for (const std::string & name : access.field_read) {
+      const int id = field_descr->field_id(name);
+      if (id >= 0) field_read_[im].push_back(id);
+    }
+    for (const std::string & name : access.field_write) {
+      const int id = field_descr->field_id(name);
+      if (id >= 0) field_write_[im].push_back(id);
+    }
+    for (const std::string & name : access.particle_read) {
+      const int it = particle_descr->type_index(name);
+      if (it >= 0) particle_read_[im].push_back(it);
+    }
+    for (const std::string & name : access.particle_write) {
+      const int it = particle_descr->type_index(name);
+      if (it >= 0) particle_write_[im].push_back(it);
+    }
+
+    // data in the Method's post-refresh
+
+    refresh_id_[im] = method->refresh_id_post();
+    Refresh * refresh = cello::refresh(refresh_id_[im]);
+
+    refresh_field_src_[im] = refresh->field_list_src();
+    refresh_field_dst_[im] = refresh->field_list_dst();
+    if (refresh->all_particles()) {
+      for (int it=0; it<particle_descr->num_types(); it++) {
+        refresh_particle_[im].push_back(it);
+      }
+    } else {
+      refresh_particle_[im] = refresh->particle_list();
+    }
+
+    sort_ids_ (field_read_[im]);
+    sort_ids_ (field_write_[im]);
+    sort_ids_ (particle_read_[im]);
+    sort_ids_ (particle_write_[im]);
+    sort_ids_ (refresh_field_src_[im]);
+    sort_ids_ (refresh_field_dst_[im]);
+    sort_ids_ (refresh_particle_[im]);
+  }
+
+  depends_.assign (n*n,0);
+  for (int i=0; i<n; i++) {
+    for (int j=0; j<i; j++) {
+      depends_[i*n + j] = depends_on_(i,j);
+    }
+  }
+
+  prefetch_refresh_.assign (n,0);
+  if (prefetch_refresh) {
+    for (int i=1; i<n; i++) {
+      prefetch_refresh_[i] = can_prefetch_(problem,i);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void MethodGraph::print (Problem * problem) const throw()
+{
+  Monitor * monitor = cello::monitor();
+
+  for (int i=0; i<num_methods_; i++) {
+
+    std::string depends;
+    for (int j=0; j<i; j++) {
+      if (depends_[i*num_methods_ + j]) {
+        depends += " " + problem->method(j)->name();
+      }
+    }
+    if (depends == "") depends = " none";
+
+    monitor->print ("Method","graph %s data %s prefetch-refresh %s depends-on%s",
+                    problem->method(i)->name().c_str(),
+                    is_known_[i] ? "declared" : "unknown",
+                    prefetch_refresh_[i] ? "yes" : "no",
+                    depends.c_str());
+  }
+}
+
+//======================================================================
+
+bool MethodGraph::depends_on_ (int i, int j) const throw()
+{
+  if (! (is_known_[i] && is_known_[j])) return true;
+
+  // a refresh reads its source fields and writes ghost zones of its
+  // destination fields, and may move particles in and out of Blocks
+
+  const std::vector<int> fr_i = union_(field_read_[i],refresh_field_src_[i]);
+  const std::vector<int> fw_i = union_(field_write_[i],refresh_field_dst_[i]);
+  const std::vector<int> fr_j = union_(field_read_[j],refresh_field_src_[j]);
+  const std::vector<int> fw_j = union_(field_write_[j],refresh_field_dst_[j]);
+
+  const std::vector<int> pr_i = union_(particle_read_[i],refresh_particle_[i]);
+  const std::vector<int> pw_i = union_(particle_write_[i],refresh_particle_[i]);
+  const std::vector<int> pr_j = union_(particle_read_[j],refresh_particle_[j]);
+  const std::vector<int> pw_j = union_(particle_write_[j],refresh_particle_[j]);
+
+  return
+    intersect_(fw_j,fr_i) || intersect_(fw_j,fw_i) || intersect_(fr_j,fw_i) ||
+    intersect_(pw_j,pr_i) || intersect_(pw_j,pw_i) || intersect_(pr_j,pw_i);
+}
+
+//----------------------------------------------------------------------
+
+bool MethodGraph::can_prefetch_ (Problem * problem, int i) const throw()
+{
+  // The post-refresh of Method i is sent after the post-refresh of
+  // Method i-1 has completed, just before Method i-1 computes, and
+  // messages received are not applied until Method i would have
+  // refreshed; so it sends the same data as long as Method i-1 does
+  // not write its source fields, and particles it moves are not used
+  // by Method i-1.  Face values are copied when sent (see
+  // Block::refresh_copy_faces_), since otherwise a local neighbor
+  // still in Method i-1 would read them after this Block may have
+  // completed the refresh and computed Method i
+
+  const int j = i - 1;
+
+  if (! is_known_[j]) return false;
+
+  const int ir_i = problem->method(i)->refresh_id_post();
+  const int ir_j = problem->method(j)->refresh_id_post();
+
+  if (ir_i == ir_j) return false;
+
+  Refresh * refresh = cello::refresh(ir_i);
+
+  // nothing to gain if no data, and flux data are not declared
+
+  if (! refresh->any_data() || refresh->any_fluxes()) return false;
+
+  const std::vector<int> particle_j =
+    union_(particle_read_[j],particle_write_[j]);
+
+  return
+    ! intersect_(field_write_[j],refresh_field_src_[i]) &&
+    ! intersect_(particle_j,refresh_particle_[i]);
+}
@@ -0,0 +1,131 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     problem_MethodGraph.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Problem] Declaration of the MethodGraph class
+
+#ifndef PROBLEM_METHOD_GRAPH_HPP
+#define PROBLEM_METHOD_GRAPH_HPP
+
+class Problem;
+
+class MethodGraph {
+
+  /// @class    MethodGraph
+  /// @ingroup  Problem
+  /// @brief    [\ref Problem] Data dependencies between Methods
+  ///
+  /// Built from the data each Method declares in
+  /// Method::data_access(), together with the fields and particle
+  /// types of its post-refresh.  A Method depends on an earlier
+  /// Method if either writes data the other reads or writes, or if
+  /// either does not declare its data.
+  ///
+  /// Methods are still applied in order, but the post-refresh of a
+  /// Method that does not depend on the previous Method may be sent
+  /// before the previous Method computes, so that its messages are in
+  /// transit while it does.
+
+public: // interface
+
+  /// Create an empty MethodGraph
+  MethodGraph() throw()
+    : num_methods_(0),
+      is_known_(),
+      field_read_(),
+      field_write_(),
+      particle_read_(),
+      particle_write_(),
+      refresh_field_src_(),
+      refresh_field_dst_(),
+      refresh_particle_(),
+      refresh_id_(),
+      depends_(),
+      prefetch_refresh_()
+  { }
+
+  /// Build the graph for the Methods in the Problem
+  void initialize (Problem * problem, bool prefetch_refresh) throw();
+
+  /// Return the number of Methods in the graph
+  int num_methods () const throw()
+  { return num_methods_; }
+
+  /// Return whether Method index_method declares the data it accesses
+  bool is_known (int index_method) const throw()
+  { return is_known_.at(index_method); }
+
+  /// Return the sorted ids of fields Method index_method declares
+  /// that it writes
+  const std::vector<int> & field_write (int index_method) const throw()
+  { return field_write_.at(index_method); }
+
+  /// Return whether the given Refresh is the post-refresh of a Method
+  bool is_method_refresh (int id_refresh) const throw()
+  {
+    return std::find (refresh_id_.begin(),refresh_id_.end(),id_refresh)
+      != refresh_id_.end();
+  }
+
+  /// Return whether Method index_method depends on the earlier
+  /// Method index_before
+  bool depends (int index_method, int index_before) const throw()
+  { return depends_.at(index_method*num_methods_ + index_before); }
+
+  /// Return whether the post-refresh of Method index_method may be
+  /// sent before the previous Method computes
+  bool prefetch_refresh (int index_method) const throw()
+  {
+    return (0 <= index_method && index_method < num_methods_) &&
+      prefetch_refresh_[index_method];
+  }
+
+  /// Print the dependencies of each Method to the Monitor
+  void print (Problem * problem) const throw();
+
+private: // functions
+
+  /// Return whether Method i depends on the earlier Method j
+  bool depends_on_ (int i, int j) const throw();
+
+  /// Return whether the post-refresh of Method i may be sent before
+  /// Method i-1 computes
+  bool can_prefetch_ (Problem * problem, int i) const throw();
+
+private: // attributes
+
+  /// Number of Methods, including the initial MethodNull
+  int num_methods_;
+
+  /// Whether each Method declares the data it accesses
+  std::vector<char> is_known_;
+
+  /// Sorted field ids declared read and written by each Method
+  std::vector< std::vector<int> > field_read_;
+  std::vector< std::vector<int> > field_write_;
+
+  /// Sorted particle type ids declared read and written by each Method
+  std::vector< std::vector<int> > particle_read_;
+  std::vector< std::vector<int> > particle_write_;
+
+  /// Sorted source and destination field ids, and particle type ids,
+  /// of each Method's post-refresh
+  std::vector< std::vector<int> > refresh_field_src_;
+  std::vector< std::vector<int> > refresh_field_dst_;
+  std::vector< std::vector<int> > refresh_particle_;
+
+  /// Id of each Method's post-refresh
+  std::vector<int> refresh_id_;
+
+  /// Whether Method i depends on Method j, indexed by
+  /// i*num_methods_ + j
+  std::vector<char> depends_;
+
+  /// Whether each Method's post-refresh may be sent before the
+  /// previous Method computes
+  std::vector<char> prefetch_refresh_;
+
+};
+
+#endif /* PROBLEM_METHOD_GRAPH_HPP */
@@ -54,6 +54,10 @@ public: // virtual methods
   virtual std::string name () throw () 
   { return "null"; }
 
+  /// No data are read or written
+  virtual bool data_access (Access & access) const throw()
+  { return true; }
+
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw()
   { return dt_; }
@@ -0,0 +1,210 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     problem_MethodOrderSfc.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Implementation of the MethodOrderSfc class
+
+#include "problem.hpp"
+
+//----------------------------------------------------------------------
+
+MethodOrderSfc::MethodOrderSfc() throw ()
+  : Method(),
+    is_index_(-1),
+    is_count_(-1),
+    is_next_(-1),
+    histogram_(),
+    bins_()
+{
+  cello::simulation()->refresh_set_name(ir_post_,name());
+
+  /// Create Scalar data for ordering index
+  is_index_ = cello::scalar_descr_long_long()->new_value(name() + ":index");
+  is_count_ = cello::scalar_descr_long_long()->new_value(name() + ":count");
+  is_next_  = cello::scalar_descr_index()->new_value(name() + ":next");
+}
+
+//======================================================================
+
+void MethodOrderSfc::compute (Block * block) throw()
+{
+  if (histogram_.num_bins() == 0) initialize_histogram_();
+
+  // count Blocks in each bin along the Morton curve: the sum is
+  // returned to all Blocks, so each Block knows the offset of its bin
+
+  std::vector<int> counts (histogram_.num_bins(), 0);
+  counts[histogram_.bin(block->index())] = 1;
+
+  CkCallback callback (CkIndex_Block::r_method_order_sfc(nullptr),
+                       block->proxy_array());
+
+  block->contribute (counts.size()*sizeof(int), counts.data(),
+                     CkReduction::sum_int, callback);
+}
+
+//----------------------------------------------------------------------
+
+void Block::r_method_order_sfc(CkReductionMsg * msg)
+{
+  static_cast<MethodOrderSfc*>
+    (this->method())->compute_order(this,msg);
+}
+
+//----------------------------------------------------------------------
+
+void MethodOrderSfc::compute_order (Block * block, CkReductionMsg * msg)
+{
+  if (histogram_.num_bins() == 0) initialize_histogram_();
+
+  const int * counts = (const int *) msg->getData();
+
+  const Index index = block->index();
+  const int bin = histogram_.bin(index);
+
+  long long offset, count;
+  int bin_next;
+  histogram_.locate (counts, bin, &offset, &count, &bin_next);
+  const int count_bin = counts[bin];
+
+  delete msg;
+
+  // Blocks send their Index to the first Block of their bin, which
+  // orders them
+
+  const Index index_collector = histogram_.collector(bin);
+
+  if (index == index_collector) {
+    Bin & bin_blocks = bins_[index];
+    bin_blocks.count      = count_bin;
+    bin_blocks.offset     = offset;
+    bin_blocks.total      = count;
+    bin_blocks.index_next = histogram_.collector(bin_next);
+    bin_blocks.keys.push_back(index.morton_key());
+    compute_bin_(index);
+  } else {
+    cello::block_array()[index_collector].p_method_order_sfc_gather(index);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::p_method_order_sfc_gather (Index index)
+{
+  static_cast<MethodOrderSfc*>
+    (this->method())->compute_gather(this,index);
+}
+
+//----------------------------------------------------------------------
+
+void MethodOrderSfc::compute_gather (Block * block, Index index)
+{
+  // may arrive before this Block has received the histogram
+
+  const Index index_collector = block->index();
+  bins_[index_collector].keys.push_back(index.morton_key());
+  compute_bin_(index_collector);
+}
+
+//----------------------------------------------------------------------
+
+void MethodOrderSfc::compute_bin_ (Index index_collector)
+{
+  auto it = bins_.find(index_collector);
+  const Bin & bin_blocks = it->second;
+
+  if (bin_blocks.count < 0 ||
+      int(bin_blocks.keys.size()) < bin_blocks.count) return;
+
+  const int count = bin_blocks.keys.size();
+
+  std::vector<Index> index_list;
+  order (count, bin_blocks.keys.data(), index_list);
+
+  for (int i=0; i<count; i++) {
+    const Index index_next =
+      (i + 1 < count) ? index_list[i + 1] : bin_blocks.index_next;
+    cello::block_array()[index_list[i]].p_method_order_sfc_index
+      (bin_blocks.offset + i, bin_blocks.total, index_next);
+  }
+
+  bins_.erase(it);
+}
+
+//----------------------------------------------------------------------
+
+void MethodOrderSfc::order
+(int count, const MortonKey * keys, std::vector<Index> & index_list)
+{
+  std::vector<MortonKey> keys_sorted (keys, keys + count);
+  std::sort(keys_sorted.begin(), keys_sorted.end());
+
+  index_list.resize(count);
+  for (int i=0; i<count; i++) {
+    index_list[i].set_morton_key(keys_sorted[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::p_method_order_sfc_index
+(long long index, long long count, Index index_next)
+{
+  static_cast<MethodOrderSfc*>
+    (this->method())->compute_complete(this,index,count,index_next);
+}
+
+//----------------------------------------------------------------------
+
+void MethodOrderSfc::compute_complete
+(Block * block, long long index, long long count, Index index_next)
+{
+  ASSERT2 ("MethodOrderSfc::compute_complete()",
+           "Block index %lld out of range [0,%lld)",
+           index, count,
+           (0 <= index && index < count));
+
+  *pindex_(block) = index;
+  *pcount_(block) = count;
+  *pnext_(block)  = index_next;
+
+  block->compute_done();
+}
+
+//======================================================================
+
+void MethodOrderSfc::initialize_histogram_ ()
+{
+  const Config * config = cello::config();
+  histogram_ = MortonHistogram
+    (cello::rank(), config->mesh_root_blocks,
+     config->mesh_min_level, config->mesh_max_level, max_bins);
+}
+
+//----------------------------------------------------------------------
+
+long long * MethodOrderSfc::pindex_(Block * block)
+{
+  Scalar<long long> scalar(cello::scalar_descr_long_long(),
+                           block->data()->scalar_data_long_long());
+  return scalar.value(is_index_);
+}
+
+//----------------------------------------------------------------------
+
+long long * MethodOrderSfc::pcount_(Block * block)
+{
+  Scalar<long long> scalar(cello::scalar_descr_long_long(),
+                           block->data()->scalar_data_long_long());
+  return scalar.value(is_count_);
+}
+
+//----------------------------------------------------------------------
+
+Index * MethodOrderSfc::pnext_(Block * block)
+{
+  Scalar<Index> scalar(cello::scalar_descr_index(),
+                       block->data()->scalar_data_index());
+  return scalar.value(is_next_);
+}
@@ -0,0 +1,139 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     problem_MethodOrderSfc.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Problem] Declaration of the MethodOrderSfc class for
+///           generating the Morton ordering of blocks from Morton keys
+
+#ifndef PROBLEM_METHOD_ORDER_SFC_HPP
+#define PROBLEM_METHOD_ORDER_SFC_HPP
+
+class MethodOrderSfc : public Method {
+
+  /// @class    MethodOrderSfc
+  /// @ingroup  Problem
+  /// @brief    [\ref Problem] Morton ordering of blocks using a
+  ///           histogram reduction
+  ///
+  /// Each Block computes its Morton key locally using
+  /// Index::morton_key(), and adds itself to its bin of a
+  /// MortonHistogram.  The histogram is summed and returned to all
+  /// Blocks, so each Block knows how many Blocks precede its bin.
+  /// Blocks then send their Index to the first Block of their bin,
+  /// which sorts them and sends each its position in the ordering,
+  /// the number of Blocks, and the Index of the next Block.  The
+  /// number of message rounds does not depend on the hierarchy
+  /// depth, and no Block receives more keys than are in its bin.
+  /// Output Block scalars "order_sfc:index", "order_sfc:count" and
+  /// "order_sfc:next" match those of MethodOrderMorton.
+
+public: // interface
+
+  /// Constructor
+  MethodOrderSfc() throw();
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(MethodOrderSfc);
+
+  /// Charm++ PUP::able migration constructor
+  MethodOrderSfc (CkMigrateMessage *m)
+    : Method (m),
+      is_index_(-1),
+      is_count_(-1),
+      is_next_(-1),
+      histogram_(),
+      bins_()
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    Method::pup(p);
+    p | is_index_;
+    p | is_count_;
+    p | is_next_;
+    // SKIP histogram_: rebuilt on first use
+    // SKIP bins_: only used within compute()
+  }
+
+  /// Called on each Block with the histogram of Blocks per bin: send
+  /// the Block's Index to the first Block of its bin
+  void compute_order (Block * block, CkReductionMsg * msg);
+
+  /// Called on the first Block of a bin with the Index of another
+  /// Block in the bin
+  void compute_gather (Block * block, Index index);
+
+  /// Set the Block's ordering scalars
+  void compute_complete (Block * block, long long index, long long count,
+                         Index index_next);
+
+  /// Return the Indices of the given Morton keys in Morton order
+  static void order (int count, const MortonKey * keys,
+                     std::vector<Index> & index_list);
+
+public: // virtual methods
+
+  /// Apply the method to determine the Morton ordering of blocks
+  virtual void compute( Block * block) throw();
+
+  virtual std::string name () throw ()
+  { return "order_sfc"; }
+
+private: // methods
+
+  /// Create the bins from the mesh parameters
+  void initialize_histogram_ ();
+
+  /// Send Blocks of the bin their positions if all have been gathered
+  /// by its first Block
+  void compute_bin_ (Index index_collector);
+
+  /// Return the pointer to the Block's Morton ordering index
+  long long * pindex_(Block * block);
+
+  /// Return the pointer to the number of Block indices
+  long long * pcount_(Block * block);
+
+  /// Return the pointer to the Index of the "next" block
+  Index * pnext_(Block * block);
+
+private: // attributes
+
+  // NOTE: change pup() function whenever attributes change
+
+  /// Block Scalar<long long> index
+  int is_index_;
+  /// Block Scalar<long long> count
+  int is_count_;
+  /// Block Scalar<Index> next
+  int is_next_;
+
+  /// Maximum number of histogram bins, the length of the array
+  /// each Block contributes to the reduction
+  static const int max_bins = 4096;
+
+  /// Bins of Blocks along the Morton curve
+  MortonHistogram histogram_;
+
+  /// Blocks of a bin gathered by its first Block
+  struct Bin {
+    Bin() : keys(), count(-1), offset(0), total(0), index_next() { }
+    /// Morton keys of Blocks gathered so far
+    std::vector<MortonKey> keys;
+    /// Number of Blocks in the bin, or -1 before the histogram arrives
+    int count;
+    /// Number of Blocks before the bin
+    long long offset;
+    /// Number of Blocks
+    long long total;
+    /// Index of the first Block after the bin
+    Index index_next;
+  };
+
+  /// Bins whose first Block is on this PE, keyed by its Index
+  std::map<Index,Bin> bins_;
+};
+
+#endif /* PROBLEM_METHOD_ORDER_SFC_HPP */
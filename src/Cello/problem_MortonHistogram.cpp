@@ -0,0 +1,155 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     problem_MortonHistogram.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Implementation of the MortonHistogram class
+
+#include "problem.hpp"
+
+//----------------------------------------------------------------------
+
+MortonHistogram::MortonHistogram() throw()
+  : rank_(0),
+    min_level_(0),
+    bin_level_(0),
+    group_size_(1),
+    num_bins_(0),
+    top_keys_()
+{
+}
+
+//----------------------------------------------------------------------
+
+MortonHistogram::MortonHistogram
+(int rank, const int na3[3], int min_level, int max_level, int max_bins)
+  throw()
+  : rank_(rank),
+    min_level_(std::min(min_level,0)),
+    bin_level_(std::min(min_level,0)),
+    group_size_(1),
+    num_bins_(0),
+    top_keys_()
+{
+  // coarsest-level nodes are the ancestors of root Blocks
+
+  for (int iz=0; iz<na3[2]; iz++) {
+    for (int iy=0; iy<na3[1]; iy++) {
+      for (int ix=0; ix<na3[0]; ix++) {
+        const Index index = Index(ix,iy,iz).index_ancestor
+          (min_level_,min_level_);
+        top_keys_.push_back(index.morton_key());
+      }
+    }
+  }
+  std::sort (top_keys_.begin(), top_keys_.end());
+  top_keys_.erase (std::unique (top_keys_.begin(), top_keys_.end()),
+                   top_keys_.end());
+
+  const long long num_top = top_keys_.size();
+
+  if (num_top > max_bins) {
+
+    group_size_ = (num_top + max_bins - 1) / max_bins;
+    num_bins_ = (num_top + group_size_ - 1) / group_size_;
+
+  } else {
+
+    // refine bins while the number of bins allows
+
+    const int num_children = 1 << rank_;
+    long long size = 1;
+    while (bin_level_ < max_level &&
+           num_top*(num_children*size + 1) <= max_bins) {
+      size = num_children*size + 1;
+      ++bin_level_;
+    }
+    num_bins_ = num_top*size;
+  }
+}
+
+//----------------------------------------------------------------------
+
+int MortonHistogram::bin (Index index) const throw()
+{
+  const Index index_top = index.index_ancestor(min_level_,min_level_);
+  const int i_top = std::lower_bound
+    (top_keys_.begin(), top_keys_.end(), index_top.morton_key())
+    - top_keys_.begin();
+
+  if (group_size_ > 1) return i_top / group_size_;
+
+  // position of the Block, or its ancestor at the bin level, in a
+  // depth-first traversal of a full tree down to the bin level
+
+  const int level_node = std::min(index.level(),bin_level_);
+  int position = 0;
+  for (int level=min_level_+1; level<=level_node; level++) {
+    int icx=0, icy=0, icz=0;
+    index.child(level,&icx,&icy,&icz,min_level_);
+    const int ic = icx + 2*(icy + 2*icz);
+    position += 1 + ic*subtree_size_(bin_level_ - level);
+  }
+
+  return i_top*subtree_size_(bin_level_ - min_level_) + position;
+}
+
+//----------------------------------------------------------------------
+
+Index MortonHistogram::collector (int bin) const throw()
+{
+  Index index;
+
+  if (group_size_ > 1) {
+    index.set_morton_key(top_keys_[bin*group_size_]);
+    return index;
+  }
+
+  // invert bin()
+
+  const int size_top = subtree_size_(bin_level_ - min_level_);
+  index.set_morton_key(top_keys_[bin / size_top]);
+  int position = bin % size_top;
+  for (int level=min_level_+1; position > 0; level++) {
+    position -= 1;
+    const int size = subtree_size_(bin_level_ - level);
+    const int ic = position / size;
+    position = position % size;
+    index = index.index_child (ic & 1, (ic >> 1) & 1, (ic >> 2) & 1,
+                               min_level_);
+  }
+  return index;
+}
+
+//----------------------------------------------------------------------
+
+void MortonHistogram::locate
+(const int * counts, int bin,
+ long long * offset, long long * count, int * bin_next) const throw()
+{
+  (*offset) = 0;
+  (*count)  = 0;
+  for (int i=0; i<num_bins_; i++) {
+    if (i == bin) (*offset) = (*count);
+    (*count) += counts[i];
+  }
+
+  (*bin_next) = bin;
+  for (int k=1; k<=num_bins_; k++) {
+    const int i = (bin + k) % num_bins_;
+    if (counts[i] > 0) {
+      (*bin_next) = i;
+      break;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+int MortonHistogram::subtree_size_ (int depth) const throw()
+{
+  const int num_children = 1 << rank_;
+  int size = 1;
+  for (int i=0; i<depth; i++) size = num_children*size + 1;
+  return size;
+}
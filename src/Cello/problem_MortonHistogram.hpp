@@ -0,0 +1,88 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     problem_MortonHistogram.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Problem] Declaration of the MortonHistogram class
+
+#ifndef PROBLEM_MORTON_HISTOGRAM_HPP
+#define PROBLEM_MORTON_HISTOGRAM_HPP
+
+class MortonHistogram {
+
+  /// @class    MortonHistogram
+  /// @ingroup  Problem
+  /// @brief    [\ref Problem] Bins of consecutive Blocks in Morton order
+  ///
+  /// Partitions the Block hierarchy into a fixed number of bins along
+  /// the Morton curve, so that a histogram of Blocks per bin gives each
+  /// Block the number of Blocks before its bin.  Bins are the nodes of
+  /// the hierarchy from the coarsest level down to a bin level, which
+  /// is as fine as the maximum number of bins allows.  Nodes coarser
+  /// than the bin level are bins holding at most one Block, and each
+  /// node at the bin level is a bin holding all of its descendents.
+  /// If there are more coarsest-level nodes than bins, consecutive
+  /// coarsest-level trees share a bin.  The first Block of each
+  /// non-empty bin, its collector, always exists.
+
+public: // interface
+
+  /// Create an empty histogram
+  MortonHistogram() throw();
+
+  /// Create bins for a hierarchy with the given root array, coarsest
+  /// level min_level <= 0 and finest level max_level, using at most
+  /// max_bins bins unless there are more coarsest-level nodes
+  MortonHistogram (int rank, const int na3[3],
+                   int min_level, int max_level, int max_bins) throw();
+
+  /// Return the number of bins
+  int num_bins() const throw()
+  { return num_bins_; }
+
+  /// Return the level of the nodes whose subtrees are bins
+  int bin_level() const throw()
+  { return bin_level_; }
+
+  /// Return the bin containing the given Block
+  int bin (Index index) const throw();
+
+  /// Return the Index of the first Block of the given bin, which
+  /// exists if the bin is not empty
+  Index collector (int bin) const throw();
+
+  /// Given the number of Blocks in each bin, return the number of
+  /// Blocks before the given bin, the total number of Blocks, and the
+  /// next non-empty bin after the given bin, wrapping around to the
+  /// first
+  void locate (const int * counts, int bin,
+               long long * offset, long long * count,
+               int * bin_next) const throw();
+
+private: // functions
+
+  /// Return the number of nodes in a full subtree of the given depth
+  int subtree_size_ (int depth) const throw();
+
+private: // attributes
+
+  /// Dimensionality
+  int rank_;
+
+  /// Coarsest level
+  int min_level_;
+
+  /// Level of the nodes whose subtrees are bins
+  int bin_level_;
+
+  /// Number of consecutive coarsest-level trees in each bin
+  int group_size_;
+
+  /// Number of bins
+  int num_bins_;
+
+  /// Morton keys of the coarsest-level nodes, in Morton order
+  std::vector<MortonKey> top_keys_;
+};
+
+#endif /* PROBLEM_MORTON_HISTOGRAM_HPP */
@@ -18,6 +18,7 @@ Problem::Problem() throw()
     stopping_(nullptr),
     solver_list_(),
     method_list_(),
+    method_graph_(),
     output_list_(),
     prolong_list_(),
     restrict_list_(),
@@ -501,6 +502,14 @@ void Problem::initialize_method
 
 //----------------------------------------------------------------------
 
+void Problem::initialize_method_graph( Config * config ) throw()
+{
+  method_graph_.initialize (this,config->method_prefetch_refresh);
+  method_graph_.print (this);
+}
+
+//----------------------------------------------------------------------
+
 void Problem::initialize_solver( Config * config ) throw()
 {
   const size_t num_solver = config->solver_list.size();
@@ -943,6 +952,10 @@ Method * Problem::create_method_
 
     method = new MethodOrderMorton(config->mesh_min_level);
 
+  } else if (name == "order_sfc") {
+
+    method = new MethodOrderSfc();
+
   } else if (name == "refresh") {
 
     method = new MethodRefresh
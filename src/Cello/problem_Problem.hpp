@@ -72,6 +72,7 @@ public: // interface
       stopping_(nullptr),
       solver_list_(),
       method_list_(),
+      method_graph_(),
       output_list_(),
       prolong_list_(),
       restrict_list_(),
@@ -134,9 +135,17 @@ public: // interface
   Method * method(size_t i) const throw() 
   { return (i < method_list_.size()) ? method_list_[i] : nullptr; }
 
+  /// Return the number of method objects
+  int num_methods () const throw()
+  { return method_list_.size(); }
+
   /// Return the named method object if present
   Method * method (std::string name) const throw();
 
+  /// Return the data dependencies between method objects
+  const MethodGraph * method_graph() const throw()
+  { return &method_graph_; }
+
   // Return whether a method object with given name exists for this problem
   bool method_exists(const std::string &name) const throw();
 
@@ -207,6 +216,10 @@ public: // interface
 
   /// Initialize Solver objects
   void initialize_solver(Config * config) throw();
+
+  /// Initialize the data dependencies between method objects, after
+  /// fields are finalized
+  void initialize_method_graph(Config * config) throw();
   
   /// Initialize the prolong objects
   void initialize_prolong(Config * config) throw();
@@ -322,6 +335,10 @@ protected: // attributes
   /// List of method objects
   std::vector<Method *> method_list_;
 
+  /// Data dependencies between method objects (not checkpointed: an
+  /// empty graph disables prefetching refreshes)
+  MethodGraph method_graph_;
+
   /// Output objects
   std::vector<Output *> output_list_;
 
@@ -14,8 +14,10 @@
 
 //----------------------------------------------------------------------
 
-ProlongLinear::ProlongLinear() throw()
-  : Prolong ()
+ProlongLinear::ProlongLinear(bool specialize, int face_depth) throw()
+  : Prolong (),
+    specialize_(specialize),
+    face_depth_(face_depth)
 {
   //  CkPrintf ("TRACE_PROLONG ProlongLinear()\n");
 }
@@ -104,6 +106,12 @@ void ProlongLinear::apply_
     //          xyz[i],nf3[i],nf3[i] >= 4);
   }
 
+  if (specialize_ && rank == 3) {
+    apply_3d_ (values_f, mf3, of3, nf3,
+               values_c, mc3, oc3, nc3, accumulate);
+    return;
+  }
+
   // adjustment if coarse ghost cells available
   // NOTE:1 if ghosts not available , 0 if ghosts available
   
@@ -367,5 +375,162 @@ void ProlongLinear::apply_
   }
 }
 
+//----------------------------------------------------------------------
+
+template <class T>
+void ProlongLinear::axis_weights_
+(int nf, int gc, int * ic, T * w0, T * w1)
+{
+  for (int i_f = 0; i_f<nf; i_f++) {
+
+    ic[i_f] = ((i_f+1) >> 1) - gc;
+
+    // Default weighting factor
+    int w[2] = { 1, 3 };
+
+    // Update weights if no ghosts and on edges
+    if (i_f==0)    { ic[i_f] += gc; }
+    if (i_f==nf-1) { ic[i_f] -= gc; }
+    if (i_f==0 || i_f==nf-1) {
+      w[0] += 4*gc;
+      w[1] -= 4*gc;
+    }
+
+    w0[i_f] = 0.25*w[ i_f&1];
+    w1[i_f] = 0.25*w[~i_f&1];
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void ProlongLinear::apply_3d_
+(  T * values_f, int mf3[3], int of3[3], int nf3[3],
+   const T * values_c, int mc3[3], int oc3[3], int nc3[3],
+   bool accumulate)
+{
+  // NOTE: all weights and their products are exactly representable
+  // (multiples of 1/64), so factoring them differently than apply_()
+  // does not change the result as long as the order of the sums is
+  // kept the same
+
+  const int nfx = nf3[0];
+  const int nfy = nf3[1];
+  const int nfz = nf3[2];
+
+  const int gcx = (nfx==2*nc3[0]) ? 1 : 0;
+  const int gcy = (nfy==2*nc3[1]) ? 1 : 0;
+  const int gcz = (nfz==2*nc3[2]) ? 1 : 0;
+
+  const int dcy = mc3[0];
+  const int dcz = mc3[0]*mc3[1];
+  const int dfy = mf3[0];
+  const int dfz = mf3[0]*mf3[1];
+
+  std::vector<int> icx(nfx), icy(nfy), icz(nfz);
+  std::vector<T> wx0(nfx), wx1(nfx);
+  std::vector<T> wy0(nfy), wy1(nfy);
+  std::vector<T> wz0(nfz), wz1(nfz);
+
+  axis_weights_ (nfx, gcx, icx.data(), wx0.data(), wx1.data());
+  axis_weights_ (nfy, gcy, icy.data(), wy0.data(), wy1.data());
+  axis_weights_ (nfz, gcz, icz.data(), wz0.data(), wz1.data());
+
+  // interior weights along x: fine cells 2k+1 and 2k+2 both
+  // interpolate between coarse cells k+1-gcx and k+2-gcx
+
+  const T wl = 0.75;
+  const T wr = 0.25;
+
+  for (int ifz = 0; ifz<nfz; ifz++) {
+    for (int ify = 0; ify<nfy; ify++) {
+
+      const T w00 = wy0[ify]*wz0[ifz];
+      const T w10 = wy1[ify]*wz0[ifz];
+      const T w01 = wy0[ify]*wz1[ifz];
+      const T w11 = wy1[ify]*wz1[ifz];
+
+      const T * c = values_c + oc3[0]
+        + dcy*(oc3[1]+icy[ify]) + dcz*(oc3[2]+icz[ifz]);
+      T * f = values_f + of3[0]
+        + dfy*(of3[1]+ify) + dfz*(of3[2]+ifz);
+
+      // single fine cell using the general weights along x, which
+      // may be one-sided at the edges
+
+      auto cell = [&] (int ifx) {
+        const int i = icx[ifx];
+        const T a = wx0[ifx];
+        const T b = wx1[ifx];
+        const T value =
+          a*w00*c[i          ] + b*w00*c[i+1          ] +
+          a*w10*c[i  +dcy    ] + b*w10*c[i+1+dcy    ] +
+          a*w01*c[i      +dcz] + b*w01*c[i+1    +dcz] +
+          a*w11*c[i  +dcy+dcz] + b*w11*c[i+1+dcy+dcz];
+        if (accumulate) f[ifx] += value;
+        else            f[ifx]  = value;
+      };
+
+      // face-only: rows away from the y- and z-faces only need the
+      // cells next to the x-faces
+
+      if (face_depth_ > 0 &&
+          face_depth_ <= ify && ify < nfy-face_depth_ &&
+          face_depth_ <= ifz && ifz < nfz-face_depth_) {
+        const int d = std::min(face_depth_,nfx);
+        for (int ifx = 0; ifx<d; ifx++) cell(ifx);
+        for (int ifx = std::max(d,nfx-face_depth_); ifx<nfx; ifx++) cell(ifx);
+        continue;
+      }
+
+      // x-edges
+
+      cell(0);
+      cell(nfx-1);
+
+      // x-interior: two fine cells per coarse cell
+
+      const T * c0 = c + 1 - gcx;
+      const T l00 = wl*w00, r00 = wr*w00;
+      const T l10 = wl*w10, r10 = wr*w10;
+      const T l01 = wl*w01, r01 = wr*w01;
+      const T l11 = wl*w11, r11 = wr*w11;
+      const int nk = nfx/2 - 1;
+
+      if (accumulate) {
+        #pragma omp simd
+        for (int k = 0; k<nk; k++) {
+          const T * ck = c0 + k;
+          f[2*k+1] +=
+            l00*ck[0      ] + r00*ck[1        ] +
+            l10*ck[dcy    ] + r10*ck[1+dcy    ] +
+            l01*ck[dcz    ] + r01*ck[1    +dcz] +
+            l11*ck[dcy+dcz] + r11*ck[1+dcy+dcz];
+          f[2*k+2] +=
+            r00*ck[0      ] + l00*ck[1        ] +
+            r10*ck[dcy    ] + l10*ck[1+dcy    ] +
+            r01*ck[dcz    ] + l01*ck[1    +dcz] +
+            r11*ck[dcy+dcz] + l11*ck[1+dcy+dcz];
+        }
+      } else {
+        #pragma omp simd
+        for (int k = 0; k<nk; k++) {
+          const T * ck = c0 + k;
+          f[2*k+1] =
+            l00*ck[0      ] + r00*ck[1        ] +
+            l10*ck[dcy    ] + r10*ck[1+dcy    ] +
+            l01*ck[dcz    ] + r01*ck[1    +dcz] +
+            l11*ck[dcy+dcz] + r11*ck[1+dcy+dcz];
+          f[2*k+2] =
+            r00*ck[0      ] + l00*ck[1        ] +
+            r10*ck[dcy    ] + l10*ck[1+dcy    ] +
+            r01*ck[dcz    ] + l01*ck[1    +dcz] +
+            r11*ck[dcy+dcz] + l11*ck[1+dcy+dcz];
+        }
+      }
+    }
+  }
+}
+
 //======================================================================
 
@@ -16,18 +16,31 @@ class ProlongLinear : public Prolong
 
 public: // interface
 
-  /// Constructor
-  ProlongLinear() throw();
+  /// Constructor: if specialize is false, always use the generic
+  /// kernel (used for testing and benchmarking the specialized kernels).
+  /// If face_depth > 0, the specialized 3D kernel only computes fine
+  /// cells within face_depth cells of the faces of the fine region,
+  /// leaving interior values untouched
+  ProlongLinear(bool specialize = true, int face_depth = 0) throw();
 
   /// CHARM++ PUP::able declaration
   PUPable_decl(ProlongLinear);
 
   /// CHARM++ migration constructor
-  ProlongLinear(CkMigrateMessage *m) : Prolong(m) {}
+  ProlongLinear(CkMigrateMessage *m)
+    : Prolong(m),
+      specialize_(true),
+      face_depth_(0)
+  {}
 
   /// CHARM++ Pack / Unpack function
   void pup (PUP::er &p) 
-  { TRACEPUP; Prolong::pup(p); }
+  {
+    TRACEPUP;
+    Prolong::pup(p);
+    p | specialize_;
+    p | face_depth_;
+  }
 
   /// Prolong coarse Field values to fine values
   virtual void apply
@@ -36,6 +49,14 @@ public: // interface
     const void * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
     bool accumulate = false);
 
+  /// Set the face-only depth: 0 computes the entire fine region
+  void set_face_depth (int face_depth)
+  { face_depth_ = face_depth; }
+
+  /// Return the face-only depth
+  int face_depth () const
+  { return face_depth_; }
+
   /// Return the name identifying the prolongation operator
   virtual std::string name () const { return "linear"; }
 
@@ -64,10 +85,34 @@ private: // functions
     const T * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
     bool accumulate = false);
 
+  /// Specialized kernel for 3D arrays refined by a factor of 2.  Each
+  /// coarse cell is expanded into its two fine x-cells with
+  /// loop-invariant weights so the inner loop vectorizes; results are
+  /// bitwise identical to apply_().  Skips the interior of the fine
+  /// region if face_depth_ > 0
+  template <class T>
+  void apply_3d_
+  ( T *       values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+    const T * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
+    bool accumulate = false);
+
+  /// Compute coarse index offsets and weights along one axis, matching
+  /// the edge treatment in apply_()
+  template <class T>
+  static void axis_weights_
+  (int n_f, int gc, int * i_c, T * w0, T * w1);
+
 private: // attributes
 
   // NOTE: change pup() function whenever attributes change
 
+  /// Whether to use specialized kernels when applicable
+  bool specialize_;
+
+  /// Depth of fine cells computed next to each face of the fine region
+  /// (0 for the entire region)
+  int face_depth_;
+
 };
 
 #endif /* PROBLEM_PROLONG_LINEAR_HPP */
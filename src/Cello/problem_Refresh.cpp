@@ -9,6 +9,31 @@
 
 //----------------------------------------------------------------------
 
+long long Refresh::bytes_skipped[CONFIG_NODE_SIZE] = {0};
+
+//----------------------------------------------------------------------
+
+std::vector<int> Refresh::changed_fields
+(const std::vector<int> & field_list,
+ const std::vector<int> & state,
+ std::vector<int> & state_sent) throw()
+{
+  std::vector<int> field_changed;
+  for (int id_field : field_list) {
+    if (id_field >= int(state_sent.size())) {
+      state_sent.resize(id_field+1,-1);
+    }
+    const int current = (id_field < int(state.size())) ? state[id_field] : -1;
+    if (current < 0 || state_sent[id_field] != current) {
+      state_sent[id_field] = current;
+      field_changed.push_back(id_field);
+    }
+  }
+  return field_changed;
+}
+
+//----------------------------------------------------------------------
+
 void Refresh::add_field(std::string field_name)
 {
   const int id_field = cello::field_descr()->field_id(field_name);
@@ -21,6 +21,18 @@ class Refresh : public PUP::able {
 
 public: // interface
 
+  /// Number of ghost zone bytes not sent due to Field:refresh_skip_unchanged
+  static long long bytes_skipped[CONFIG_NODE_SIZE];
+
+  /// Return the fields in field_list whose current state, e.g. a
+  /// modification epoch, differs from the state when last sent, and
+  /// update the sent states.  States are indexed by field id, and
+  /// fields not yet sent are always included
+  static std::vector<int> changed_fields
+  (const std::vector<int> & field_list,
+   const std::vector<int> & state,
+   std::vector<int> & state_sent) throw();
+
   /// empty constructor for charm++ pup()
   Refresh() throw()
   : all_fields_(false),
@@ -172,6 +184,7 @@ public: // interface
   /// Add specified fields
   void set_field_list (std::vector<int> field_list)
   {
+    all_fields_ = false;
     field_list_src_ = field_list;
     field_list_dst_ = field_list;
   }
@@ -62,6 +62,9 @@ int RestrictLinear::apply_
 
   const int rank = (nd3_f[1] == 1) ? 1 : ((nd3_f[2] == 1) ? 2 : 3);
 
+  // NOTE: loops are ordered with x innermost so that the fine array is
+  // accessed with unit (factor-2) stride and the inner loop vectorizes
+
   const int dx = 1;
   const int dy = nd3_f[0];
   const int dz = nd3_f[0]*nd3_f[1];
@@ -95,10 +98,10 @@ int RestrictLinear::apply_
   } else if (rank == 2) {
 
     if (! accumulate) {
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
-	for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
-	  int iy_f = iy_c*2;
+      for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
+	int iy_f = iy_c*2;
+	for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
+	  int ix_f = ix_c*2;
 
 	  int i_c = (im3_c[0]+ix_c) + nd3_c[0]*
 	    (       (im3_c[1]+iy_c));
@@ -114,10 +117,10 @@ int RestrictLinear::apply_
       }
     } else { // accumulate
 
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
-	for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
-	  int iy_f = iy_c*2;
+      for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
+	int iy_f = iy_c*2;
+	for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
+	  int ix_f = ix_c*2;
 
 	  int i_c = (im3_c[0]+ix_c) + nd3_c[0]*
 	    (       (im3_c[1]+iy_c));
@@ -136,12 +139,13 @@ int RestrictLinear::apply_
   } else if (rank == 3) {
 
     if (! accumulate) {
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
+      for (int iz_c=0; iz_c<n3_c[2]; iz_c++) {
+	int iz_f = iz_c*2;
 	for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
 	  int iy_f = iy_c*2;
-	  for (int iz_c=0; iz_c<n3_c[2]; iz_c++) {
-	    int iz_f = iz_c*2;
+	  #pragma omp simd
+	  for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
+	    int ix_f = ix_c*2;
 	    
 	    int i_c = (im3_c[0]+ix_c) + nd3_c[0]*
 	      (       (im3_c[1]+iy_c) + nd3_c[1]*
@@ -163,12 +167,13 @@ int RestrictLinear::apply_
 	}
       }
     } else { // accumulate
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
+      for (int iz_c=0; iz_c<n3_c[2]; iz_c++) {
+	int iz_f = iz_c*2;
 	for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
 	  int iy_f = iy_c*2;
-	  for (int iz_c=0; iz_c<n3_c[2]; iz_c++) {
-	    int iz_f = iz_c*2;
+	  #pragma omp simd
+	  for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
+	    int ix_f = ix_c*2;
 
 	    int i_c = (im3_c[0]+ix_c) + nd3_c[0]*
 	      (       (im3_c[1]+iy_c) + nd3_c[1]*
@@ -45,6 +45,7 @@ Simulation::Simulation
   projections_schedule_off_(NULL),
 #endif
   schedule_balance_(NULL),
+  schedule_trace_(NULL),
   monitor_(NULL),
   hierarchy_(NULL),
   scalar_descr_long_double_(NULL),
@@ -116,6 +117,7 @@ Simulation::Simulation()
   projections_schedule_off_(NULL),
 #endif
   schedule_balance_(NULL),
+  schedule_trace_(NULL),
   monitor_(NULL),
   hierarchy_(NULL),
   scalar_descr_long_double_(NULL),
@@ -174,6 +176,7 @@ Simulation::Simulation (CkMigrateMessage *m)
     projections_schedule_off_(NULL),
 #endif
     schedule_balance_(NULL),
+    schedule_trace_(NULL),
     monitor_(NULL),
     hierarchy_(NULL),
     scalar_descr_long_double_(NULL),
@@ -297,6 +300,10 @@ void Simulation::pup (PUP::er &p)
 #endif
 
   p | schedule_balance_;
+  p | schedule_trace_;
+  if (up && schedule_trace_) {
+    Tracer::instance()->initialize(config_->performance_trace_capacity);
+  }
 
   p | refresh_list_;
   p | refresh_name_;
@@ -463,6 +470,7 @@ void Simulation::initialize_performance_() throw()
     p->new_counter(counter_type_papi, 
 		   config_->performance_papi_counters[i]);
   }
+  p->set_method_counters(config_->performance_papi_roofline_counters);
 #endif  
 
 #ifdef CONFIG_USE_PROJECTIONS
@@ -493,6 +501,18 @@ void Simulation::initialize_performance_() throw()
   }
 #endif
 
+  int index_trace = config_->performance_trace_schedule_index;
+  if (index_trace >= 0) {
+    schedule_trace_ = Schedule::create
+      ( config_->schedule_var[index_trace],
+	config_->schedule_type[index_trace],
+	config_->schedule_start[index_trace],
+	config_->schedule_stop[index_trace],
+	config_->schedule_step[index_trace],
+	config_->schedule_list[index_trace]);
+    Tracer::instance()->initialize(config_->performance_trace_capacity);
+  }
+
   p->begin();
 
   p->start_region(perf_simulation);
@@ -927,18 +947,36 @@ void Simulation::monitor_performance()
   // 6 field_face
   // 7 particle_data
   // 8 num-particles
-  // 9+ num_solver_iters
+  // 9 refresh_bytes_skipped
+  // 10 derived_field_cache_hits
+  // 11 derived_field_cache_misses
+  // 12+ num_solver_iters
   // NL+ num-blocks-<L>
-  // 10+ num_blocks_total
-  // 11+ max_proc_blocks
-  // 12+ max_proc_particles
-  // 13+ max_node_blocks
-  // 14+ max_node_particles
-  // 15+ max_solver_iters
+  // 13+ num_blocks_total
+  // NH+ method time histograms
+  // NM+ memory category bytes total
+  // NR+ method roofline counters
+  // 14+ max_proc_blocks
+  // 15+ max_proc_particles
+  // 16+ max_node_blocks
+  // 17+ max_node_particles
+  // 18+ max_solver_iters
+  // NM+ memory category bytes node, bytes high summed over node
   
   const int num_solver = problem()->num_solvers();
 
-  int n = 14 + 2*num_solver + ( hierarchy_->max_level() - hierarchy_->min_level() + 1) + nr*nc;
+  // method time histograms are merged by summing bin counts
+  const int num_histograms =
+    performance_->histograms() ? problem()->num_methods() : 0;
+
+  // per-Method PAPI roofline counters are summed with their times
+  const int num_roofline =
+    (performance_->num_method_counters() > 0) ? problem()->num_methods() : 0;
+  const int num_roofline_values = performance_->num_method_counters() + 1;
+
+  int n = 17 + 2*num_solver + ( hierarchy_->max_level() - hierarchy_->min_level() + 1) + nr*nc
+    + num_histograms*Histogram::num_bins + 3*memory_num_categories
+    + num_roofline*num_roofline_values;
 
   
   long long * counters_region = new long long [nc];
@@ -947,7 +985,7 @@ void Simulation::monitor_performance()
   const int in = cello::index_static();
   
   int m=0;
-  const int num_max = 4 + num_solver;
+  const int num_max = 4 + num_solver + 2*memory_num_categories;
   counters_reduce[m++] = n - num_max - 2;
   counters_reduce[m++] = num_max;
   
@@ -960,8 +998,11 @@ void Simulation::monitor_performance()
   counters_reduce[m++] = FieldFace::counter[in];      // 6
   counters_reduce[m++] = ParticleData::counter[in];   // 7
   counters_reduce[m++] = hierarchy_->num_particles(); // 8
+  counters_reduce[m++] = Refresh::bytes_skipped[in];  // 9
+  counters_reduce[m++] = DerivedFieldCache::num_hits[in];   // 10
+  counters_reduce[m++] = DerivedFieldCache::num_misses[in]; // 11
   for (int i=0; i<num_solver; i++) {
-    counters_reduce[m++] = cello::simulation()->get_solver_num_iter(i); // 9
+    counters_reduce[m++] = cello::simulation()->get_solver_num_iter(i); // 12
   }
 
   const int min_level = hierarchy_->min_level();
@@ -971,7 +1012,7 @@ void Simulation::monitor_performance()
     num_blocks_total +=  hierarchy_->num_blocks(i);
     counters_reduce[m++] = hierarchy_->num_blocks(i); // NL
   }
-  counters_reduce[m++] = num_blocks_total;            // 10  num_blocks_total
+  counters_reduce[m++] = num_blocks_total;            // 13  num_blocks_total
   
   // performance region counters
   for (int ir = 0; ir < nr; ir++) {
@@ -981,14 +1022,37 @@ void Simulation::monitor_performance()
     }
   }
 
+  for (int im = 0; im < num_histograms; im++) {
+    const long long * counts = performance_->method_histogram(im).counts();
+    for (int ib = 0; ib < Histogram::num_bins; ib++) {
+      counters_reduce[m++] = counts[ib];                 // NH
+    }
+  }
+  performance_->clear_method_histograms();
+
+  for (int ic = 0; ic < memory_num_categories; ic++) {
+    counters_reduce[m++] = Memory::category_bytes(ic);  // NM
+  }
+
+  for (int im = 0; im < num_roofline; im++) {
+    const long long * counters = performance_->method_counters(im);
+    for (int k = 0; k < num_roofline_values; k++) {
+      counters_reduce[m++] = counters[k];               // NR
+    }
+  }
+
   // maximum metrics
   
-  counters_reduce[m++] = num_blocks_total;            // 11  max_proc_blocks
-  counters_reduce[m++] = hierarchy_->num_particles(); // 12  max_proc_particles
-  counters_reduce[m++] = Hierarchy::num_blocks_node;  // 13  max_node_blocks
-  counters_reduce[m++] = Hierarchy::num_particles_node;// 14 max_node_particles
+  counters_reduce[m++] = num_blocks_total;            // 14  max_proc_blocks
+  counters_reduce[m++] = hierarchy_->num_particles(); // 15  max_proc_particles
+  counters_reduce[m++] = Hierarchy::num_blocks_node;  // 16  max_node_blocks
+  counters_reduce[m++] = Hierarchy::num_particles_node;// 17 max_node_particles
   for (int i=0; i<num_solver; i++) {
-    counters_reduce[m++] = cello::simulation()->get_solver_max_iter(i); // 15 max_node_particles
+    counters_reduce[m++] = cello::simulation()->get_solver_max_iter(i); // 18 max_node_particles
+  }
+  for (int ic = 0; ic < memory_num_categories; ic++) {
+    counters_reduce[m++] = Memory::category_bytes_node(ic);      // NM
+    counters_reduce[m++] = Memory::category_bytes_high_sum_node(ic); // NM
   }
 
   ASSERT2("Simulation::monitor_performance()",
@@ -1031,10 +1095,13 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
   const long long field_face  = counters_reduce[m++];   // 6
   const long long particle_data = counters_reduce[m++]; // 7
   const long long num_particles = counters_reduce[m++]; // 8
+  const long long refresh_bytes_skipped = counters_reduce[m++]; // 9
+  const long long derived_cache_hits   = counters_reduce[m++]; // 10
+  const long long derived_cache_misses = counters_reduce[m++]; // 11
 
   const int num_solver = problem()->num_solvers();
   for (int i=0; i<num_solver; i++) {
-    const long long num_solver_iter = counters_reduce[m++]; // 15
+    const long long num_solver_iter = counters_reduce[m++]; // 12
     monitor()->print ("Performance","solver num-%s-iter %lld",
                       problem()->solver(i)->name().c_str(),
                       num_solver_iter);
@@ -1046,6 +1113,18 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
   monitor()->print("Performance","counter num-data-msg %lld", data_msg);
   monitor()->print("Performance","counter num-field-face %lld", field_face);
   monitor()->print("Performance","counter num-particle-data %lld", particle_data);
+  monitor()->print("Performance","counter refresh-bytes-skipped %lld",
+                   refresh_bytes_skipped);
+  monitor()->print("Performance","counter derived-field-cache-hits %lld",
+                   derived_cache_hits);
+  monitor()->print("Performance","counter derived-field-cache-misses %lld",
+                   derived_cache_misses);
+  const long long derived_cache_lookups =
+    derived_cache_hits + derived_cache_misses;
+  if (derived_cache_lookups > 0) {
+    monitor()->print("Performance","counter derived-field-cache-hit-rate %.3f",
+                     double(derived_cache_hits) / derived_cache_lookups);
+  }
 
   monitor()->print("Performance","simulation num-particles total %lld",
 		   num_particles);
@@ -1073,7 +1152,7 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
   monitor()->print
     ("Performance","simulation num-total-blocks %lld", num_total_blocks);
 
-  const long long num_blocks_total   = counters_reduce[m++]; // 10
+  const long long num_blocks_total   = counters_reduce[m++]; // 13
 
   if (num_total_blocks != num_blocks_total) {
     WARNING2 ("Simulation::r_monitor_performance_reduce()",
@@ -1100,19 +1179,56 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
     }
   }
 
-  const long long max_proc_blocks    = counters_reduce[m++]; // 11
-  const long long max_proc_particles = counters_reduce[m++]; // 12
-  const long long max_node_blocks    = counters_reduce[m++]; // 13
-  const long long max_node_particles = counters_reduce[m++]; // 14
+  const int num_histograms =
+    performance_->histograms() ? problem()->num_methods() : 0;
+
+  for (int im = 0; im < num_histograms; im++, m += Histogram::num_bins) {
+    Histogram histogram;
+    std::copy_n(counters_reduce + m, int(Histogram::num_bins),
+                histogram.counts());                     // NH
+    if (histogram.count() > 0) {
+      monitor()->print
+        ("Performance",
+         "method %s time-usec count %lld p50 %.1f p90 %.1f p99 %.1f max %.1f",
+         problem()->method(im)->name().c_str(), histogram.count(),
+         1e-3*histogram.percentile(50.0), 1e-3*histogram.percentile(90.0),
+         1e-3*histogram.percentile(99.0), 1e-3*histogram.percentile(100.0));
+    }
+  }
+
+  const long long * memory_bytes_total = counters_reduce + m; // NM
+  m += memory_num_categories;
+
+  const int num_roofline =
+    (performance_->num_method_counters() > 0) ? problem()->num_methods() : 0;
+  const int num_roofline_values = performance_->num_method_counters() + 1;
+  for (int im = 0; im < num_roofline; im++, m += num_roofline_values) {
+    monitor_roofline_(problem()->method(im)->name(),
+                      counters_reduce + m);              // NR
+  }
+
+  const long long max_proc_blocks    = counters_reduce[m++]; // 14
+  const long long max_proc_particles = counters_reduce[m++]; // 15
+  const long long max_node_blocks    = counters_reduce[m++]; // 16
+  const long long max_node_particles = counters_reduce[m++]; // 17
 
   for (int i=0; i<num_solver; i++) {
-    const long long max_solver_iters       = counters_reduce[m++]; // 15
+    const long long max_solver_iters       = counters_reduce[m++]; // 18
     monitor()->print ("Performance","solver max-%s-iter %lld",
                       problem()->solver(i)->name().c_str(),
                       max_solver_iters);
   }
   cello::simulation()->clear_solver_iter(); // clear it for the next solve
 
+  for (int ic = 0; ic < memory_num_categories; ic++) {
+    const long long bytes_node      = counters_reduce[m++]; // NM
+    const long long bytes_high_sum_node = counters_reduce[m++]; // NM
+    monitor()->print
+      ("Performance","memory %s bytes-total %lld bytes-node-max %lld"
+       " bytes-high-sum-node-max %lld", Memory::category_name(ic),
+       memory_bytes_total[ic], bytes_node, bytes_high_sum_node);
+  }
+
   
   monitor()->print
     ("Performance","simulation max-proc-blocks %lld",  max_proc_blocks);
@@ -1165,5 +1281,74 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
   delete msg;
 
   Memory::instance()->reset_high();
+  Memory::category_reset_high();
+
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::monitor_roofline_
+(std::string method_name, const long long * counters) const throw()
+{
+  // counters are floating-point operations, last-level cache misses,
+  // and cycles, followed by time in nanoseconds, all summed over
+  // processes and cumulative over cycles
+
+  const double time = counters[3];
+  if (time <= 0.0) return;
+
+  const double flops  = counters[0];
+  const double bytes  =
+    double(counters[1]) * config_->performance_papi_roofline_line_bytes;
+  const double cycles = counters[2];
+
+  // rates are per process, while the Method is running
+
+  const double gflops = flops / time;
+  const double gbytes = bytes / time;
+  const double intensity = (bytes > 0.0) ? flops / bytes : 0.0;
 
+  // classify using the machine balance, if the peaks are known
+
+  const double peak_gflops = config_->performance_papi_roofline_peak_gflops;
+  const double peak_gbytes = config_->performance_papi_roofline_peak_gbytes;
+  const char * bound = "unknown";
+  double roof_fraction = 0.0;
+  if (peak_gflops > 0.0 && peak_gbytes > 0.0 && bytes > 0.0) {
+    bound = (intensity < peak_gflops / peak_gbytes) ? "memory" : "compute";
+    roof_fraction = gflops / std::min(peak_gflops, intensity*peak_gbytes);
+  }
+
+  monitor()->print
+    ("Performance",
+     "method %s roofline flops %.0f bytes %.0f flops-per-cycle %.3f"
+     " intensity %.4f gflops %.4f gbytes %.4f roof-fraction %.3f bound %s",
+     method_name.c_str(), flops, bytes,
+     (cycles > 0.0) ? flops / cycles : 0.0,
+     intensity, gflops, gbytes, roof_fraction, bound);
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::trace_write (int cycle) throw()
+{
+  Tracer * tracer = Tracer::instance();
+
+  char file_name[256];
+  snprintf (file_name,sizeof(file_name),
+            config_->performance_trace_file.c_str(),cycle,CkMyPe());
+
+  FILE * fp = fopen (file_name,"w");
+  if (fp == NULL) {
+    WARNING1 ("Simulation::trace_write()",
+              "Cannot open trace file %s",file_name);
+  } else {
+    tracer->write(fp,CkMyNode(),CkMyPe());
+    fclose(fp);
+  }
+  if (tracer->num_dropped() > 0 && CkMyPe() == 0) {
+    monitor()->print ("Performance","trace dropped %lld events",
+                      tracer->num_dropped());
+  }
+  tracer->clear();
 }
@@ -180,6 +180,13 @@ public: // interface
   Schedule * schedule_balance() const throw() 
   { return schedule_balance_; };
 
+  /// Return the timeline event trace schedule
+  Schedule * schedule_trace() const throw()
+  { return schedule_trace_; };
+
+  /// Write this process's timeline events to a file and clear them
+  void trace_write (int cycle) throw();
+
   /// Write performance information to disk (all process data)
   void performance_write();
 
@@ -435,6 +442,11 @@ protected: // functions
 
   void deallocate_() throw();
 
+  /// Print the roofline summary of a Method from its reduced PAPI
+  /// counters and time
+  void monitor_roofline_ (std::string method_name,
+                          const long long * counters) const throw();
+
   Schedule * create_schedule_(std::string var,
 			      std::string type,
 			      double start,
@@ -526,6 +538,9 @@ protected: // attributes
   /// Load balancing schedule
   Schedule * schedule_balance_;
 
+  /// Timeline event trace schedule
+  Schedule * schedule_trace_;
+
   /// Monitor object
   Monitor * monitor_;
 
@@ -0,0 +1,71 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_DerivedFieldCache.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Unit tests for the DerivedFieldCache class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "mesh.hpp"
+#include "data.hpp"
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("DerivedFieldCache");
+
+  DerivedFieldCache cache;
+
+  const int in = cello::index_static();
+  const long long hits_0   = DerivedFieldCache::num_hits[in];
+  const long long misses_0 = DerivedFieldCache::num_misses[in];
+
+  const std::vector<long long> key_1 = { 1, 2, 3 };
+  const std::vector<long long> key_2 = { 1, 2, 4 };
+
+  unit_func("is_current");
+
+  unit_assert (! cache.is_current("pressure",key_1));
+  cache.set_current("pressure",key_1);
+  unit_assert (cache.is_current("pressure",key_1));
+  unit_assert (! cache.is_current("pressure",key_2));
+  unit_assert (! cache.is_current("temperature",key_1));
+
+  unit_func("num_hits");
+  unit_assert (DerivedFieldCache::num_hits[in] - hits_0 == 1);
+
+  unit_func("num_misses");
+  unit_assert (DerivedFieldCache::num_misses[in] - misses_0 == 3);
+
+  unit_func("values");
+
+  double * a = cache.values<double>("divergence",100);
+  for (int i=0; i<100; i++) a[i] = i;
+  cache.set_current("divergence",key_1);
+  double * b = cache.values<double>("divergence",100);
+  unit_assert (a == b);
+  unit_assert (b[99] == 99.0);
+  unit_assert (cache.is_current("divergence",key_1));
+  unit_assert (cache.bytes() >= 100*sizeof(double));
+
+  unit_func("invalidate");
+
+  cache.invalidate("divergence");
+  unit_assert (! cache.is_current("divergence",key_1));
+  unit_assert (cache.is_current("pressure",key_1));
+  cache.invalidate();
+  unit_assert (! cache.is_current("pressure",key_1));
+  unit_assert (cache.bytes() == 0);
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -557,6 +557,45 @@ PARALLEL_MAIN_BEGIN
   unit_assert(4.0 == v4[0] );
   unit_assert(4.0 == v4[nx*ny*(nz+1)-1]);
   unit_assert(2.0 == v5[0] );
+
+  //----------------------------------------------------------------------
+  unit_func("epoch");
+
+  field_data->reallocate_permanent(field_descr,true);
+
+  const int epoch_0 = field_data->epoch(i2);
+  const int epoch_3 = field_data->epoch(i3);
+
+  // const access and unmarked access, e.g. writing ghost zones, do
+  // not advance the epoch
+
+  const FieldData * field_data_const = field_data;
+  field_data_const->values(field_descr,i2);
+  field_data_const->unknowns(field_descr,i2);
+  field_data_const->view<double>(field_descr,i2);
+  field_data->view<const double>(field_descr,i2);
+  field_data->values_unmarked(field_descr,i2);
+  unit_assert(field_data->epoch(i2) == epoch_0);
+
+  // non-const access advances the epoch of that field only
+
+  field_data->values(field_descr,i2);
+  const int epoch_1 = field_data->epoch(i2);
+  unit_assert(epoch_1 > epoch_0);
+  field_data->unknowns(field_descr,i2);
+  const int epoch_2 = field_data->epoch(i2);
+  unit_assert(epoch_2 > epoch_1);
+  field_data->view<double>(field_descr,i2);
+  unit_assert(field_data->epoch(i2) > epoch_2);
+  unit_assert(field_data->epoch(i3) == epoch_3);
+
+  // writes through a pointer acquired earlier are marked explicitly,
+  // as Block does for fields its Methods declare writing
+
+  const int epoch_4 = field_data->epoch(i2);
+  field_data->mark_modified(i2);
+  unit_assert(field_data->epoch(i2) > epoch_4);
+  unit_assert(field_data->epoch(i3) == epoch_3);
   
   //----------------------------------------------------------------------
   unit_finalize();
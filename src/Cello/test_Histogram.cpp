@@ -0,0 +1,78 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_Histogram.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Unit tests for the Histogram class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "performance.hpp"
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("Histogram");
+
+  unit_func("bin");
+
+  // every value lies in its bin, and bins increase with value
+
+  bool in_bin = true;
+  int bin_prev = 0;
+  for (long long value=0; value<100000; value++) {
+    const int bin = Histogram::bin(value);
+    in_bin = in_bin
+      && (Histogram::bin_lower(bin) <= value)
+      && (value < Histogram::bin_lower(bin+1))
+      && (bin >= bin_prev);
+    bin_prev = bin;
+  }
+  unit_assert (in_bin);
+  unit_assert (Histogram::bin(1LL << 62) == Histogram::num_bins - 1);
+
+  unit_func("count");
+
+  Histogram histogram;
+  unit_assert (histogram.count() == 0);
+  unit_assert (histogram.percentile(50.0) == 0.0);
+  for (long long value=1; value<=1000; value++) histogram.insert(1000*value);
+  unit_assert (histogram.count() == 1000);
+
+  unit_func("percentile");
+
+  // percentiles are within the relative width of a bin
+
+  const double p50 = histogram.percentile(50.0);
+  const double p99 = histogram.percentile(99.0);
+  unit_assert (std::abs(p50 - 500000.0) < 0.2*500000.0);
+  unit_assert (std::abs(p99 - 990000.0) < 0.2*990000.0);
+  unit_assert (histogram.percentile(0.0) <= p50);
+  unit_assert (p50 <= p99);
+  unit_assert (p99 <= histogram.percentile(100.0));
+
+  unit_func("merge");
+
+  Histogram histogram_2;
+  histogram_2.insert(1000);
+  histogram_2.merge(histogram);
+  unit_assert (histogram_2.count() == 1001);
+  unit_assert (histogram_2.counts()[Histogram::bin(1000)] ==
+               histogram.counts()[Histogram::bin(1000)] + 1);
+
+  unit_func("clear");
+
+  histogram_2.clear();
+  unit_assert (histogram_2.count() == 0);
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
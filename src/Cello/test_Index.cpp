@@ -7,6 +7,7 @@
 
 #include "main.hpp"
 #include "test.hpp"
+#include <algorithm>
 #include "mesh.hpp"
 
 // #include "charm_Index.hpp"
@@ -472,41 +473,41 @@ PARALLEL_MAIN_BEGIN
 
     I1.set_array(0,0,0);
     J1.set_array(1,0,0);
-    unit_assert(I1.next(1,array,true) == J1);
+    unit_assert(I1.next(1,array,true,0) == J1);
 
     I1.set_array(1,0,0);
     J1.set_array(0,0,0);
-    unit_assert(I1.next(1,array,true) == J1);
+    unit_assert(I1.next(1,array,true,0) == J1);
 
     // [X] level 0 2D
     I2.set_array(0,3,0);
     J2.set_array(1,3,0);
-    unit_assert(I2.next(2,array,true) == J2);
+    unit_assert(I2.next(2,array,true,0) == J2);
 
     I2.set_array(1,2,0);
     J2.set_array(0,3,0);
-    unit_assert(I2.next(2,array,true) == J2);
+    unit_assert(I2.next(2,array,true,0) == J2);
 
     I2.set_array(1,3,0);
     J2.set_array(0,0,0);
-    unit_assert(I2.next(2,array,true) == J2);
+    unit_assert(I2.next(2,array,true,0) == J2);
 
     // [X] level 0 3D
     I3.set_array(0,0,0);
     J3.set_array(1,0,0);
-    unit_assert(I3.next(3,array,true) == J3);
+    unit_assert(I3.next(3,array,true,0) == J3);
 
     I3.set_array(1,2,0);
     J3.set_array(0,3,0);
-    unit_assert(I3.next(3,array,true) == J3);
+    unit_assert(I3.next(3,array,true,0) == J3);
 
     I3.set_array(1,3,3);
     J3.set_array(0,0,4);
-    unit_assert(I3.next(3,array,true) == J3);
+    unit_assert(I3.next(3,array,true,0) == J3);
 
     I3.set_array(1,3,5);
     J3.set_array(0,0,0);
-    unit_assert(I3.next(3,array,true) == J3);
+    unit_assert(I3.next(3,array,true,0) == J3);
 
     // [X] level 1 1D
 
@@ -517,7 +518,7 @@ PARALLEL_MAIN_BEGIN
     I1.set_child(1, 0);
     J1.set_child(1, 1);
 
-    unit_assert(I1.next(1,array,true) == J1);
+    unit_assert(I1.next(1,array,true,0) == J1);
 
     //----------
 
@@ -527,7 +528,7 @@ PARALLEL_MAIN_BEGIN
     J1.set_array(1,0,0);
     I1.set_child(1, 1);
 
-    unit_assert(I1.next(1,array,true) == J1);
+    unit_assert(I1.next(1,array,true,0) == J1);
 
     // [X] level 1 2D
 
@@ -538,7 +539,7 @@ PARALLEL_MAIN_BEGIN
     I2.set_child(1, 1, 0);
     J2.set_child(1, 0, 1);
 
-    unit_assert(I2.next(2,array,true) == J2);
+    unit_assert(I2.next(2,array,true,0) == J2);
 
     //----------
 
@@ -549,7 +550,7 @@ PARALLEL_MAIN_BEGIN
     I2.set_child(1, 0, 1);
     J2.set_child(1, 1, 1);
 
-    unit_assert(I2.next(2,array,true) == J2);
+    unit_assert(I2.next(2,array,true,0) == J2);
 
     //----------
 
@@ -559,7 +560,7 @@ PARALLEL_MAIN_BEGIN
     J2.set_array(1,1,0);
     I2.set_child(1, 1, 1);
 
-    unit_assert(I2.next(2,array,true) == J2);
+    unit_assert(I2.next(2,array,true,0) == J2);
 
     //----------
 
@@ -569,7 +570,7 @@ PARALLEL_MAIN_BEGIN
     J2.set_array(0,2,0);
     I2.set_child(1, 1, 1);
 
-    unit_assert(I2.next(2,array,true) == J2);
+    unit_assert(I2.next(2,array,true,0) == J2);
 
     // [ ] level 1 3D
 
@@ -580,7 +581,7 @@ PARALLEL_MAIN_BEGIN
     I2.set_child(1, 1, 0);
     J2.set_child(1, 0, 1);
 
-    unit_assert(I2.next(3,array,true) == J2);
+    unit_assert(I2.next(3,array,true,0) == J2);
 
     //----------
 
@@ -591,7 +592,7 @@ PARALLEL_MAIN_BEGIN
     I2.set_child(1, 0,1,1);
     J2.set_child(1, 1,1,1);
 
-    unit_assert(I2.next(3,array,true) == J2);
+    unit_assert(I2.next(3,array,true,0) == J2);
 
     //----------
 
@@ -601,7 +602,7 @@ PARALLEL_MAIN_BEGIN
     J2.set_array(1,1,2);
     I2.set_child(1, 1,1,1);
 
-    unit_assert(I2.next(3,array,true) == J2);
+    unit_assert(I2.next(3,array,true,0) == J2);
 
     //----------
 
@@ -611,7 +612,7 @@ PARALLEL_MAIN_BEGIN
     J2.set_array(0,3,3);
     I2.set_child(1, 1,1,1);
 
-    unit_assert(I2.next(3,array,true) == J2);
+    unit_assert(I2.next(3,array,true,0) == J2);
 
     // [ ] level 2 1D
 
@@ -655,6 +656,87 @@ PARALLEL_MAIN_BEGIN
 
   }
 
+  //==================================================
+  // Morton keys
+  //==================================================
+
+  {
+    unit_func ("morton_interleave");
+
+    static_assert (Index::morton_interleave(1,1,1) == 7,
+                   "morton_interleave() failed");
+    static_assert (Index::morton_interleave(0x1fffff,0,0)
+                   == 0x1249249249249249ull,
+                   "morton_interleave() failed");
+    static_assert (Index::morton_deinterleave
+                   (Index::morton_interleave(5,17,0x1fffff),2) == 0x1fffff,
+                   "morton_deinterleave() failed");
+    unit_assert (Index::morton_interleave(1,0,0) == 1);
+    unit_assert (Index::morton_interleave(0,1,0) == 2);
+    unit_assert (Index::morton_interleave(0,0,1) == 4);
+    unit_assert (Index::morton_interleave(2,0,0) == 8);
+
+    unit_func ("morton_key");
+
+    // round trip, including a non-zero array index and level < 0
+
+    bool l_round_trip = true;
+    for (int i=0; i<N+1; i++) {
+      Index index = i8[i];
+      index.set_array(5,1023,2);
+      Index index_key;
+      index_key.set_morton_key(index.morton_key());
+      l_round_trip = l_round_trip && (index_key == index);
+    }
+    Index index_sub(6,2,4);
+    index_sub.set_level(-1);
+    Index index_key;
+    index_key.set_morton_key(index_sub.morton_key());
+    l_round_trip = l_round_trip && (index_key == index_sub);
+    unit_assert (l_round_trip);
+
+    // Morton order: ancestors first, then children with x fastest
+
+    bool l_order = true;
+    for (int i=0; i<N; i++) {
+      l_order = l_order && Index::morton_less(i8[i],i8[i+1]);
+      l_order = l_order && ! Index::morton_less(i8[i+1],i8[i]);
+    }
+    Index index_root(1,1,1);
+    std::vector<Index> children;
+    for (int ic=7; ic>=0; ic--) {
+      children.push_back(index_root.index_child(ic&1,(ic>>1)&1,(ic>>2)&1));
+    }
+    children.push_back(index_root);
+    std::sort(children.begin(),children.end(),Index::morton_less);
+    l_order = l_order && (children[0] == index_root);
+    for (int ic=0; ic<8; ic++) {
+      l_order = l_order &&
+        (children[ic+1] == index_root.index_child(ic&1,(ic>>1)&1,(ic>>2)&1));
+    }
+    unit_assert (l_order);
+
+    unit_func ("is_ancestor");
+
+    bool l_ancestor = true;
+    for (int i=0; i<N+1; i++) {
+      for (int l=0; l<N+1; l++) {
+        l_ancestor = l_ancestor && (i8[i].is_ancestor(i8[l]) == (l < i));
+        l_ancestor = l_ancestor && (i8[i].is_descendant(i8[l]) == (l > i));
+      }
+    }
+    unit_assert (l_ancestor);
+    unit_assert (! i8[N].is_ancestor(Index(1,0,0)));
+    unit_assert (! children[1].is_ancestor(children[2]));
+    unit_assert (children[8].is_ancestor(index_root));
+
+    unit_func ("is_in_same_subtree");
+
+    unit_assert (children[1].is_in_same_subtree(children[8],0,0));
+    unit_assert (children[1].is_in_same_subtree(children[1],0,1));
+    unit_assert (! children[1].is_in_same_subtree(children[8],0,1));
+    unit_assert (! children[1].is_in_same_subtree(i8[2],0,0));
+  }
 
   unit_finalize();
   exit_();
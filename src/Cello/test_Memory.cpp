@@ -245,6 +245,46 @@ PARALLEL_MAIN_BEGIN
   unit_assert(true);
 #endif/* CONFIG_USE_MEMORY */
 
+  //----------------------------------------------------------------------
+  // category accounting (independent of CONFIG_USE_MEMORY)
+  //----------------------------------------------------------------------
+
+  const int ic = memory_category_scratch;
+  const int64_t bytes_start = Memory::category_bytes(ic);
+  Memory::category_reset_high();
+
+  {
+    MemoryAccount account;
+
+    unit_func ("MemoryAccount::set()");
+    account.set (ic,1000);
+    unit_assert (account.bytes(ic) == 1000);
+    unit_assert (Memory::category_bytes(ic) == bytes_start + 1000);
+    account.set (ic,400);
+    unit_assert (Memory::category_bytes(ic) == bytes_start + 400);
+
+    unit_func ("MemoryAccount::add()");
+    account.add (ic,100);
+    unit_assert (account.bytes(ic) == 500);
+    unit_assert (Memory::category_bytes(ic) == bytes_start + 500);
+
+    unit_func ("category_bytes_high()");
+    unit_assert (Memory::category_bytes_high(ic) == bytes_start + 1000);
+    Memory::category_reset_high();
+    unit_assert (Memory::category_bytes_high(ic) == bytes_start + 500);
+
+    unit_func ("MemoryAccount(const MemoryAccount &)");
+    MemoryAccount account_copy (account);
+    unit_assert (account_copy.bytes(ic) == 0);
+    unit_assert (Memory::category_bytes(ic) == bytes_start + 500);
+  }
+
+  unit_func ("~MemoryAccount()");
+  unit_assert (Memory::category_bytes(ic) == bytes_start);
+
+  unit_func ("category_name()");
+  unit_assert (strcmp(Memory::category_name(ic),"scratch") == 0);
+
   unit_finalize();
 
   exit_();
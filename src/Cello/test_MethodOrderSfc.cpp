@@ -0,0 +1,227 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_MethodOrderSfc.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Test program for the ordering computed by MethodOrderSfc
+
+#include "main.hpp"
+#include "test.hpp"
+#include <algorithm>
+#include <map>
+#include <random>
+#include "mesh.hpp"
+#include "problem.hpp"
+
+//----------------------------------------------------------------------
+
+/// Whether the Block with the given Index is refined: refine the
+/// first and last root Blocks to level 2, and one child of each
+/// further to level 3
+bool is_refined (Index index)
+{
+  const int level = index.level();
+  int ia3[3];
+  index.array(ia3,ia3+1,ia3+2);
+  const bool is_first = (ia3[0]==0 && ia3[1]==0 && ia3[2]==0);
+  const bool is_last  = (ia3[0]==3 && ia3[1]==1 && ia3[2]==1);
+  if (! (is_first || is_last)) return false;
+  if (level < 2) return true;
+  if (level == 2) {
+    int ic3[3];
+    index.child(level,ic3,ic3+1,ic3+2);
+    return (ic3[0]==1 && ic3[1]==0 && ic3[2]==1);
+  }
+  return false;
+}
+
+//----------------------------------------------------------------------
+
+/// Append the Block and its descendents in depth-first order,
+/// visiting children with x varying fastest
+void traverse (Index index, std::vector<Index> & index_list)
+{
+  index_list.push_back(index);
+  if (is_refined(index)) {
+    for (int icz=0; icz<2; icz++) {
+      for (int icy=0; icy<2; icy++) {
+        for (int icx=0; icx<2; icx++) {
+          traverse (index.index_child(icx,icy,icz),index_list);
+        }
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Order the Blocks as MethodOrderSfc does: sum the histogram, gather
+/// each bin at its first Block, and order it.  Return whether each
+/// Block gets its position in index_expected and the next Block
+bool check_histogram
+(const MortonHistogram & histogram, const std::vector<Index> & index_expected)
+{
+  const int count = index_expected.size();
+
+  std::vector<int> counts (histogram.num_bins(),0);
+  std::map<Index, std::vector<MortonKey> > gathered;
+  for (const Index & index : index_expected) {
+    const int bin = histogram.bin(index);
+    ++counts[bin];
+    gathered[histogram.collector(bin)].push_back(index.morton_key());
+  }
+
+  bool l_equal = true;
+  for (auto & it_bin : gathered) {
+    const Index index_collector = it_bin.first;
+    const int bin = histogram.bin(index_collector);
+
+    long long offset, total;
+    int bin_next;
+    histogram.locate (counts.data(), bin, &offset, &total, &bin_next);
+    l_equal = l_equal && (total == count);
+    l_equal = l_equal && (int(it_bin.second.size()) == counts[bin]);
+
+    std::vector<Index> index_list;
+    MethodOrderSfc::order
+      (it_bin.second.size(), it_bin.second.data(), index_list);
+
+    // the first Block of the bin is the one the others send to
+
+    l_equal = l_equal && (index_list[0] == index_collector);
+
+    const int n = index_list.size();
+    for (int i=0; i<n; i++) {
+      const Index index_next = (i + 1 < n) ?
+        index_list[i + 1] : histogram.collector(bin_next);
+      const long long position = offset + i;
+      l_equal = l_equal && (index_list[i] == index_expected[position]);
+      l_equal = l_equal &&
+        (index_next == index_expected[(position + 1) % count]);
+    }
+  }
+  return l_equal;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("MethodOrderSfc");
+
+  // expected ordering: root Blocks of a 4x2x2 array along the Morton
+  // curve (bits of x, y and z interleaved with x lowest), each
+  // followed by its descendents
+
+  const int na3[3] = {4,2,2};
+  std::vector<Index> index_expected;
+  for (int m=0; m<64; m++) {
+    int ia3[3] = {0,0,0};
+    for (int bit=0; bit<2; bit++) {
+      ia3[0] |= ((m >> (3*bit    )) & 1) << bit;
+      ia3[1] |= ((m >> (3*bit + 1)) & 1) << bit;
+      ia3[2] |= ((m >> (3*bit + 2)) & 1) << bit;
+    }
+    if (ia3[0] < na3[0] && ia3[1] < na3[1] && ia3[2] < na3[2]) {
+      traverse (Index(ia3[0],ia3[1],ia3[2]),index_expected);
+    }
+  }
+
+  const int count = index_expected.size();
+
+  // 16 root Blocks, 2 x (8 + 64) descendents, 2 x 8 at level 3
+  unit_func("count");
+  unit_assert (count == 16 + 2*(8 + 64) + 2*8);
+
+  // keys in an arbitrary order, as received from the reduction
+
+  std::vector<MortonKey> keys (count);
+  for (int i=0; i<count; i++) keys[i] = index_expected[i].morton_key();
+  std::mt19937 generator (1);
+  std::shuffle (keys.begin(), keys.end(), generator);
+
+  std::vector<Index> index_list;
+  MethodOrderSfc::order (count, keys.data(), index_list);
+
+  unit_func("order");
+  unit_assert (int(index_list.size()) == count);
+  bool l_equal = (int(index_list.size()) == count);
+  for (int i=0; l_equal && i<count; i++) {
+    l_equal = (index_list[i] == index_expected[i]);
+  }
+  unit_assert (l_equal);
+
+  // ordering agrees with Index::morton_less()
+
+  std::vector<Index> index_sorted = index_expected;
+  std::shuffle (index_sorted.begin(), index_sorted.end(), generator);
+  std::sort (index_sorted.begin(), index_sorted.end(), Index::morton_less);
+  unit_assert (index_sorted == index_list);
+
+  // single Block
+
+  unit_func("order (single)");
+  MortonKey key = Index(1,0,1).morton_key();
+  MethodOrderSfc::order (1, &key, index_list);
+  unit_assert (index_list.size() == 1 && index_list[0] == Index(1,0,1));
+
+  // histogram bins, from one per root Block down to the finest level,
+  // and with several root Blocks per bin
+
+  unit_class("MortonHistogram");
+
+  unit_func("bin_level");
+
+  MortonHistogram histogram_root   (3,na3,0,3,16);
+  MortonHistogram histogram_1      (3,na3,0,3,200);
+  MortonHistogram histogram_2      (3,na3,0,3,4096);
+  MortonHistogram histogram_finest (3,na3,0,3,100000);
+  MortonHistogram histogram_group  (3,na3,0,3,5);
+
+  unit_assert (histogram_root.bin_level() == 0);
+  unit_assert (histogram_root.num_bins() == 16);
+  unit_assert (histogram_1.bin_level() == 1);
+  unit_assert (histogram_1.num_bins() == 16*9);
+  unit_assert (histogram_2.bin_level() == 2);
+  unit_assert (histogram_2.num_bins() == 16*73);
+  unit_assert (histogram_finest.bin_level() == 3);
+  unit_assert (histogram_group.bin_level() == 0);
+  unit_assert (histogram_group.num_bins() == 4);
+
+  unit_func("locate");
+
+  unit_assert (check_histogram(histogram_root,   index_expected));
+  unit_assert (check_histogram(histogram_1,      index_expected));
+  unit_assert (check_histogram(histogram_2,      index_expected));
+  unit_assert (check_histogram(histogram_finest, index_expected));
+  unit_assert (check_histogram(histogram_group,  index_expected));
+
+  // Blocks coarser than the root level: two level -1 Blocks, each the
+  // parent of 2x2x2 root Blocks
+
+  unit_func("locate (min_level < 0)");
+
+  std::vector<Index> index_coarse = index_expected;
+  index_coarse.push_back(Index(0,0,0).index_ancestor(-1,-1));
+  index_coarse.push_back(Index(2,0,0).index_ancestor(-1,-1));
+  std::sort (index_coarse.begin(), index_coarse.end(), Index::morton_less);
+  unit_assert (index_coarse[0] == Index(0,0,0).index_ancestor(-1,-1));
+
+  MortonHistogram histogram_coarse_top (3,na3,-1,3,2);
+  MortonHistogram histogram_coarse     (3,na3,-1,3,50);
+  unit_assert (histogram_coarse_top.num_bins() == 2);
+  unit_assert (histogram_coarse.bin_level() == 0);
+  unit_assert (check_histogram(histogram_coarse_top, index_coarse));
+  unit_assert (check_histogram(histogram_coarse,     index_coarse));
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -66,6 +66,17 @@ PARALLEL_MAIN_BEGIN
   unit_assert (id_counter_1 != id_counter_flops);
   unit_assert (id_counter_2 != id_counter_flops);
 
+  unit_func("set_method_counters");
+
+  performance->set_method_counters
+    ({"PAPI_FP_OPS","PAPI_L3_TCM","PAPI_TOT_CYC"});
+  const int num_method_counters = performance->num_method_counters();
+#ifdef CONFIG_USE_PAPI
+  unit_assert (num_method_counters == 0 || num_method_counters == 3);
+#else
+  unit_assert (num_method_counters == 0);
+#endif
+
   unit_func("num_counters");
 
   int num_counters = performance->num_counters();
@@ -153,6 +164,21 @@ PARALLEL_MAIN_BEGIN
     }
   }
 
+  unit_func("stop_method_counters");
+
+  for (int i=0; i<2; i++) {
+    performance->start_method_counters();
+    sleep_flop (0,1000000);
+    performance->stop_method_counters(1,1000);
+  }
+  if (num_method_counters > 0) {
+    const long long * method_counters = performance->method_counters(1);
+    unit_assert (method_counters[num_method_counters] == 2000);
+    unit_assert (method_counters[0] >= 0);
+  } else {
+    unit_assert (true);
+  }
+
   delete performance;
 
   unit_finalize();
@@ -221,6 +221,159 @@ PARALLEL_MAIN_BEGIN
     }
   }
 
+  //--------------------------------------------------
+
+  // compare specialized 3D kernel against the generic kernel
+
+  ProlongLinear * prolong_generic = new ProlongLinear(false);
+
+  for (int accumulate=0; accumulate<2; accumulate++) {
+    for (int g=0; g<2; g++) {
+      char buffer[40+1];
+      snprintf (buffer,40,"apply() 3D specialized (%d,%d)",g,accumulate);
+      unit_func (buffer);
+
+      m3_f[0] = 20;  m3_c[0] = 14;
+      m3_f[1] = 22;  m3_c[1] = 13;
+      m3_f[2] = 24;  m3_c[2] = 15;
+
+      i3_f[0] = 2;  i3_c[0] = 1;
+      i3_f[1] = 3;  i3_c[1] = 1;
+      i3_f[2] = 1;  i3_c[2] = 1;
+
+      n3_f[0] = 16; n3_c[0] = 8+2*(1-g);
+      n3_f[1] = 16; n3_c[1] = 8+2*(1-g);
+      n3_f[2] = 18; n3_c[2] = 9+2*(1-g);
+
+      const int mc = m3_c[0]*m3_c[1]*m3_c[2];
+      const int mf = m3_f[0]*m3_f[1]*m3_f[2];
+
+      double * v_c_d = new double [mc];
+      double * v_f_d = new double [mf];
+      double * w_f_d = new double [mf];
+      float  * v_c_s = new float [mc];
+      float  * v_f_s = new float [mf];
+      float  * w_f_s = new float [mf];
+
+      for (int i=0; i<mc; i++) {
+        v_c_s[i] = v_c_d[i] = sin(0.37*i) + 0.001*i;
+      }
+      for (int i=0; i<mf; i++) {
+        v_f_s[i] = w_f_s[i] = v_f_d[i] = w_f_d[i] = cos(0.23*i);
+      }
+
+      prolong->apply (precision_double,
+                      v_f_d, m3_f, i3_f, n3_f,
+                      v_c_d, m3_c, i3_c, n3_c, accumulate);
+      prolong_generic->apply (precision_double,
+                              w_f_d, m3_f, i3_f, n3_f,
+                              v_c_d, m3_c, i3_c, n3_c, accumulate);
+      prolong->apply (precision_single,
+                      v_f_s, m3_f, i3_f, n3_f,
+                      v_c_s, m3_c, i3_c, n3_c, accumulate);
+      prolong_generic->apply (precision_single,
+                              w_f_s, m3_f, i3_f, n3_f,
+                              v_c_s, m3_c, i3_c, n3_c, accumulate);
+
+      bool l_equal = true;
+      for (int i=0; i<mf; i++) {
+        l_equal = l_equal && (v_f_d[i] == w_f_d[i]) && (v_f_s[i] == w_f_s[i]);
+      }
+      unit_assert (l_equal);
+
+      delete [] v_c_d;
+      delete [] v_f_d;
+      delete [] w_f_d;
+      delete [] v_c_s;
+      delete [] v_f_s;
+      delete [] w_f_s;
+    }
+  }
+
+  delete prolong_generic;
+
+  //--------------------------------------------------
+
+  // face-only mode matches the full kernel next to the faces of the
+  // fine region and leaves its interior untouched
+
+  const int face_depth = 3;
+  ProlongLinear * prolong_face = new ProlongLinear(true,face_depth);
+
+  for (int accumulate=0; accumulate<2; accumulate++) {
+    char buffer[40+1];
+    snprintf (buffer,40,"apply() 3D face-only (%d)",accumulate);
+    unit_func (buffer);
+
+    m3_f[0] = 20;  m3_c[0] = 14;
+    m3_f[1] = 22;  m3_c[1] = 13;
+    m3_f[2] = 24;  m3_c[2] = 15;
+
+    i3_f[0] = 2;  i3_c[0] = 1;
+    i3_f[1] = 3;  i3_c[1] = 1;
+    i3_f[2] = 1;  i3_c[2] = 1;
+
+    n3_f[0] = 16; n3_c[0] = 10;
+    n3_f[1] = 16; n3_c[1] = 10;
+    n3_f[2] = 18; n3_c[2] = 11;
+
+    const int mc = m3_c[0]*m3_c[1]*m3_c[2];
+    const int mf = m3_f[0]*m3_f[1]*m3_f[2];
+
+    double * v_c = new double [mc];
+    double * v_f = new double [mf];
+    double * w_f = new double [mf];
+    double * u_f = new double [mf];
+
+    for (int i=0; i<mc; i++) v_c[i] = sin(0.37*i) + 0.001*i;
+    for (int i=0; i<mf; i++) u_f[i] = v_f[i] = w_f[i] = cos(0.23*i);
+
+    prolong->apply (precision_double,
+                    w_f, m3_f, i3_f, n3_f,
+                    v_c, m3_c, i3_c, n3_c, accumulate);
+    prolong_face->apply (precision_double,
+                         v_f, m3_f, i3_f, n3_f,
+                         v_c, m3_c, i3_c, n3_c, accumulate);
+
+    bool l_face = true;
+    bool l_interior = true;
+    int count_face = 0;
+    for (int iz=0; iz<m3_f[2]; iz++) {
+      for (int iy=0; iy<m3_f[1]; iy++) {
+        for (int ix=0; ix<m3_f[0]; ix++) {
+          const int i = ix + m3_f[0]*(iy + m3_f[1]*iz);
+          const int jx = ix-i3_f[0];
+          const int jy = iy-i3_f[1];
+          const int jz = iz-i3_f[2];
+          const bool in_region =
+            (0 <= jx && jx < n3_f[0]) &&
+            (0 <= jy && jy < n3_f[1]) &&
+            (0 <= jz && jz < n3_f[2]);
+          const bool in_interior =
+            (face_depth <= jx && jx < n3_f[0]-face_depth) &&
+            (face_depth <= jy && jy < n3_f[1]-face_depth) &&
+            (face_depth <= jz && jz < n3_f[2]-face_depth);
+          if (in_region && ! in_interior) {
+            ++count_face;
+            l_face = l_face && (v_f[i] == w_f[i]);
+          } else {
+            l_interior = l_interior && (v_f[i] == u_f[i]);
+          }
+        }
+      }
+    }
+    unit_assert (count_face > 0);
+    unit_assert (l_face);
+    unit_assert (l_interior);
+
+    delete [] v_c;
+    delete [] v_f;
+    delete [] w_f;
+    delete [] u_f;
+  }
+
+  delete prolong_face;
+
   //--------------------------------------------------
   
   delete prolong;
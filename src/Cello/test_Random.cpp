@@ -0,0 +1,95 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_Random.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Test program for the Random class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "cello.hpp"
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("Random");
+
+  unit_func("philox4x32_10");
+
+  // known-answer tests from the Random123 distribution
+
+  uint32_t c1[4] = {0,0,0,0};
+  Random::philox4x32_10 (c1, 0, 0);
+  unit_assert (c1[0] == 0x6627e8d5u && c1[1] == 0xe169c58du &&
+               c1[2] == 0xbc57ac4cu && c1[3] == 0x9b00dbd8u);
+
+  uint32_t c2[4] = {0xffffffffu,0xffffffffu,0xffffffffu,0xffffffffu};
+  Random::philox4x32_10 (c2, 0xffffffffu, 0xffffffffu);
+  unit_assert (c2[0] == 0x408f276du && c2[1] == 0x41c83b0eu &&
+               c2[2] == 0xa20bc7c6u && c2[3] == 0x6d5451fdu);
+
+  uint32_t c3[4] = {0x243f6a88u,0x85a308d3u,0x13198a2eu,0x03707344u};
+  Random::philox4x32_10 (c3, 0xa4093822u, 0x299f31d0u);
+  unit_assert (c3[0] == 0xd16cfe09u && c3[1] == 0x94fdccebu &&
+               c3[2] == 0x5001e420u && c3[3] == 0x24126ea1u);
+
+  unit_func("uniform");
+
+  const Random random (12345, Random::stream("star_maker"), 7);
+  const int n = 100000;
+
+  // values do not depend on the order in which they are drawn
+
+  bool in_range = true;
+  bool order_independent = true;
+  double sum = 0.0;
+  for (int i=0; i<n; i++) {
+    const double u = random.uniform(i);
+    in_range = in_range && (0.0 <= u && u < 1.0);
+    order_independent = order_independent &&
+      (u == random.uniform(i)) &&
+      (random.uniform(n-1-i) == Random(random).uniform(n-1-i));
+    sum += u;
+  }
+  unit_assert (in_range);
+  unit_assert (order_independent);
+  unit_assert (std::abs(sum/n - 0.5) < 0.01);
+
+  // different draws, streams, positions, and seeds are independent
+
+  const Random random_stream (12345, Random::stream("feedback"), 7);
+  const Random random_position (12345, Random::stream("star_maker"), 8);
+  const Random random_seed (12346, Random::stream("star_maker"), 7);
+
+  int num_equal = 0;
+  for (int i=0; i<n; i++) {
+    const double u = random.uniform(i);
+    num_equal += (u == random.uniform(i,1));
+    num_equal += (u == random_stream.uniform(i));
+    num_equal += (u == random_position.uniform(i));
+    num_equal += (u == random_seed.uniform(i));
+  }
+  unit_assert (num_equal == 0);
+
+  unit_func("normal");
+
+  double sum_1 = 0.0, sum_2 = 0.0;
+  for (int i=0; i<n; i++) {
+    const double x = random.normal(i);
+    sum_1 += x;
+    sum_2 += x*x;
+  }
+  unit_assert (std::abs(sum_1/n) < 0.02);
+  unit_assert (std::abs(sum_2/n - 1.0) < 0.02);
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
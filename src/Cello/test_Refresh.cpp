@@ -51,6 +51,50 @@ PARALLEL_MAIN_BEGIN
 
   //--------------------------------------------------
 
+  unit_func ("changed_fields()");
+
+  std::vector<int> state = { 3, 5, 7, -1 };
+  std::vector<int> state_sent;
+  const std::vector<int> fields = { 0, 1, 3 };
+
+  // everything is sent the first time, and fields with unknown state
+  // every time
+
+  unit_assert (Refresh::changed_fields(fields,state,state_sent) == fields);
+  unit_assert (Refresh::changed_fields(fields,state,state_sent)
+               == std::vector<int>({3}));
+  state[1] = 6;
+  unit_assert (Refresh::changed_fields(fields,state,state_sent)
+               == std::vector<int>({1,3}));
+
+  // fields not in the list are neither sent nor updated
+
+  state[2] = 8;
+  unit_assert (Refresh::changed_fields({0,1},state,state_sent).empty());
+  unit_assert (Refresh::changed_fields({2},state,state_sent)
+               == std::vector<int>({2}));
+
+  // neighbors with different counts but the same changes since they
+  // last exchanged agree on whether to skip
+
+  std::vector<int> count_a = { 10, 4 }, count_b = { 0, 0 };
+  std::vector<int> sent_a, sent_b;
+  const std::vector<int> fields_ab = { 0, 1 };
+  bool l_agree = true;
+  for (int step=0; step<8; step++) {
+    if (step % 3 == 1) { ++count_a[0]; ++count_b[0]; }
+    if (step % 4 == 2) { ++count_a[1]; ++count_b[1]; }
+    const bool skip_a =
+      Refresh::changed_fields(fields_ab,count_a,sent_a).empty();
+    const bool skip_b =
+      Refresh::changed_fields(fields_ab,count_b,sent_b).empty();
+    const bool changed = (step == 0) || (step % 3 == 1) || (step % 4 == 2);
+    l_agree = l_agree && (skip_a == skip_b) && (skip_a == ! changed);
+  }
+  unit_assert (l_agree);
+
+  //--------------------------------------------------
+
   delete refresh;
 
   unit_finalize();
@@ -0,0 +1,100 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_Scratch.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Test program for the Scratch and ScratchFrame classes
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "memory.hpp"
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("Scratch");
+
+  Scratch * scratch = Scratch::instance();
+
+  unit_func("instance");
+  unit_assert (scratch != nullptr);
+  unit_assert (scratch == Scratch::instance());
+  unit_assert (scratch->bytes() == 0);
+
+  unit_func("allocate");
+
+  const size_t mark = scratch->mark();
+  double * a = scratch->allocate<double>(1000);
+  int    * b = scratch->allocate<int>(10);
+  unit_assert (a != nullptr && b != nullptr);
+  unit_assert (((uintptr_t)a) % 64 == 0);
+  unit_assert (((uintptr_t)b) % 64 == 0);
+  unit_assert ((char *)b >= (char *)(a + 1000));
+  unit_assert (scratch->bytes() >= 1000*sizeof(double) + 10*sizeof(int));
+
+  unit_func("allocate_zero");
+  float * c = scratch->allocate_zero<float>(100);
+  bool is_zero = true;
+  for (int i=0; i<100; i++) is_zero = is_zero && (c[i] == 0.0f);
+  unit_assert (is_zero);
+
+  unit_func("rewind");
+  scratch->rewind(mark);
+  unit_assert (scratch->bytes() == mark);
+  double * a2 = scratch->allocate<double>(1000);
+  unit_assert (a2 == a);
+  scratch->rewind(mark);
+
+  unit_func("bytes_reserved");
+
+  // allocations larger than the reserved memory add a chunk; after
+  // the arena empties it is consolidated into a single chunk
+
+  const size_t reserved = scratch->bytes_reserved();
+  const size_t n_large = reserved / sizeof(double) + 1;
+  double * d = scratch->allocate<double>(100);
+  double * e = scratch->allocate<double>(n_large);
+  unit_assert (d != nullptr && e != nullptr);
+  d[99] = 1.0;
+  e[n_large-1] = 2.0;
+  unit_assert (d[99] == 1.0 && e[n_large-1] == 2.0);
+  unit_assert (scratch->bytes_reserved() > reserved);
+  scratch->rewind(0);
+  unit_assert (scratch->bytes() == 0);
+  unit_assert (scratch->bytes_high() >= n_large*sizeof(double));
+  const size_t reserved_high = scratch->bytes_reserved();
+  unit_assert (reserved_high >= scratch->bytes_high());
+  double * f = scratch->allocate<double>(100);
+  double * g = scratch->allocate<double>(n_large);
+  unit_assert (f != nullptr && g != nullptr);
+  unit_assert (scratch->bytes_reserved() == reserved_high);
+  scratch->rewind(0);
+
+  unit_class("ScratchFrame");
+
+  unit_func("~ScratchFrame");
+  {
+    ScratchFrame frame;
+    double * h = frame.allocate<double>(64);
+    unit_assert (h != nullptr);
+    unit_assert (scratch->bytes() > 0);
+    {
+      ScratchFrame frame_inner;
+      int * k = frame_inner.allocate_zero<int>(64);
+      unit_assert (k != nullptr && k[63] == 0);
+    }
+    unit_assert (scratch->bytes() == 64*sizeof(double));
+  }
+  unit_assert (scratch->bytes() == 0);
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
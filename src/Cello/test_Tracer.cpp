@@ -0,0 +1,88 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_Tracer.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Unit tests for the Tracer class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "performance.hpp"
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("Tracer");
+
+  unit_func("instance");
+
+  Tracer * tracer = Tracer::instance();
+  unit_assert (tracer != NULL);
+  unit_assert (tracer == Tracer::instance());
+  unit_assert (! tracer->is_active());
+
+  // events are ignored when disabled
+
+  tracer->begin("phase",1);
+  unit_assert (tracer->num_events() == 0);
+
+  unit_func("initialize");
+
+  tracer->initialize(4);
+  unit_assert (tracer->is_active());
+  unit_assert (tracer->num_events() == 0);
+
+  unit_func("begin");
+
+  tracer->begin("phase",1);
+  tracer->end("phase",1);
+  tracer->instant("message",2);
+  unit_assert (tracer->num_events() == 3);
+  unit_assert (tracer->num_dropped() == 0);
+
+  unit_func("complete");
+
+  // ring buffer keeps the most recent events
+
+  const char * name = tracer->intern(std::string("method"));
+  unit_assert (name == tracer->intern("method"));
+  tracer->complete(name,3,1000,2000);
+  tracer->complete(name,3,4000,2000);
+  unit_assert (tracer->num_events() == 4);
+  unit_assert (tracer->num_dropped() == 1);
+
+  unit_func("write");
+
+  FILE * fp = tmpfile();
+  tracer->write(fp,0,0);
+  rewind(fp);
+  std::string json;
+  char buffer[256];
+  while (fgets(buffer,sizeof(buffer),fp)) json += buffer;
+  fclose(fp);
+  unit_assert (json.find("\"traceEvents\"") != std::string::npos);
+  unit_assert (json.find("\"ph\":\"e\"") != std::string::npos);
+  unit_assert (json.find("\"ph\":\"b\"") == std::string::npos);
+  unit_assert (json.find("\"ts\":4.000") != std::string::npos);
+  unit_assert (json.find("\"dur\":2.000") != std::string::npos);
+  unit_assert (json.find("\"dropped\":\"1\"") != std::string::npos);
+
+  unit_func("clear");
+
+  tracer->clear();
+  unit_assert (tracer->num_events() == 0);
+  unit_assert (tracer->is_active());
+  tracer->initialize(0);
+  unit_assert (! tracer->is_active());
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
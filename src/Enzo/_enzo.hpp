@@ -253,8 +253,10 @@ extern "C" {
 #include "enzo_EnzoMethodCosmology.hpp"
 #include "enzo_EnzoMethodDistributedFeedback.hpp"
 #include "enzo_EnzoMethodFeedback.hpp"
+#include "enzo_EnzoFeedbackRateTable.hpp"
 #include "enzo_EnzoMethodFeedbackSTARSS.hpp"
 #include "enzo_EnzoMethodFluxAccretion.hpp"
+#include "enzo_EnzoGrackleCoolingTable.hpp"
 #include "enzo_EnzoMethodGrackle.hpp"
 #include "enzo_EnzoMethodGravity.hpp"
 #include "enzo_EnzoMethodHeat.hpp"
@@ -273,6 +275,7 @@ extern "C" {
 #include "enzo_EnzoMethodMHDVlct.hpp"
 #include "enzo_EnzoMethodM1Closure.hpp"
 #include "enzo_EnzoMethodThresholdAccretion.hpp"
+#include "enzo_EnzoTurbulenceDrivingOU.hpp"
 #include "enzo_EnzoMethodTurbulence.hpp"
 
 #include "enzo_EnzoMatrixDiagonal.hpp"
@@ -285,6 +288,7 @@ extern "C" {
 #include "enzo_EnzoComputeCicInterp.hpp"
 #include "enzo_EnzoComputePressure.hpp"
 #include "enzo_EnzoComputeTemperature.hpp"
+#include "enzo_EnzoDerivedFields.hpp"
 #ifdef CONFIG_USE_GRACKLE
   #include "enzo_EnzoComputeCoolingTime.hpp"
 #endif
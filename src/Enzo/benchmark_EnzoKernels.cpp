@@ -0,0 +1,225 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     benchmark_EnzoKernels.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Benchmark of Enzo hydro and gravity kernels on synthetic blocks
+///
+/// Usage: benchmark_enzo_kernels [ block-size [ iterations [ json-file ] ] ]
+///
+/// Times the EnzoReconstructor variants, the HLL, HLLC and HLLD
+/// Riemann solvers, and the EnzoMatrixLaplace matrix-vector product
+/// on synthetic blocks with ghost zones, without running a
+/// Simulation, and reports ns/cell and GB/s, optionally writing them
+/// to a JSON file.
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+#define CK_TEMPLATES_ONLY
+#include "enzo.def.h"
+#undef CK_TEMPLATES_ONLY
+
+//----------------------------------------------------------------------
+
+/// Fill arrays of a map with smooth, physically valid values
+void fill_map_ (EnzoEFltArrayMap & map, const str_vec_t & keys, double a)
+{
+  for (std::size_t i=0; i<keys.size(); i++) {
+    const std::string & key = keys[i];
+    const bool positive = (key == "density" || key == "pressure" ||
+                           key == "total_energy" ||
+                           key == "internal_energy");
+    const double v0 = positive ? 1.0 : (key.find("bfield") == 0 ? 0.5 : 0.0);
+    CelloArray<enzo_float,3> array = map[key];
+    const int mz = array.shape(0);
+    const int my = array.shape(1);
+    const int mx = array.shape(2);
+    for (int iz=0; iz<mz; iz++) {
+      for (int iy=0; iy<my; iy++) {
+        for (int ix=0; ix<mx; ix++) {
+          array(iz,iy,ix) = v0 + 0.1*sin(a*(ix + 3*iy + 7*iz + i));
+        }
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Shape of a cell-centered array with one fewer entry along dim
+std::array<int,3> face_shape_ (int m, int dim)
+{
+  std::array<int,3> shape = {{m,m,m}};
+  shape[2-dim] -= 1;
+  return shape;
+}
+
+//----------------------------------------------------------------------
+
+void benchmark_reconstructor_ (Benchmark & benchmark, int nb, int ni)
+{
+  const int ng = 3;
+  const int m = nb + 2*ng;
+  const std::array<int,3> shape = {{m,m,m}};
+
+  const str_vec_t keys = {"density", "velocity_x", "velocity_y",
+                          "velocity_z", "pressure"};
+  const str_vec_t passive_list;
+  EnzoEOSIdeal eos (5.0/3.0, 1e-30, 1e-30, false, 0.0);
+
+  EnzoEFltArrayMap prim_map ("primitive",keys,shape);
+  fill_map_ (prim_map,keys,0.37);
+
+  const char * names[] = {"nn", "plm", "plm_athena"};
+  for (int i_r=0; i_r<3; i_r++) {
+
+    EnzoReconstructor * reconstructor =
+      EnzoReconstructor::construct_reconstructor(keys,names[i_r],2.0);
+
+    Timer timer;
+    for (int dim=0; dim<3; dim++) {
+      EnzoEFltArrayMap priml_map ("priml",keys,face_shape_(m,dim));
+      EnzoEFltArrayMap primr_map ("primr",keys,face_shape_(m,dim));
+      for (int iter=0; iter<ni; iter++) {
+        timer.start();
+        reconstructor->reconstruct_interface
+          (prim_map,priml_map,primr_map,dim,&eos,0,passive_list);
+        timer.stop();
+      }
+    }
+    delete reconstructor;
+
+    // per dimension: read cell values and write left and right faces
+
+    const double cells = 3.0*ni*m*m*m;
+    const double bytes = 3.0*cells*keys.size()*sizeof(enzo_float);
+    benchmark.add (std::string("reconstructor:") + names[i_r],
+                   timer.value(), cells, bytes);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void benchmark_riemann_ (Benchmark & benchmark, int nb, int ni)
+{
+  const int ng = 3;
+  const int m = nb + 2*ng;
+
+  const str_vec_t passive_list;
+  EnzoEOSIdeal eos (5.0/3.0, 1e-30, 1e-30, false, 0.0);
+
+  const char * names[] = {"hll", "hllc", "hlld"};
+  const bool   mhd[]   = {true,  false,  true};
+  for (int i_r=0; i_r<3; i_r++) {
+
+    EnzoRiemann::FactoryArgs args = {names[i_r], mhd[i_r], false};
+    EnzoRiemann * riemann = EnzoRiemann::construct_riemann(args);
+    const str_vec_t prim_keys = riemann->primitive_quantity_keys();
+    const str_vec_t flux_keys = riemann->integration_quantity_keys();
+
+    Timer timer;
+    for (int dim=0; dim<3; dim++) {
+      const std::array<int,3> shape = face_shape_(m,dim);
+      EnzoEFltArrayMap priml_map ("priml",prim_keys,shape);
+      EnzoEFltArrayMap primr_map ("primr",prim_keys,shape);
+      EnzoEFltArrayMap flux_map  ("flux", flux_keys,shape);
+      fill_map_ (priml_map,prim_keys,0.37);
+      fill_map_ (primr_map,prim_keys,0.41);
+      for (int iter=0; iter<ni; iter++) {
+        timer.start();
+        riemann->solve (priml_map,primr_map,flux_map,dim,&eos,0,
+                        passive_list,nullptr);
+        timer.stop();
+      }
+    }
+    delete riemann;
+
+    // per face: read left and right primitives and write fluxes
+
+    const double cells = 3.0*ni*m*m*(m-1);
+    const double bytes = cells*(2*prim_keys.size() + flux_keys.size())
+      *sizeof(enzo_float);
+    benchmark.add (std::string("riemann:") + names[i_r],
+                   timer.value(), cells, bytes);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void benchmark_matrix_laplace_ (Benchmark & benchmark, int nb, int ni)
+{
+  const int ng = 3;
+  const int m = nb + 2*ng;
+  const int n = m*m*m;
+
+  enzo_float * X = new enzo_float [n];
+  enzo_float * Y = new enzo_float [n];
+  for (int i=0; i<n; i++) X[i] = sin(0.37*i);
+
+  const int orders[] = {2, 4};
+  for (int i_o=0; i_o<2; i_o++) {
+    EnzoMatrixLaplace matrix (orders[i_o]);
+    matrix.set_dimensions (m,m,m);
+    matrix.set_cell_width (1.0/nb,1.0/nb,1.0/nb);
+
+    Timer timer;
+    for (int iter=0; iter<ni; iter++) {
+      timer.start();
+      matrix.matvec (default_precision,Y,X,matrix.ghost_depth());
+      timer.stop();
+    }
+
+    // stencil reads are assumed to hit in cache: one read, one write
+
+    const int g = matrix.ghost_depth();
+    const double cells = double(ni)*(m-2*g)*(m-2*g)*(m-2*g);
+    const double bytes = 2.0*cells*sizeof(enzo_float);
+    benchmark.add (std::string("matrix_laplace:order_") +
+                   std::to_string(orders[i_o]),
+                   timer.value(), cells, bytes);
+  }
+
+  delete [] Y;
+  delete [] X;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("Benchmark");
+
+  const int nb = (PARALLEL_ARGC > 1) ? atoi(PARALLEL_ARGV[1]) : 32;
+  const int ni = (PARALLEL_ARGC > 2) ? atoi(PARALLEL_ARGV[2]) : 20;
+
+  PARALLEL_PRINTF ("block %d^3  iterations %d\n",nb,ni);
+
+  Benchmark benchmark("enzo_kernels");
+  benchmark.set_parameter("block_size",nb);
+  benchmark.set_parameter("iterations",ni);
+
+  benchmark_reconstructor_  (benchmark,nb,ni);
+  benchmark_riemann_        (benchmark,nb,ni);
+  benchmark_matrix_laplace_ (benchmark,nb,ni);
+
+  unit_func("kernels");
+  unit_assert (benchmark.num_results() == 8);
+
+  if (PARALLEL_ARGC > 3) {
+    unit_func("write");
+    unit_assert (benchmark.write(PARALLEL_ARGV[3]));
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
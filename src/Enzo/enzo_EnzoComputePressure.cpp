@@ -50,7 +50,38 @@ void EnzoComputePressure::compute ( Block * block) throw()
          field.field_id("pressure") >= 0);
   // TODO: possibly check that pressure is cell-centered
 
+  // Reuse the pressure field if it and its inputs are unchanged since
+  // it was last computed.  Grackle's pressure is not cached here
+
+  const bool use_cache =
+    (i_hist_ == 0) && ! enzo::config()->method_grackle_use_grackle;
+
+  if (use_cache) {
+    DerivedFieldCache * cache = field.derived_cache();
+    if (cache->is_current("pressure",cache_key_(field))) return;
+  }
+
   compute(block, (enzo_float*)field.values("pressure", i_hist_));
+
+  if (use_cache) {
+    // the key includes the epoch of the pressure field just written
+    field.derived_cache()->set_current("pressure",cache_key_(field));
+  }
+}
+
+//----------------------------------------------------------------------
+
+std::vector<long long> EnzoComputePressure::cache_key_
+(const Field & field) const throw()
+{
+  std::vector<long long> key = EnzoDerivedFields::key
+    (field, { "density", "total_energy", "internal_energy",
+              "velocity_x", "velocity_y", "velocity_z",
+              "bfield_x", "bfield_y", "bfield_z", "pressure" });
+  EnzoDerivedFields::append_key
+    (key, enzo::fluid_props()->dual_energy_config().is_disabled() ? 0.0 : 1.0);
+  EnzoDerivedFields::append_key (key, gamma_);
+  return key;
 }
 
 //----------------------------------------------------------------------
@@ -40,7 +40,8 @@ public: // interface
   }
 
   /// Perform the computation on the block and store the results in the
-  /// "pressure" field
+  /// "pressure" field.  The field is not recomputed if it is current
+  /// in the Block's DerivedFieldCache
   void compute( Block * block) throw();
 
   /// Perform the computation on the block and store the result in the provided
@@ -106,6 +107,11 @@ public: // interface
 #endif
                                ) throw();
 
+protected: // methods
+
+  /// Return the DerivedFieldCache key of the "pressure" field
+  std::vector<long long> cache_key_ (const Field & field) const throw();
+
 protected: // attributes
 
   double gamma_;
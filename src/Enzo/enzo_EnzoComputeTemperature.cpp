@@ -53,15 +53,48 @@ void EnzoComputeTemperature::compute ( Block * block) throw()
   EnzoBlock * enzo_block = enzo::block(block);
   Field field = enzo_block->data()->field();
 
-  enzo_float * t = field.is_field("temperature") ?
-                    (enzo_float*) field.values("temperature", i_hist_) : NULL;
-
-  if (!t) {
+  if (! field.is_field("temperature")) {
     ERROR("EnzoComputeTemperature::compute()",
           " 'temperature' field is not defined as a permanent field");
   }
 
-  compute(block, t);
+  // Reuse the temperature field if it and its inputs are unchanged
+  // since it was last computed.  Grackle temperatures are memoized by
+  // EnzoMethodGrackle instead
+
+  const bool use_cache =
+    (i_hist_ == 0) && ! enzo::config()->method_grackle_use_grackle;
+
+  if (use_cache) {
+    DerivedFieldCache * cache = field.derived_cache();
+    if (cache->is_current("temperature",cache_key_(field))) return;
+  }
+
+  compute(block, (enzo_float*) field.values("temperature", i_hist_));
+
+  if (use_cache) {
+    // the key includes the epochs of the fields just written
+    field.derived_cache()->set_current("temperature",cache_key_(field));
+  }
+}
+
+//----------------------------------------------------------------------
+
+std::vector<long long> EnzoComputeTemperature::cache_key_
+(const Field & field) const throw()
+{
+  std::vector<long long> key = EnzoDerivedFields::key
+    (field, { "density", "total_energy", "internal_energy",
+              "velocity_x", "velocity_y", "velocity_z",
+              "bfield_x", "bfield_y", "bfield_z",
+              "pressure", "temperature" });
+  EnzoDerivedFields::append_key
+    (key, enzo::fluid_props()->dual_energy_config().is_disabled() ? 0.0 : 1.0);
+  EnzoDerivedFields::append_key (key, enzo::fluid_props()->gamma());
+  EnzoDerivedFields::append_key (key, density_floor_);
+  EnzoDerivedFields::append_key (key, temperature_floor_);
+  EnzoDerivedFields::append_key (key, mol_weight_);
+  return key;
 }
 
 //---------------------------------------------------------------------
@@ -95,8 +128,14 @@ void EnzoComputeTemperature::compute_(Block * block,
 
 #ifdef CONFIG_USE_GRACKLE
     const EnzoMethodGrackle* grackle_method = enzo::grackle_method();
-    grackle_method->calculate_temperature(EnzoFieldAdaptor(block, i_hist_), t,
-                                          0, grackle_units, grackle_fields);
+    if (i_hist_ == 0 && grackle_units == NULL && grackle_fields == NULL) {
+      // reuse temperature if Grackle's input fields are unchanged
+      grackle_method->calculate_temperature(block, t);
+    } else {
+      grackle_method->calculate_temperature(EnzoFieldAdaptor(block, i_hist_),
+                                            t, 0, grackle_units,
+                                            grackle_fields);
+    }
 #else
     ERROR("EnzoComputeTemperature::compute_()",
           "Attempting to compute temperature with method Grackle "
@@ -112,13 +151,26 @@ void EnzoComputeTemperature::compute_(Block * block,
 
     const int m = mx*my*mz;
 
-    enzo_float * d = (enzo_float*) field.values("density", i_hist_);
-    enzo_float * p = (enzo_float*) field.values("pressure", i_hist_);
-
     EnzoComputePressure compute_pressure(gamma,comoving_coordinates_);
     compute_pressure.set_history(i_hist_);
 
-    if (recompute_pressure) compute_pressure.compute(block, p);
+    if (recompute_pressure) {
+      // the current pressure field is cached by EnzoComputePressure
+      if (i_hist_ == 0) {
+        compute_pressure.compute(block);
+      } else {
+        compute_pressure.compute
+          (block, (enzo_float*) field.values("pressure", i_hist_));
+      }
+    }
+
+    // read-only access, so that derived fields of the block stay cached
+
+    const Field & field_const = field;
+    const enzo_float * d =
+      (const enzo_float*) field_const.values("density", i_hist_);
+    const enzo_float * p =
+      (const enzo_float*) field_const.values("pressure", i_hist_);
 
     for (int i=0; i<m; i++) {
       enzo_float density     = std::max(d[i], (enzo_float) density_floor_);
@@ -59,7 +59,9 @@ public: // interface
 
   /// Perform the computation on the block
   ///
-  /// This recomputes the "pressure" field and overwrites the values
+  /// This recomputes the "pressure" field and overwrites the values.
+  /// Neither field is recomputed if it is current in the Block's
+  /// DerivedFieldCache
   virtual void compute( Block * block) throw();
 
   virtual void compute( Block * block, enzo_float * t) throw();
@@ -80,6 +82,8 @@ public: // interface
 
 private: // functions
 
+  /// Return the DerivedFieldCache key of the "temperature" field
+  std::vector<long long> cache_key_ (const Field & field) const throw();
 
 private: // attributes
 
@@ -253,6 +253,8 @@ EnzoConfig::EnzoConfig() throw ()
   method_feedback_analytic_SNR_shell_mass(true),
   method_feedback_fade_SNR(true),
   method_feedback_NEvents(-1),
+  method_feedback_rate_table(true),
+  method_feedback_rate_table_validate(false),
   method_feedback_radiation(true),
   // EnzoMethodM1Closure
   method_m1_closure(false),
@@ -300,14 +302,24 @@ EnzoConfig::EnzoConfig() throw ()
   method_star_maker_maximum_star_mass(-1.0),    // maximum star particle mass in solar masses
   method_star_maker_min_level(0), // minimum AMR level for star formation
   method_star_maker_turn_off_probability(false),
+  method_star_maker_select_candidates(true),
   // EnzoMethodTurbulence
   method_turbulence_edot(0.0),
   method_turbulence_mach_number(0.0),
+  method_turbulence_overlap_reduction(false),
+  method_turbulence_driving("initial"),
+  method_turbulence_ou_k_min(1.0),
+  method_turbulence_ou_k_max(2.0),
+  method_turbulence_ou_correlation_time(1.0),
+  method_turbulence_ou_update_interval(-1.0),
+  method_turbulence_ou_solenoidal_fraction(1.0),
   method_grackle_use_grackle(false),
 #ifdef CONFIG_USE_GRACKLE
   method_grackle_chemistry(),
   method_grackle_use_cooling_timestep(false),
   method_grackle_radiation_redshift(-1.0),
+  method_grackle_subcycle_batch_size(0),
+  method_grackle_cooling_time_table(false),
 #endif
   // EnzoMethodGravity
   method_gravity_grav_const(0.0),
@@ -674,6 +686,8 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_feedback_analytic_SNR_shell_mass;
   p | method_feedback_fade_SNR;
   p | method_feedback_NEvents;
+  p | method_feedback_rate_table;
+  p | method_feedback_rate_table_validate;
   p | method_feedback_radiation;
 
   p | method_star_maker_flavor;
@@ -698,6 +712,7 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_star_maker_maximum_star_mass;
   p | method_star_maker_min_level;
   p | method_star_maker_turn_off_probability;
+  p | method_star_maker_select_candidates;
 
   p | method_m1_closure;
   p | method_m1_closure_N_groups;
@@ -724,6 +739,13 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_m1_closure_energy_mean;
 
   p | method_turbulence_edot;
+  p | method_turbulence_overlap_reduction;
+  p | method_turbulence_driving;
+  p | method_turbulence_ou_k_min;
+  p | method_turbulence_ou_k_max;
+  p | method_turbulence_ou_correlation_time;
+  p | method_turbulence_ou_update_interval;
+  p | method_turbulence_ou_solenoidal_fraction;
 
   p | method_gravity_grav_const;
   p | method_gravity_solver;
@@ -797,6 +819,8 @@ void EnzoConfig::pup (PUP::er &p)
   if (method_grackle_use_grackle) {
     p  | method_grackle_use_cooling_timestep;
     p  | method_grackle_radiation_redshift;
+    p  | method_grackle_subcycle_batch_size;
+    p  | method_grackle_cooling_time_table;
     if (p.isUnpacking()) { method_grackle_chemistry = new chemistry_data; }
     p | *method_grackle_chemistry;
   } else {
@@ -1547,6 +1571,14 @@ void EnzoConfig::read_method_grackle_(Parameters * p)
     method_grackle_radiation_redshift = p->value_float
       ("Method:grackle:radiation_redshift", -1.0);
 
+    // batch size for solving chemistry on compacted cells (0 to disable)
+    method_grackle_subcycle_batch_size = p->value_integer
+      ("Method:grackle:subcycle_batch_size", 0);
+
+    // interpolate cooling time in a table for the cooling timestep
+    method_grackle_cooling_time_table = p->value_logical
+      ("Method:grackle:cooling_time_table", false);
+
     // Set Grackle parameters from parameter file
     method_grackle_chemistry->with_radiative_cooling = p->value_integer
       ("Method:grackle:with_radiative_cooling",
@@ -1738,6 +1770,12 @@ void EnzoConfig::read_method_feedback_(Parameters * p)
   method_feedback_NEvents = p->value_integer
     ("Method:feedback:NEvents",-1);
 
+  method_feedback_rate_table = p->value_logical
+    ("Method:feedback:rate_table",true);
+
+  method_feedback_rate_table_validate = p->value_logical
+    ("Method:feedback:rate_table_validate",false);
+
   method_feedback_radiation = p->value_logical
     ("Method:feedback:radiation", true);
 }
@@ -1811,6 +1849,9 @@ void EnzoConfig::read_method_star_maker_(Parameters * p)
 
   method_star_maker_turn_off_probability = p->value_logical
     ("Method:star_maker:turn_off_probability",false);
+
+  method_star_maker_select_candidates = p->value_logical
+    ("Method:star_maker:select_candidates",true);
 }
 
 //----------------------------------------------------------------------
@@ -2129,6 +2170,28 @@ void EnzoConfig::read_method_turbulence_(Parameters * p)
     ("Method:turbulence:edot",-1.0);
   method_turbulence_mach_number = p->value_float
     ("Method:turbulence:mach_number",0.0);
+  method_turbulence_overlap_reduction = p->value_logical
+    ("Method:turbulence:overlap_reduction",false);
+  method_turbulence_driving = p->value_string
+    ("Method:turbulence:driving","initial");
+
+  ASSERT1("EnzoConfig::read_method_turbulence_",
+          "Method:turbulence:driving is \"%s\" but must be "
+          "\"initial\" or \"ou\"",
+          method_turbulence_driving.c_str(),
+          (method_turbulence_driving == "initial" ||
+           method_turbulence_driving == "ou"));
+
+  method_turbulence_ou_k_min = p->value_float
+    ("Method:turbulence:ou_k_min",1.0);
+  method_turbulence_ou_k_max = p->value_float
+    ("Method:turbulence:ou_k_max",2.0);
+  method_turbulence_ou_correlation_time = p->value_float
+    ("Method:turbulence:ou_correlation_time",1.0);
+  method_turbulence_ou_update_interval = p->value_float
+    ("Method:turbulence:ou_update_interval",-1.0);
+  method_turbulence_ou_solenoidal_fraction = p->value_float
+    ("Method:turbulence:ou_solenoidal_fraction",1.0);
 }
 
 //----------------------------------------------------------------------
@@ -370,6 +370,8 @@ public: // interface
       method_feedback_analytic_SNR_shell_mass(true),
       method_feedback_fade_SNR(true),
       method_feedback_NEvents(-1),
+      method_feedback_rate_table(true),
+      method_feedback_rate_table_validate(false),
       // EnzoMethodCheckGravity
       method_check_gravity_particle_type(),
 
@@ -407,6 +409,7 @@ public: // interface
       method_star_maker_maximum_star_mass(-1.0),    // maximum star particle mass in solar masses
       method_star_maker_min_level(0), // minimum refinement level for star formation
       method_star_maker_turn_off_probability(false),
+      method_star_maker_select_candidates(true),
       // EnzoMethodM1Closure
       method_m1_closure(false),
       method_m1_closure_N_groups(1), // # of frequency bins
@@ -434,12 +437,21 @@ public: // interface
       // EnzoMethodTurbulence
       method_turbulence_edot(0.0),
       method_turbulence_mach_number(0.0),
+      method_turbulence_overlap_reduction(false),
+      method_turbulence_driving("initial"),
+      method_turbulence_ou_k_min(1.0),
+      method_turbulence_ou_k_max(2.0),
+      method_turbulence_ou_correlation_time(1.0),
+      method_turbulence_ou_update_interval(-1.0),
+      method_turbulence_ou_solenoidal_fraction(1.0),
       // EnzoMethodGrackle
       method_grackle_use_grackle(false),
 #ifdef CONFIG_USE_GRACKLE
       method_grackle_chemistry(nullptr),
       method_grackle_use_cooling_timestep(false),
       method_grackle_radiation_redshift(-1.0),
+      method_grackle_subcycle_batch_size(0),
+      method_grackle_cooling_time_table(false),
 #endif
       // EnzoMethodGravity
       method_gravity_grav_const(0.0),
@@ -900,6 +912,8 @@ public: // attributes
   bool                       method_feedback_analytic_SNR_shell_mass;
   bool                       method_feedback_fade_SNR;
   int                        method_feedback_NEvents;
+  bool                       method_feedback_rate_table;
+  bool                       method_feedback_rate_table_validate;
  
   /// EnzoMethodStarMaker
 
@@ -925,6 +939,7 @@ public: // attributes
   double                    method_star_maker_maximum_star_mass;
   int                       method_star_maker_min_level;
   bool                      method_star_maker_turn_off_probability;
+  bool                      method_star_maker_select_candidates;
 
 
   /// EnzoMethodM1Closure
@@ -956,6 +971,13 @@ public: // attributes
   /// EnzoMethodTurbulence
   double                     method_turbulence_edot;
   double                     method_turbulence_mach_number;
+  bool                       method_turbulence_overlap_reduction;
+  std::string                method_turbulence_driving;
+  double                     method_turbulence_ou_k_min;
+  double                     method_turbulence_ou_k_max;
+  double                     method_turbulence_ou_correlation_time;
+  double                     method_turbulence_ou_update_interval;
+  double                     method_turbulence_ou_solenoidal_fraction;
 
   /// EnzoMethodGrackle
   bool                       method_grackle_use_grackle;
@@ -963,6 +985,8 @@ public: // attributes
   chemistry_data *           method_grackle_chemistry;
   bool                       method_grackle_use_cooling_timestep;
   double                     method_grackle_radiation_redshift;
+  int                        method_grackle_subcycle_batch_size;
+  bool                       method_grackle_cooling_time_table;
 #endif /* CONFIG_USE_GRACKLE */
 
   /// EnzoMethodGravity
@@ -0,0 +1,125 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoDerivedFields.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Implementation of the EnzoDerivedFields class
+
+#include "cello.hpp"
+
+#include "enzo.hpp"
+
+//----------------------------------------------------------------------
+
+const enzo_float * EnzoDerivedFields::pressure (Block * block) throw()
+{
+  EnzoComputePressure compute_pressure (enzo::fluid_props()->gamma(),
+                                        enzo::config()->physics_cosmology);
+  compute_pressure.compute(block);
+
+  const Field field = block->data()->field();
+  return (const enzo_float *) field.values("pressure");
+}
+
+//----------------------------------------------------------------------
+
+const enzo_float * EnzoDerivedFields::temperature (Block * block) throw()
+{
+  EnzoComputeTemperature compute_temperature
+    (enzo::fluid_props(), enzo::config()->physics_cosmology);
+  compute_temperature.compute(block);
+
+  const Field field = block->data()->field();
+  return (const enzo_float *) field.values("temperature");
+}
+
+//----------------------------------------------------------------------
+
+const double * EnzoDerivedFields::velocity_divergence (Block * block) throw()
+{
+  Field field = block->data()->field();
+  DerivedFieldCache * cache = field.derived_cache();
+
+  const int rank = cello::rank();
+  const std::vector<std::string> inputs =
+    { "velocity_x", "velocity_y", "velocity_z" };
+
+  std::vector<long long> key = EnzoDerivedFields::key
+    (field, std::vector<std::string>(inputs.begin(),inputs.begin()+rank));
+
+  int mx,my,mz;
+  field.dimensions(0,&mx,&my,&mz);
+  const int m = mx*my*mz;
+
+  const std::string name = "velocity_divergence";
+  double * div = cache->values<double>(name,m);
+
+  if (cache->is_current(name,key)) return div;
+
+  const Field & field_const = field;
+  const enzo_float * vx = (rank >= 1) ?
+    (const enzo_float *) field_const.values("velocity_x") : NULL;
+  const enzo_float * vy = (rank >= 2) ?
+    (const enzo_float *) field_const.values("velocity_y") : NULL;
+  const enzo_float * vz = (rank >= 3) ?
+    (const enzo_float *) field_const.values("velocity_z") : NULL;
+
+  double dx,dy,dz;
+  block->cell_width(&dx,&dy,&dz);
+
+  const int dix = 1;
+  const int diy = mx;
+  const int diz = mx*my;
+
+  std::fill_n(div,m,0.0);
+
+  const int ky = (rank >= 2) ? 1 : 0;
+  const int kz = (rank >= 3) ? 1 : 0;
+  for (int iz=kz; iz<mz-kz; iz++) {
+    for (int iy=ky; iy<my-ky; iy++) {
+#pragma omp simd
+      for (int ix=1; ix<mx-1; ix++) {
+        const int i = ix + mx*(iy + my*iz);
+        double d = 0.0;
+        if (vx) d += 0.5 * (vx[i+dix] - vx[i-dix]) / dx;
+        if (vy) d += 0.5 * (vy[i+diy] - vy[i-diy]) / dy;
+        if (vz) d += 0.5 * (vz[i+diz] - vz[i-diz]) / dz;
+        div[i] = d;
+      }
+    }
+  }
+
+  cache->set_current(name,key);
+
+  return div;
+}
+
+//----------------------------------------------------------------------
+
+std::vector<long long> EnzoDerivedFields::key
+(const Field & field, const std::vector<std::string> & inputs) throw()
+{
+  std::vector<int> id_inputs;
+  id_inputs.reserve(inputs.size());
+  for (const std::string & input : inputs) {
+    id_inputs.push_back(field.field_id(input));
+  }
+  return EnzoDerivedFields::key(field,id_inputs);
+}
+
+//----------------------------------------------------------------------
+
+std::vector<long long> EnzoDerivedFields::key
+(const Field & field, const std::vector<int> & id_inputs) throw()
+{
+  // derived fields are computed in ghost zones too: boundary
+  // conditions advance field epochs, and refreshes the ghost epoch
+
+  std::vector<long long> key;
+  key.reserve(id_inputs.size() + 8);
+  for (int id_field : id_inputs) {
+    key.push_back(field.epoch(id_field));
+  }
+  key.push_back(field.ghost_epoch());
+  return key;
+}
@@ -0,0 +1,58 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoDerivedFields.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Enzo] Declaration of the EnzoDerivedFields class
+
+#ifndef ENZO_ENZO_DERIVED_FIELDS_HPP
+#define ENZO_ENZO_DERIVED_FIELDS_HPP
+
+class EnzoDerivedFields {
+
+  /// @class    EnzoDerivedFields
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Cached quantities derived from a Block's fields
+  ///
+  /// Each function returns the derived quantity for all cells of the
+  /// Block, recomputing it only if its input fields have been
+  /// modified since it was last computed by any Method or Refine
+  /// object.  Returned arrays are read-only and valid until the
+  /// Block's fields are next modified.  Writes through a pointer
+  /// acquired before the derived quantity was computed are only seen
+  /// once the writing Method completes, so a Method must not ask again
+  /// for a quantity derived from fields it has written this way.
+
+public: // interface
+
+  /// Return the "pressure" field
+  static const enzo_float * pressure (Block * block) throw();
+
+  /// Return the "temperature" field
+  static const enzo_float * temperature (Block * block) throw();
+
+  /// Return the centered-difference velocity divergence, which is 0
+  /// in the outermost layer of cells
+  static const double * velocity_divergence (Block * block) throw();
+
+  /// Return a cache key for a derived field computed from the given
+  /// fields: their modification epochs and the ghost epoch
+  static std::vector<long long> key
+  (const Field & field, const std::vector<std::string> & inputs) throw();
+
+  /// Return a cache key for a derived field computed from the given
+  /// field ids
+  static std::vector<long long> key
+  (const Field & field, const std::vector<int> & id_inputs) throw();
+
+  /// Append a parameter of the computation to a cache key
+  static void append_key (std::vector<long long> & key, double value) throw()
+  {
+    long long bits;
+    std::memcpy(&bits,&value,sizeof(bits));
+    key.push_back(bits);
+  }
+
+};
+
+#endif /* ENZO_ENZO_DERIVED_FIELDS_HPP */
@@ -0,0 +1,332 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoFeedbackRateTable.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Implementation of the EnzoFeedbackRateTable class
+
+#include "cello.hpp"
+#include "enzo.hpp"
+
+// Table ranges and sizes.  Node counts are chosen to keep the
+// relative interpolation error below about 1e-4
+
+/// Type Ia rate: the Gaussian term is negligible beyond the table
+#define SNIA_AGE_MIN 37.53
+#define SNIA_AGE_MAX 137.53
+#define SNIA_N       1024
+
+#define WIND_MID_N   1024
+
+/// Winds of stars older than the table use the analytic expression
+#define WIND_OLD_AGE_MAX 2.0e4
+#define WIND_OLD_N   1024
+
+/// Young star winds at metallicities below exp(WIND_YOUNG_Y_MIN) use
+/// the analytic expression
+#define WIND_YOUNG_Y_MIN -20.0
+#define WIND_YOUNG_NX 128
+#define WIND_YOUNG_NY 128
+
+/// Wind energy at ages below the table uses the analytic expression
+#define ENERGY_AGE_MIN 1.0e-4
+#define ENERGY_N     4096
+
+#define PSI_ION_N    1024
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  /// Relative difference of a value from the analytic value a
+  inline double rel_error_ (double value, double a)
+  {
+    return (a != 0.0) ? std::abs(value - a)/std::abs(a) : std::abs(value);
+  }
+
+  // Smooth segments of the piecewise analytic expressions, used to
+  // build the tables so that nodes at segment ends stay on the segment
+
+  /// Type Ia rate for age >= 37.53 Myr
+  inline double snia_segment_ (double age_Myr)
+  { return 5.3e-8+1.6e-5*exp(-0.5*pow((age_Myr-50.0)/10.0, 2)); }
+
+  /// Wind age power law for 1 <= age < 3.5 Myr, given log age and
+  /// min(log Z,1)
+  inline double wind_young_segment_ (double x, double y)
+  { return std::exp(x*(1.45 + 0.08*y)); }
+
+  /// Wind factor for 3.5 <= age < 100 Myr
+  inline double wind_mid_segment_ (double age_Myr)
+  { return 29.4*pow(age_Myr/3.5, -3.25)+0.0042; }
+
+  /// Wind factor for age >= 100 Myr
+  inline double wind_old_segment_ (double age_Myr)
+  { return 0.42*pow(age_Myr/1000, -1.1)/(19.81/log(age_Myr)); }
+
+  /// Wind specific energy for age < 100 Myr
+  inline double energy_segment_ (double age_Myr)
+  {
+    double d = powl(1+age_Myr/2.5, 1.4);
+    double a50 = powl(double(age_Myr)/10.0, 5.0);
+    return 5.94e4 / d + a50 +4.83;
+  }
+
+  /// Ionizing luminosity for 3.5 <= age <= 25 Myr, in Lsun/Msun
+  inline double psi_ion_segment_ (double age_Myr)
+  {
+    return 60. * pow(age_Myr/3.5, -3.6) +
+      470 * pow(age_Myr/3.5, 0.045-1.82*std::log(age_Myr));
+  }
+
+}
+
+//----------------------------------------------------------------------
+
+const EnzoFeedbackRateTable * EnzoFeedbackRateTable::instance()
+{
+  static const EnzoFeedbackRateTable table;
+  return &table;
+}
+
+//----------------------------------------------------------------------
+
+EnzoFeedbackRateTable::EnzoFeedbackRateTable() throw()
+  : snia_(),
+    wind_mid_(),
+    wind_old_(),
+    wind_young_(),
+    energy_(),
+    psi_ion_()
+{
+  snia_.build (SNIA_AGE_MIN, SNIA_AGE_MAX, SNIA_N,
+               [](double a) { return snia_segment_(a); });
+
+  wind_mid_.build (std::log(3.5), std::log(100.0), WIND_MID_N,
+                   [](double x) { return wind_mid_segment_(std::exp(x)); });
+
+  wind_old_.build (std::log(100.0), std::log(WIND_OLD_AGE_MAX), WIND_OLD_N,
+                   [](double x) { return wind_old_segment_(std::exp(x)); });
+
+  energy_.build (std::log(ENERGY_AGE_MIN), std::log(100.0), ENERGY_N,
+                 [](double x) { return energy_segment_(std::exp(x)); });
+
+  psi_ion_.build (std::log(3.5), std::log(25.0), PSI_ION_N,
+                  [](double x) { return psi_ion_segment_(std::exp(x)); });
+
+  const double dx = std::log(3.5) / (WIND_YOUNG_NX - 1);
+  const double dy = (1.0 - WIND_YOUNG_Y_MIN) / (WIND_YOUNG_NY - 1);
+  wind_young_.resize(WIND_YOUNG_NX*WIND_YOUNG_NY);
+  for (int iy=0; iy<WIND_YOUNG_NY; iy++) {
+    for (int ix=0; ix<WIND_YOUNG_NX; ix++) {
+      wind_young_[ix + WIND_YOUNG_NX*iy] =
+        wind_young_segment_(ix*dx, WIND_YOUNG_Y_MIN + iy*dy);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoFeedbackRateTable::evaluate
+(int n, const double * age_Myr, const double * Z_Zsun,
+ double * rate_snii, double * rate_snia,
+ double * wind_factor, double * wind_energy_factor,
+ double * psi_ion) const throw()
+{
+  const double x_young_max = std::log(3.5);
+  const double dxi_young = (WIND_YOUNG_NX - 1) / x_young_max;
+  const double dyi_young = (WIND_YOUNG_NY - 1) / (1.0 - WIND_YOUNG_Y_MIN);
+  const double * wind_young = wind_young_.data();
+
+  // branch-free interpolation of every quantity for every particle
+
+#pragma omp simd
+  for (int i=0; i<n; i++) {
+    const double a = age_Myr[i];
+    const double Z = Z_Zsun[i];
+    const double x = std::log(std::max(a,1e-30));
+
+    rate_snii[i] = rate_snii_analytic(a);
+    rate_snia[i] = (a < SNIA_AGE_MIN) ? 0.0 : snia_(a);
+
+    // 1 <= age < 3.5 Myr winds: bilinear in (log age, min(log Z,1))
+    const double y = std::min(std::log(std::max(Z,1e-300)),1.0);
+    double tx = std::min(std::max(x*dxi_young,0.0),WIND_YOUNG_NX - 1.0);
+    double ty = std::min(std::max((y - WIND_YOUNG_Y_MIN)*dyi_young,0.0),
+                         WIND_YOUNG_NY - 1.0);
+    const int ix = std::min(int(tx),WIND_YOUNG_NX - 2);
+    const int iy = std::min(int(ty),WIND_YOUNG_NY - 2);
+    tx -= ix;
+    ty -= iy;
+    const double * w = wind_young + ix + WIND_YOUNG_NX*iy;
+    const double power =
+      (1.0-ty)*((1.0-tx)*w[0]             + tx*w[1]) +
+      (     ty)*((1.0-tx)*w[WIND_YOUNG_NX] + tx*w[WIND_YOUNG_NX+1]);
+    const double z_factor = 4.763*std::min(0.01 + Z, 1.0);
+
+    wind_factor[i] =
+      (a <= 0.001) ? 0.0 :
+      ((a < 1.0) ?   z_factor :
+       ((a < 3.5) ?  z_factor*power :
+        ((a < 100.0) ? wind_mid_(x) : wind_old_(x))));
+
+    wind_energy_factor[i] = (a < 100.0) ? energy_(x) : 4.83;
+
+    psi_ion[i] =
+      (a < 3.5) ? 500.0 : ((a <= 25.0) ? psi_ion_(x) : 0.0);
+  }
+
+  // particles outside the tables use the analytic expressions
+
+  const double Z_young_min = std::exp(WIND_YOUNG_Y_MIN);
+  for (int i=0; i<n; i++) {
+    const double a = age_Myr[i];
+    const double Z = Z_Zsun[i];
+    if ((1.0 <= a && a < 3.5 && ! (Z >= Z_young_min)) ||
+        (a >= WIND_OLD_AGE_MAX)) {
+      wind_factor[i] = wind_factor_analytic(a,Z);
+    }
+    if (! (a >= ENERGY_AGE_MIN)) {
+      wind_energy_factor[i] = wind_energy_factor_analytic(a);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoFeedbackRateTable::evaluate_analytic
+(int n, const double * age_Myr, const double * Z_Zsun,
+ double * rate_snii, double * rate_snia,
+ double * wind_factor, double * wind_energy_factor,
+ double * psi_ion) throw()
+{
+  for (int i=0; i<n; i++) {
+    const double a = age_Myr[i];
+    rate_snii[i]          = rate_snii_analytic(a);
+    rate_snia[i]          = rate_snia_analytic(a);
+    wind_factor[i]        = wind_factor_analytic(a,Z_Zsun[i]);
+    wind_energy_factor[i] = wind_energy_factor_analytic(a);
+    psi_ion[i]            = psi_ion_analytic(a);
+  }
+}
+
+//----------------------------------------------------------------------
+
+double EnzoFeedbackRateTable::relative_error
+(int n, const double * age_Myr, const double * Z_Zsun,
+ const double * rate_snia, const double * wind_factor,
+ const double * wind_energy_factor, const double * psi_ion) throw()
+{
+  double error = 0.0;
+  for (int i=0; i<n; i++) {
+    const double a = age_Myr[i];
+    error = std::max(error,rel_error_(rate_snia[i],rate_snia_analytic(a)));
+    error = std::max(error,rel_error_(wind_factor[i],
+                                      wind_factor_analytic(a,Z_Zsun[i])));
+    error = std::max(error,rel_error_(wind_energy_factor[i],
+                                      wind_energy_factor_analytic(a)));
+    error = std::max(error,rel_error_(psi_ion[i],psi_ion_analytic(a)));
+  }
+  return error;
+}
+
+//----------------------------------------------------------------------
+
+double EnzoFeedbackRateTable::max_relative_error () const throw()
+{
+  // sample each table midway between nodes, where linear
+  // interpolation error is largest, and compare with evaluate()
+
+  std::vector<double> age;
+  std::vector<double> Z;
+
+  const Table * tables[] = { &snia_, &wind_mid_, &wind_old_, &energy_, &psi_ion_ };
+  for (int it=0; it<5; it++) {
+    const Table & table = *tables[it];
+    const int nt = table.values.size();
+    for (int i=0; i<nt-1; i++) {
+      const double x = table.x0 + (i+0.5)/table.dxi;
+      age.push_back((it == 0) ? x : std::exp(x));
+      Z.push_back(1.0);
+    }
+  }
+
+  const double dx = std::log(3.5) / (WIND_YOUNG_NX - 1);
+  const double dy = (1.0 - WIND_YOUNG_Y_MIN) / (WIND_YOUNG_NY - 1);
+  for (int iy=0; iy<WIND_YOUNG_NY-1; iy++) {
+    for (int ix=0; ix<WIND_YOUNG_NX-1; ix++) {
+      age.push_back(std::exp((ix+0.5)*dx));
+      Z.push_back(std::exp(WIND_YOUNG_Y_MIN + (iy+0.5)*dy));
+    }
+  }
+
+  const int n = age.size();
+  std::vector<double> rate_snii(n), rate_snia(n), wind_factor(n),
+    wind_energy_factor(n), psi_ion(n);
+
+  evaluate (n, age.data(), Z.data(),
+            rate_snii.data(), rate_snia.data(), wind_factor.data(),
+            wind_energy_factor.data(), psi_ion.data());
+
+  return relative_error (n, age.data(), Z.data(),
+                         rate_snia.data(), wind_factor.data(),
+                         wind_energy_factor.data(), psi_ion.data());
+}
+
+//----------------------------------------------------------------------
+
+double EnzoFeedbackRateTable::rate_snii_analytic (double age_Myr) throw()
+{
+  if (3.401 <= age_Myr && age_Myr < 10.37) return 5.408e-4;
+  if (10.37 <= age_Myr && age_Myr < 37.53) return 2.516e-4;
+  return 0.0;
+}
+
+//----------------------------------------------------------------------
+
+double EnzoFeedbackRateTable::rate_snia_analytic (double age_Myr) throw()
+{
+  if (37.53 <= age_Myr) {
+    return snia_segment_(age_Myr);
+  }
+  return 0.0;
+}
+
+//----------------------------------------------------------------------
+
+double EnzoFeedbackRateTable::wind_factor_analytic
+(double age_Myr, double Z_Zsun) throw()
+{
+  double wind_factor = 0.0;
+  if (0.001 < age_Myr && age_Myr < 1.0){
+    wind_factor = 4.763 * std::min((0.01 + Z_Zsun), 1.0);
+  }
+  if (1 <= age_Myr && age_Myr < 3.5){
+    wind_factor = 4.763*std::min(0.01+Z_Zsun, 1.0)*
+      pow(age_Myr, 1.45+0.08*std::min(log(Z_Zsun), 1.0));
+  }
+  if (3.5 <= age_Myr && age_Myr < 100){
+    wind_factor = wind_mid_segment_(age_Myr);
+  }
+  if (100 <= age_Myr){
+    wind_factor = wind_old_segment_(age_Myr);
+  }
+  return wind_factor;
+}
+
+//----------------------------------------------------------------------
+
+double EnzoFeedbackRateTable::wind_energy_factor_analytic
+(double age_Myr) throw()
+{
+  return (age_Myr < 100) ? energy_segment_(age_Myr) : 4.83;
+}
+
+//----------------------------------------------------------------------
+
+double EnzoFeedbackRateTable::psi_ion_analytic (double age_Myr) throw()
+{
+  // units of Lsun/Msun
+  if (age_Myr < 3.5) return 500.0;
+  return (age_Myr <= 25.0) ? psi_ion_segment_(age_Myr) : 0.0;
+}
@@ -0,0 +1,133 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoFeedbackRateTable.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Enzo] Declaration of the EnzoFeedbackRateTable class
+///
+/// Tables of the supernova rates, stellar wind factors and ionizing
+/// luminosity used by EnzoMethodFeedbackSTARSS, as functions of star
+/// particle age and metallicity.  Smooth segments of the piecewise
+/// analytic expressions are tabulated separately in log age (and for
+/// young star winds log metallicity), so that linear interpolation
+/// never crosses a discontinuity.  Values outside the tables fall
+/// back to the analytic expressions.
+
+#ifndef ENZO_ENZO_FEEDBACK_RATE_TABLE_HPP
+#define ENZO_ENZO_FEEDBACK_RATE_TABLE_HPP
+
+class EnzoFeedbackRateTable {
+
+  /// @class    EnzoFeedbackRateTable
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Tabulated STARSS feedback rates
+
+public: // interface
+
+  /// Return the table for this process, built on first use.  The
+  /// table is read-only once built
+  static const EnzoFeedbackRateTable * instance();
+
+  /// Build the tables
+  EnzoFeedbackRateTable() throw();
+
+  /// Interpolate rates for n star particles with the given ages in
+  /// Myr and metallicities in solar units.  Rates are per solar mass
+  /// per Myr, the wind factor in Msun/Gyr per Msun, and psi_ion in
+  /// Lsun/Msun
+  void evaluate (int n, const double * age_Myr, const double * Z_Zsun,
+                 double * rate_snii, double * rate_snia,
+                 double * wind_factor, double * wind_energy_factor,
+                 double * psi_ion) const throw();
+
+  /// Evaluate the analytic expressions for n star particles
+  static void evaluate_analytic
+  (int n, const double * age_Myr, const double * Z_Zsun,
+   double * rate_snii, double * rate_snia,
+   double * wind_factor, double * wind_energy_factor,
+   double * psi_ion) throw();
+
+  /// Return the maximum relative error of the given rates with
+  /// respect to the analytic expressions
+  static double relative_error
+  (int n, const double * age_Myr, const double * Z_Zsun,
+   const double * rate_snia, const double * wind_factor,
+   const double * wind_energy_factor, const double * psi_ion) throw();
+
+  /// Return the maximum relative error of the tables, sampled at
+  /// midpoints between all table nodes
+  double max_relative_error () const throw();
+
+  /// Type II supernova rate (Hopkins et al. 2018)
+  static double rate_snii_analytic (double age_Myr) throw();
+
+  /// Type Ia supernova rate (Hopkins et al. 2018)
+  static double rate_snia_analytic (double age_Myr) throw();
+
+  /// Stellar wind mass loss rate per unit mass
+  static double wind_factor_analytic (double age_Myr, double Z_Zsun) throw();
+
+  /// Stellar wind specific energy, in units of 1e12 erg/g
+  static double wind_energy_factor_analytic (double age_Myr) throw();
+
+  /// Ionizing luminosity per unit mass
+  static double psi_ion_analytic (double age_Myr) throw();
+
+private: // classes
+
+  /// Linear interpolation table with uniformly spaced nodes
+  struct Table {
+
+    Table () : x0(0.0), x1(0.0), dxi(0.0), values() {}
+
+    /// Tabulate f(x) at n nodes spanning [x0,x1]
+    template <class F>
+    void build (double x0_in, double x1_in, int n, F f)
+    {
+      x0 = x0_in;
+      x1 = x1_in;
+      dxi = (n-1) / (x1 - x0);
+      values.resize(n);
+      for (int i=0; i<n; i++) values[i] = f(x0 + i/dxi);
+    }
+
+    /// Interpolate at x, clamped to the table range
+    double operator() (double x) const
+    {
+      const int n = values.size();
+      double t = (x - x0)*dxi;
+      t = (t < 0.0) ? 0.0 : ((t > n - 1.0) ? n - 1.0 : t);
+      const int i = (t < n - 1.0) ? int(t) : n - 2;
+      const double f = t - i;
+      return values[i] + f*(values[i+1] - values[i]);
+    }
+
+    double x0, x1;
+    double dxi;
+    std::vector<double> values;
+  };
+
+private: // attributes
+
+  /// Type Ia rate, in age
+  Table snia_;
+
+  /// Wind factor for 3.5 <= age < 100 Myr, in log age
+  Table wind_mid_;
+
+  /// Wind factor for age >= 100 Myr, in log age
+  Table wind_old_;
+
+  /// Wind age power law for 1 <= age < 3.5 Myr, in log age (fast
+  /// index) and min(log Z,1)
+  std::vector<double> wind_young_;
+
+  /// Wind specific energy for age < 100 Myr, in log age
+  Table energy_;
+
+  /// Ionizing luminosity for 3.5 <= age <= 25 Myr, in log age
+  Table psi_ion_;
+
+};
+
+#endif /* ENZO_ENZO_FEEDBACK_RATE_TABLE_HPP */
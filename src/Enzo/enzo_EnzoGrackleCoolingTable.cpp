@@ -0,0 +1,173 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoGrackleCoolingTable.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Implementation of the EnzoGrackleCoolingTable class
+
+#include "cello.hpp"
+#include "enzo.hpp"
+
+#ifdef CONFIG_USE_GRACKLE
+
+//----------------------------------------------------------------------
+
+EnzoGrackleCoolingTable::EnzoGrackleCoolingTable() throw()
+  : rate_(),
+    lower_(),
+    width_(),
+    n_(),
+    num_metal_(1),
+    metal_fraction_solar_(0.0),
+    units_()
+{ }
+
+//----------------------------------------------------------------------
+
+bool EnzoGrackleCoolingTable::supported
+(const chemistry_data * grackle_chemistry) throw()
+{
+  return (grackle_chemistry->primordial_chemistry == 0 &&
+          grackle_chemistry->use_radiative_transfer == 0 &&
+          grackle_chemistry->use_volumetric_heating_rate == 0 &&
+          grackle_chemistry->use_specific_heating_rate == 0);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoGrackleCoolingTable::update
+(chemistry_data * grackle_chemistry,
+ chemistry_data_storage * grackle_rates,
+ const code_units & grackle_units,
+ const double log_density_range[2],
+ const double log_energy_range[2]) throw()
+{
+  const double * range[2] = { log_density_range, log_energy_range };
+  const int num_metal = (grackle_chemistry->metal_cooling != 0) ? 2 : 1;
+
+  bool rebuild = rate_.empty() ||
+    num_metal != num_metal_ ||
+    units_differ_(grackle_units, units_);
+  for (int axis=0; axis<2; axis++) {
+    if (range[axis][0] < lower_[axis] ||
+        range[axis][1] > lower_[axis] + width_[axis]) {
+      rebuild = true;
+    }
+  }
+
+  if (! rebuild) return;
+
+  // extend range by one decade on each side, covering any previous range
+
+  for (int axis=0; axis<2; axis++) {
+    double lo = std::floor(range[axis][0]) - 1.0;
+    double hi = std::ceil(range[axis][1]) + 1.0;
+    if (! rate_.empty()) {
+      lo = std::min(lo, lower_[axis]);
+      hi = std::max(hi, lower_[axis] + width_[axis]);
+    }
+    lower_[axis] = lo;
+    width_[axis] = hi - lo;
+    n_[axis] = int(std::round((hi - lo)*nodes_per_dex)) + 1;
+  }
+  num_metal_ = num_metal;
+  metal_fraction_solar_ = grackle_chemistry->SolarMetalFractionByMass;
+
+  // evaluate Grackle's cooling time at table nodes
+
+  const int size = n_[0]*n_[1]*num_metal_;
+  std::vector<gr_float> density (size);
+  std::vector<gr_float> energy (size);
+  std::vector<gr_float> metal (num_metal_ > 1 ? size : 0);
+  for (int im=0; im<num_metal_; im++) {
+    for (int ie=0; ie<n_[1]; ie++) {
+      for (int id=0; id<n_[0]; id++) {
+        const int i = id + n_[0]*(ie + n_[1]*im);
+        density[i] = std::pow(10.0, lower_[0] + double(id)/nodes_per_dex);
+        energy[i]  = std::pow(10.0, lower_[1] + double(ie)/nodes_per_dex);
+        if (num_metal_ > 1) {
+          metal[i] = density[i] * im * metal_fraction_solar_;
+        }
+      }
+    }
+  }
+
+  int grid_dimension[3] = {size, 1, 1};
+  int grid_start[3]     = {0, 0, 0};
+  int grid_end[3]       = {size-1, 0, 0};
+  grackle_field_data fields = grackle_field_data();
+  fields.grid_rank       = 1;
+  fields.grid_dimension  = grid_dimension;
+  fields.grid_start      = grid_start;
+  fields.grid_end        = grid_end;
+  fields.grid_dx         = 0.0;
+  fields.density         = density.data();
+  fields.internal_energy = energy.data();
+  fields.metal_density   = (num_metal_ > 1) ? metal.data() : nullptr;
+
+  code_units units = grackle_units;
+  std::vector<gr_float> cooling_time (size);
+  if (local_calculate_cooling_time
+      (grackle_chemistry, grackle_rates, &units,
+       &fields, cooling_time.data()) == ENZO_FAIL) {
+    ERROR("EnzoGrackleCoolingTable::update()",
+          "Error in local_calculate_cooling_time.\n");
+  }
+
+  rate_.resize(size);
+  for (int i=0; i<size; i++) {
+    rate_[i] = (cooling_time[i] != 0.0) ?
+      1.0 / cooling_time[i] : std::numeric_limits<double>::max();
+  }
+  units_ = grackle_units;
+}
+
+//----------------------------------------------------------------------
+
+double EnzoGrackleCoolingTable::rate
+(double log_density, double log_energy, double metal_fraction) const throw()
+{
+  const double log3[2] = { log_density, log_energy };
+  int i3[2];
+  double w3[2];
+  for (int axis=0; axis<2; axis++) {
+    double x = (log3[axis] - lower_[axis]) * nodes_per_dex;
+    x = std::min(std::max(x, 0.0), double(n_[axis] - 1));
+    i3[axis] = std::min(int(x), n_[axis] - 2);
+    w3[axis] = x - i3[axis];
+  }
+
+  double rate[2] = { 0.0, 0.0 };
+  for (int im=0; im<num_metal_; im++) {
+    for (int je=0; je<2; je++) {
+      for (int jd=0; jd<2; jd++) {
+        const double w = (jd ? w3[0] : 1.0 - w3[0]) *
+                         (je ? w3[1] : 1.0 - w3[1]);
+        rate[im] += w * rate_[(i3[0]+jd) + n_[0]*((i3[1]+je) + n_[1]*im)];
+      }
+    }
+  }
+
+  return (num_metal_ > 1) ?
+    rate[0] + (rate[1] - rate[0]) * metal_fraction / metal_fraction_solar_ :
+    rate[0];
+}
+
+//======================================================================
+
+bool EnzoGrackleCoolingTable::units_differ_
+(const code_units & a, const code_units & b) throw()
+{
+  const double tol = 1e-3;
+  auto differ = [tol] (double x, double y)
+    { return std::abs(x - y) > tol*std::max(std::abs(x),std::abs(y)); };
+  return (a.comoving_coordinates != b.comoving_coordinates ||
+          differ(a.density_units,  b.density_units) ||
+          differ(a.length_units,   b.length_units) ||
+          differ(a.time_units,     b.time_units) ||
+          differ(a.velocity_units, b.velocity_units) ||
+          differ(a.a_units,        b.a_units) ||
+          differ(a.a_value,        b.a_value));
+}
+
+#endif /* CONFIG_USE_GRACKLE */
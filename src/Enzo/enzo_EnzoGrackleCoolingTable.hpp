@@ -0,0 +1,98 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoGrackleCoolingTable.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Enzo] Declaration of the EnzoGrackleCoolingTable class
+///
+/// Table of Grackle cooling rates 1/t_cool used by EnzoMethodGrackle
+/// to estimate the cooling timestep without calling Grackle on every
+/// cell.  Rates are tabulated at uniformly spaced nodes in log
+/// density and log specific internal energy, and interpolated
+/// linearly, which remains smooth where the cooling time changes
+/// sign.  With metal cooling, Grackle's tabulated metal cooling is
+/// proportional to the metal mass fraction, so rates are tabulated
+/// for metal-free and solar metallicity gas and interpolated linearly
+/// in the metal mass fraction.
+
+#ifndef ENZO_ENZO_GRACKLE_COOLING_TABLE_HPP
+#define ENZO_ENZO_GRACKLE_COOLING_TABLE_HPP
+
+#ifdef CONFIG_USE_GRACKLE
+
+class EnzoGrackleCoolingTable {
+
+  /// @class    EnzoGrackleCoolingTable
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Tabulated Grackle cooling rates
+
+public: // interface
+
+  /// Create an empty table
+  EnzoGrackleCoolingTable() throw();
+
+  /// Return whether the cooling time depends only on density,
+  /// specific internal energy and metal mass fraction, so that it can
+  /// be tabulated
+  static bool supported (const chemistry_data * grackle_chemistry) throw();
+
+  /// Rebuild the table if it is empty, if the units changed, or if it
+  /// does not cover the given ranges of log10 density and log10
+  /// specific internal energy.  A rebuilt table extends the ranges by
+  /// one decade on each side, and covers any previous range
+  void update (chemistry_data * grackle_chemistry,
+               chemistry_data_storage * grackle_rates,
+               const code_units & grackle_units,
+               const double log_density_range[2],
+               const double log_energy_range[2]) throw();
+
+  /// Return the interpolated cooling rate 1/t_cool for the given
+  /// log10 density, log10 specific internal energy, and metal mass
+  /// fraction (ignored without metal cooling).  Values outside the
+  /// table are clamped to it
+  double rate (double log_density, double log_energy,
+               double metal_fraction) const throw();
+
+  /// Return the number of table nodes in log density and log energy
+  int num_nodes (int axis) const throw()
+  { return n_[axis]; }
+
+  /// Table resolution in nodes per decade
+  static const int nodes_per_dex = 8;
+
+private: // functions
+
+  /// Return whether Grackle units differ by more than a relative
+  /// tolerance
+  static bool units_differ_ (const code_units & a, const code_units & b)
+    throw();
+
+private: // attributes
+
+  /// Cooling rates indexed by log density, log specific internal
+  /// energy, and metal-free or solar metallicity
+  std::vector<double> rate_;
+
+  /// Lower bounds and widths of the table in log10 density and
+  /// log10 specific internal energy
+  double lower_[2];
+  double width_[2];
+
+  /// Number of nodes in log10 density and log10 specific internal
+  /// energy
+  int n_[2];
+
+  /// Number of metallicity planes: 2 with metal cooling, else 1
+  int num_metal_;
+
+  /// Solar metal mass fraction of the second metallicity plane
+  double metal_fraction_solar_;
+
+  /// Grackle units used to build the table
+  code_units units_;
+
+};
+
+#endif /* CONFIG_USE_GRACKLE */
+
+#endif /* ENZO_ENZO_GRACKLE_COOLING_TABLE_HPP */
@@ -58,7 +58,7 @@ void EnzoMatrixLaplace::matvec_
   const int idy = mx_;
   const int idz = mx_*my_;
 
-  const int rank = cello::rank();
+  const int rank = rank_();
 
   if (order_ == 2) {
 
@@ -242,7 +242,7 @@ void EnzoMatrixLaplace::matvec_
 
 void EnzoMatrixLaplace::diagonal_ (enzo_float * X, int g0) const throw()
 {
-  const int rank = cello::rank();
+  const int rank = rank_();
 
   if (order_ == 2) {
     
@@ -76,6 +76,15 @@ public: // interface
     hy_ = hy;
     hz_ = hz;
   }
+
+  /// Set array dimensions, including ghost zones.  Required for
+  /// lower-level methods that don't have access to the Block
+  void set_dimensions (int mx, int my, int mz)
+  {
+    mx_ = mx;
+    my_ = my;
+    mz_ = mz;
+  }
   
 public: // virtual functions
 
@@ -105,6 +114,11 @@ protected: // functions
 
   void diagonal_ (enzo_float * X, int g0) const throw();
 
+  /// Dimensionality of the arrays, determined from their dimensions
+  /// so that the low-level matvec does not depend on the Simulation
+  int rank_ () const throw()
+  { return (mz_ > 1) ? 3 : ((my_ > 1) ? 2 : 1); }
+
 protected: // attributes
 
   int mx_, my_, mz_;
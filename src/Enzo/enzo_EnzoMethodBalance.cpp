@@ -47,9 +47,12 @@ void EnzoMethodBalance::compute ( Block * block) throw()
   if (block->index().is_root())
     monitor->print("Method", "Calling Cello load-balancer");
 
+  // use "order_morton" ordering if defined, else "order_sfc"
   ScalarDescr * sd = cello::scalar_descr_long_long();
-  const int is_count = sd->index("order_morton:count");  
-  const int is_index = sd->index("order_morton:index");  
+  const std::string ordering =
+    (sd->index("order_morton:index") >= 0) ? "order_morton" : "order_sfc";
+  const int is_count = sd->index(ordering+":count");
+  const int is_index = sd->index(ordering+":index");
   Scalar<long long> scalar(cello::scalar_descr_long_long(),
                      block->data()->scalar_data_long_long());
   long long count = *scalar.value(is_count);
@@ -15,7 +15,6 @@
 #include "cello.hpp"
 #include "enzo.hpp"
 
-#include <time.h>
 
 //#ifdef NOTDEFINED // for now... since not done coding
 
@@ -26,11 +25,11 @@
 // splice these off to a different file (later)
 // TODO: Maybe create EnzoStarParticle class and add rate-calculating functions there?
 
-int EnzoMethodFeedbackSTARSS::determineSN(double age_Myr, int* nSNII, int* nSNIA,
-                double pmass_Msun, double tunit, float dt){
+int EnzoMethodFeedbackSTARSS::determineSN(double RII, double RIA, int* nSNII, int* nSNIA,
+                double pmass_Msun, double tunit, float dt,
+                const Random & random_draw, uint64_t item){
 
     const EnzoConfig * enzo_config = enzo::config();
-    std::mt19937 mt(std::time(nullptr));
 
     if (NEvents > 0){
         *nSNII = 1;
@@ -40,34 +39,14 @@ int EnzoMethodFeedbackSTARSS::determineSN(double age_Myr, int* nSNII, int* nSNIA
     /* else, calculate SN rate, probability and determine number of events */
     *nSNII = 0;
     *nSNIA = 0;
-    double RII=0, RIA=0, PII=0, PIA=0, random = 0;
+    double PII=0, PIA=0;
     if (enzo_config->method_feedback_supernovae && NEvents < 0)
     {
-        /* age-dependent rates */
-        if (age_Myr < 3.401)
-        {
-            RII = 0.0;
-            RIA = 0.0;
-        }
-        if (3.401 <= age_Myr && age_Myr < 10.37)
-        {
-            RII = 5.408e-4;
-            RIA = 0.0;
-        }
-        if (10.37 <= age_Myr && age_Myr < 37.53)
-        {
-            RII = 2.516e-4;
-            RIA = 0.0;
-        }
-        if (37.53 <= age_Myr)
-        {
-            RII = 0.0;
-            RIA = 5.3e-8+1.6e-5*exp(-0.5*pow((age_Myr-50.0)/10.0, 2));
-        }
+        /* age-dependent rates RII and RIA from EnzoFeedbackRateTable */
         /* rates -> probabilities */
         if (RII > 0){
             PII = RII * pmass_Msun / enzo_constants::Myr_s *tunit*dt;
-            double random = double(mt())/double(mt.max());
+            double random = random_draw.uniform(item,0);
             if (PII > 1.0){
                 if (enzo_config->method_feedback_unrestricted_sn) {
                     int round = (int)PII;
@@ -88,13 +67,13 @@ int EnzoMethodFeedbackSTARSS::determineSN(double age_Myr, int* nSNII, int* nSNIA
         }
 
         #ifdef DEBUG_FEEDBACK_STARSS_SN
-          CkPrintf("MethodFeedbackSTARSS::determineSN() -- pmass_Msun = %f; age = %f; RII = %f; RIA = %f\n",
-                    pmass_Msun, age_Myr, RII, RIA);
+          CkPrintf("MethodFeedbackSTARSS::determineSN() -- pmass_Msun = %f; RII = %f; RIA = %f\n",
+                    pmass_Msun, RII, RIA);
         #endif
 
         if (RIA > 0){
             PIA = RIA*pmass_Msun / enzo_constants::Myr_s *tunit*dt;
-            float random = float(rand())/float(RAND_MAX);
+            float random = random_draw.uniform(item,1);
 
             if (PIA > 1.0)
             {
@@ -129,38 +108,17 @@ int EnzoMethodFeedbackSTARSS::determineSN(double age_Myr, int* nSNII, int* nSNIA
         return 1;
 }
 
-int EnzoMethodFeedbackSTARSS::determineWinds(double age_Myr, double * eWinds, double * mWinds, double * zWinds,
+int EnzoMethodFeedbackSTARSS::determineWinds(double age_Myr, double wind_factor, double e_factor,
+                      double * eWinds, double * mWinds, double * zWinds,
                       double pmass_Msun, double metallicity_Zsun, double tunit, double dt) 
     {
-    // age in Myr
+    // age in Myr; wind_factor and e_factor from EnzoFeedbackRateTable
 
-    const EnzoConfig * enzo_config = enzo::config();
     bool oldEnough = (age_Myr < 0.0001)?(false):(true);
     double windE = 0,  wind_mass_solar = 0, windZ = 0.0;
-    double wind_factor = 0.0;
-    double e_factor = 0.0;
 
     if (pmass_Msun > 11 && oldEnough){
 
-        if (0.001 < age_Myr && age_Myr < 1.0){
-            wind_factor = 4.763 * std::min((0.01 + metallicity_Zsun), 1.0);
-        }
-        if (1 <= age_Myr && age_Myr < 3.5){
-            wind_factor = 4.763*std::min(0.01+metallicity_Zsun, 1.0)* 
-                pow(age_Myr, 1.45+0.08*std::min(log(metallicity_Zsun), 1.0));
-        }
-        if (3.5 <= age_Myr && age_Myr < 100){
-            wind_factor = 29.4*pow(age_Myr/3.5, -3.25)+0.0042;
-        }
-        if (age_Myr < 100){
-            double d = powl(1+age_Myr/2.5, 1.4);
-            double a50 = powl(double(age_Myr)/10.0, 5.0);
-            e_factor = 5.94e4 / d + a50 +4.83;
-        }
-        if (100 <= age_Myr){
-            e_factor = 4.83;
-            wind_factor = 0.42*pow(age_Myr/1000, -1.1)/(19.81/log(age_Myr));
-        }
         wind_mass_solar = pmass_Msun * wind_factor; // Msun/Gyr
         wind_mass_solar = wind_mass_solar*dt*tunit/(1e3 * enzo_constants::Myr_s); // Msun
 
@@ -186,33 +144,44 @@ int EnzoMethodFeedbackSTARSS::determineWinds(double age_Myr, double * eWinds, do
 void EnzoMethodFeedbackSTARSS::transformComovingWithStar(enzo_float * density, 
                                   enzo_float * velocity_x, enzo_float * velocity_y, enzo_float * velocity_z,
                                   const enzo_float up, const enzo_float vp, const enzo_float wp,
-                                  const int mx, const int my, const int mz, int direction) const throw()
+                                  const int mx, const int my, const int mz,
+                                  const int lo[3], const int hi[3], int direction) const throw()
 {
-  int size = mx*my*mz;
+  // only cells in the (inclusive) index range lo..hi are transformed
   if (direction > 0)
   {
     // to comoving with star
     // NOTE: This transforms the velocity field into a momentum density
     //       field for the sake of depositing momentum easily
  
-    for (int ind = 0; ind<size; ind++) {
-      double mult = density[ind];
-      velocity_x[ind] = (velocity_x[ind]-up)*mult;
-      velocity_y[ind] = (velocity_y[ind]-vp)*mult;
-      velocity_z[ind] = (velocity_z[ind]-wp)*mult;
+    for (int iz = lo[2]; iz <= hi[2]; iz++) {
+      for (int iy = lo[1]; iy <= hi[1]; iy++) {
+        for (int ix = lo[0]; ix <= hi[0]; ix++) {
+          const int ind = INDEX(ix,iy,iz,mx,my);
+          double mult = density[ind];
+          velocity_x[ind] = (velocity_x[ind]-up)*mult;
+          velocity_y[ind] = (velocity_y[ind]-vp)*mult;
+          velocity_z[ind] = (velocity_z[ind]-wp)*mult;
+        }
+      }
     }
   }
 
   else if (direction < 0)
   {
     // back to "lab" frame. Convert momentum density field back to velocity
-    for (int ind = 0; ind<size; ind++) {
-      //if (density[ind] <= 10*1e-20) continue;
-      if (density[ind] == 0) continue;
-      double mult = 1/density[ind];
-      velocity_x[ind] = velocity_x[ind]*mult + up;
-      velocity_y[ind] = velocity_y[ind]*mult + vp;
-      velocity_z[ind] = velocity_z[ind]*mult + wp;
+    for (int iz = lo[2]; iz <= hi[2]; iz++) {
+      for (int iy = lo[1]; iy <= hi[1]; iy++) {
+        for (int ix = lo[0]; ix <= hi[0]; ix++) {
+          const int ind = INDEX(ix,iy,iz,mx,my);
+          //if (density[ind] <= 10*1e-20) continue;
+          if (density[ind] == 0) continue;
+          double mult = 1/density[ind];
+          velocity_x[ind] = velocity_x[ind]*mult + up;
+          velocity_y[ind] = velocity_y[ind]*mult + vp;
+          velocity_z[ind] = velocity_z[ind]*mult + wp;
+        }
+      }
     }
   }
 
@@ -252,6 +221,9 @@ EnzoMethodFeedbackSTARSS::EnzoMethodFeedbackSTARSS
          "untested without dual-energy formalism",
          ! enzo::fluid_props()->dual_energy_config().is_disabled());
 
+  // star particle ids key the random numbers drawn for supernovae
+  cello::particle_descr()->check_particle_attribute("star","id");
+
   // required fields
   cello::define_field("density");
   cello::define_field("pressure");
@@ -327,11 +299,17 @@ EnzoMethodFeedbackSTARSS::EnzoMethodFeedbackSTARSS
  
   refresh_fb->set_callback(CkIndex_EnzoBlock::p_method_feedback_starss_end());
  
-  std::mt19937 mt(std::time(nullptr)); // initialize random function
-  
   // initialize NEvents parameter (mainly for testing). Sets off 'NEvents' supernovae,
   // with at most one supernova per star particle per cycle.
   this->NEvents = enzo_config->method_feedback_NEvents;
+
+  // build the rate tables, and check them if requested
+  const EnzoFeedbackRateTable * rate_table = EnzoFeedbackRateTable::instance();
+  if (enzo_config->method_feedback_rate_table &&
+      enzo_config->method_feedback_rate_table_validate && CkMyPe() == 0) {
+    CkPrintf ("EnzoMethodFeedbackSTARSS: rate table max relative error = %e\n",
+              rate_table->max_relative_error());
+  }
   return;
 }
 
@@ -616,6 +594,7 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
   const int ia_mf = particle.attribute_index (it, "metal_fraction");
   const int ia_sn = particle.attribute_index (it, "number_of_sn"); // name change?
   const int ia_lum = particle.attribute_index (it, "luminosity");
+  const int ia_id = particle.attribute_index (it, "id");
 
   const int dm = particle.stride(it, ia_m);
   const int dp = particle.stride(it, ia_x);
@@ -625,9 +604,19 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
   const int dmf = particle.stride(it, ia_mf);
   const int dsn = particle.stride(it, ia_sn);
   const int dlum = particle.stride(it, ia_lum);
+  const int did = particle.stride(it, ia_id);
 
   const int nb = particle.num_batches(it);
 
+  // reproducible random numbers keyed by (seed, cycle, particle id),
+  // so that a star's draws do not depend on which Block holds it or
+  // on its position in the Block's particle batches
+  const Random random (cello::config()->method_random_seed,
+                       Random::stream(name()), block->cycle());
+
+  const EnzoFeedbackRateTable * rate_table = EnzoFeedbackRateTable::instance();
+  double rate_table_error = 0.0;
+
   for (int ib=0; ib<nb; ib++){
     enzo_float *px=0, *py=0, *pz=0, *pvx=0, *pvy=0, *pvz=0;
     enzo_float *plifetime=0, *pcreation=0, *pmass=0, *pmetal=0, *psncounter=0, *plum=0;
@@ -649,22 +638,52 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
 
     plum = (enzo_float *) particle.attribute_array(it, ia_lum, ib);
 
+    const int64_t * pid = (const int64_t *) particle.attribute_array(it, ia_id, ib);
+
     int np = particle.num_particles(it,ib);
 
+    // evaluate rates for the whole batch
+
+    ScratchFrame scratch;
+    double * age_batch     = scratch.allocate<double>(np);
+    double * Z_batch       = scratch.allocate<double>(np);
+    double * rate_snii     = scratch.allocate<double>(np);
+    double * rate_snia     = scratch.allocate<double>(np);
+    double * wind_factor   = scratch.allocate<double>(np);
+    double * wind_e_factor = scratch.allocate<double>(np);
+    double * psi_ion       = scratch.allocate<double>(np);
+
+    for (int ip=0; ip<np; ip++){
+      age_batch[ip] = (current_time - pcreation[ip*dc]) * enzo_units->time() / enzo_constants::Myr_s;
+      Z_batch[ip]   = pmetal[ip*dmf] / z_solar;
+    }
+
+    if (enzo_config->method_feedback_rate_table) {
+      rate_table->evaluate (np, age_batch, Z_batch, rate_snii, rate_snia,
+                            wind_factor, wind_e_factor, psi_ion);
+      if (enzo_config->method_feedback_rate_table_validate) {
+        rate_table_error = std::max
+          (rate_table_error, EnzoFeedbackRateTable::relative_error
+           (np, age_batch, Z_batch, rate_snia, wind_factor, wind_e_factor, psi_ion));
+      }
+    } else {
+      EnzoFeedbackRateTable::evaluate_analytic
+        (np, age_batch, Z_batch, rate_snii, rate_snia,
+         wind_factor, wind_e_factor, psi_ion);
+    }
+
     for (int ip=0; ip<np; ip++){
       int ipdp = ip*dp; // pos
       int ipdm = ip*dm; // mass
       int ipdv = ip*dv; // velocity
       int ipdl = ip*dl; // lifetime
-      int ipdc = ip*dc; // creation time
-      int ipdmf = ip*dmf; // metallicity
       int ipsn  = ip*dsn; // number of SNe counter
       int ipdlum = ip*dlum; // particle luminosity counter
 
       double pmass_solar = pmass[ipdm] * munit/enzo_constants::mass_solar;
 
       if (pmass[ipdm] > 0.0 && plifetime[ipdl] > 0.0){
-        const double age = (current_time - pcreation[ipdc]) * enzo_units->time() / enzo_constants::Myr_s;
+        const double age = age_batch[ip];
         count++; // increment particles examined here
 
         // compute coordinates of central feedback cell
@@ -683,8 +702,9 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
 
           /* Determine number of SN events from rates (currently taken from Hopkins 2018) */
 
-          determineSN(age, &nSNII, &nSNIa, pmass_solar,
-                      tunit, block->dt());
+          determineSN(rate_snii[ip], rate_snia[ip], &nSNII, &nSNIa, pmass_solar,
+                      tunit, block->dt(),
+                      random, uint64_t(pid[ip*did]));
 
           numSN += nSNII + nSNIa;
 
@@ -701,7 +721,7 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
             SNMassEjected = SNII_ejecta_mass_Msun * nSNII +
                             SNIa_ejecta_mass_Msun * nSNIa; // AE: split this in two channels for yields
 
-            const double starZ = pmetal[ipdmf] / z_solar;
+            const double starZ = Z_batch[ip];
 
             /* Fixed mass ejecta */
 
@@ -720,9 +740,10 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
         double windMass=0.0, windMetals=0.0, windEnergy=0.0;
         if (enzo_config->method_feedback_stellar_winds){
 
-          const double starZ = pmetal[ipdmf] / z_solar;
+          const double starZ = Z_batch[ip];
 
-          determineWinds(age, &windEnergy, &windMass, &windMetals,
+          determineWinds(age, wind_factor[ip], wind_e_factor[ip],
+                         &windEnergy, &windMass, &windMetals,
                          pmass_solar,
                          starZ, tunit, block->dt());
 
@@ -746,13 +767,7 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
 
         // ionizing radiation
         if (enzo_config->method_feedback_radiation) {
-          double Psi_ion;
-          if (age < 3.5) {
-              Psi_ion = 500; // units of Lsun/Msun
-          }
-          if (age >= 3.5 && age <= 25){
-              Psi_ion = 60. * pow(age/3.5, -3.6) + 470 * pow(age/3.5, 0.045-1.82*std::log(age));
-          }
+          const double Psi_ion = psi_ion[ip]; // units of Lsun/Msun
           double lum_unit = munit * lunit * lunit / (tunit*tunit*tunit);
           plum[ipdlum] = Psi_ion * pmass_solar * enzo_constants::luminosity_solar / lum_unit; // erg/s 
         } // if radiation
@@ -766,6 +781,11 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
   if (count > 0){
     CkPrintf("FeedbackSTARSS: Num FB particles = %d  Events = %d  FeedbackTime %e\n",
               count, numSN, 0.00);
+    if (enzo_config->method_feedback_rate_table &&
+        enzo_config->method_feedback_rate_table_validate) {
+      CkPrintf("FeedbackSTARSS: rate table max relative error = %e\n",
+               rate_table_error);
+    }
   }
 
   // refresh
@@ -824,8 +844,6 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
   my = ny + 2*gy;
   mz = nz + 2*gz;
 
-  int size = mx*my*mz;
-
   const int rank = cello::rank();
 
   double cell_volume_code = hx*hy*hz;
@@ -885,32 +903,36 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
   // holds just shell densities (used for refresh+accumulate)
   enzo_float * d_shell   = (enzo_float *) field.values(i_d_shell);
 
-  // allocate another set of temporary deposit fields for this event 
-  enzo_float *  d_dep = new enzo_float[size]; 
-  enzo_float * te_dep = new enzo_float[size];
-  enzo_float * ge_dep = new enzo_float[size];
-  enzo_float * mf_dep = new enzo_float[size];
-  enzo_float * vx_dep = new enzo_float[size];
-  enzo_float * vy_dep = new enzo_float[size];
-  enzo_float * vz_dep = new enzo_float[size];
-
-  // initialize temporary deposit fields as zero
-  // Not doing so gives in screwy results
-  for (int i=0; i<size; i++) {
-    d_dep [i] = 0;
-    te_dep[i] = 0;
-    ge_dep[i] = 0;
-    mf_dep[i] = 0;
-    vx_dep[i] = 0;
-    vy_dep[i] = 0;
-    vz_dep[i] = 0;
-  }
-
-
-
   const int index = INDEX(ix,iy,iz,mx,my);
 
   int stretch_factor = 1.0; // put coupling particles one cell-width away from star particle
+
+  // Deposition footprint: coupling particles lie within stretch_factor
+  // cells of the star, and CiC spreads each over one more cell, so
+  // all deposits fall in a (2*r_dep+1)^3 box around the host cell
+  const int r_dep = stretch_factor + 1;
+  const int i3[3] = {ix, iy, iz};
+  const int m3[3] = {mx, my, mz};
+  int lo[3], hi[3], nb3[3];
+  for (int axis=0; axis<3; axis++) {
+    lo[axis] = (axis < rank) ? std::max(i3[axis] - r_dep, 0) : 0;
+    hi[axis] = (axis < rank) ? std::min(i3[axis] + r_dep, m3[axis] - 1) : 0;
+    nb3[axis] = hi[axis] - lo[axis] + 1;
+  }
+  int nbx = nb3[0], nby = nb3[1], nbz = nb3[2];
+  const int size_dep = nbx*nby*nbz;
+
+  // allocate temporary deposit arrays for this event covering only
+  // the footprint, from the per-process scratch arena
+  ScratchFrame scratch;
+  enzo_float *  d_dep = scratch.allocate_zero<enzo_float>(size_dep);
+  enzo_float * te_dep = scratch.allocate_zero<enzo_float>(size_dep);
+  enzo_float * ge_dep = scratch.allocate_zero<enzo_float>(size_dep);
+  enzo_float * mf_dep = scratch.allocate_zero<enzo_float>(size_dep);
+  enzo_float * vx_dep = scratch.allocate_zero<enzo_float>(size_dep);
+  enzo_float * vy_dep = scratch.allocate_zero<enzo_float>(size_dep);
+  enzo_float * vz_dep = scratch.allocate_zero<enzo_float>(size_dep);
+
   const int nCouple = 26; // 3x3x3 cube minus central cell
   const double A = stretch_factor * hx;
 
@@ -966,8 +988,8 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
          around is velocity
      */
   
-  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,mz, 1);
-  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,mz, 1);
+  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,mz,lo,hi, 1);
+  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,mz,lo,hi, 1);
 
   /* 
      Use averaged quantities across multiple cells so that deposition is stable.
@@ -1323,6 +1345,7 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
       for (int iy_ = iy-1; iy_ <= iy+1; iy_++) {
         for (int iz_ = iz-1; iz_ <= iz+1; iz_++) {
           int flat = INDEX(ix_,iy_,iz_,mx,my);
+          int flat_dep = INDEX(ix_-lo[0],iy_-lo[1],iz_-lo[2],nbx,nby);
 
           // cell left edges for CiC (starting from ghost zones)
           double xcell = xm + (ix_+0.5 - gx)*hx; 
@@ -1341,15 +1364,15 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
           #endif
 
           // subtract values from the "deposit" fields
-          d_dep[flat] -= std::min(window * remainMass, maxEvacFraction*dpre);
+          d_dep[flat_dep] -= std::min(window * remainMass, maxEvacFraction*dpre);
 
-          minusRho    += -1*d_dep[flat];
-          msubtracted += -1*d_dep[flat];
+          minusRho    += -1*d_dep[flat_dep];
+          msubtracted += -1*d_dep[flat_dep];
          
-          mf_dep[flat] -= std::min(window * remainZ, maxEvacFraction*zpre); 
+          mf_dep[flat_dep] -= std::min(window * remainZ, maxEvacFraction*zpre); 
 
-          minusZ      += -1*mf_dep[flat];
-          zsubtracted += -1*mf_dep[flat];
+          minusZ      += -1*mf_dep[flat_dep];
+          zsubtracted += -1*mf_dep[flat_dep];
         } // endfor iz_
       } // endfor iy_
     } // endfor ix_
@@ -1422,41 +1445,46 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
 
   enzo_float left_edge[3] = {xm-gx*hx, ym-gy*hy, zm-gz*hz};
 
+  // left edge of the deposition footprint
+  enzo_float left_edge_dep[3] = {xm+(lo[0]-gx)*hx,
+                                 ym+(lo[1]-gy)*hy,
+                                 zm+(lo[2]-gz)*hz};
+
   // CiC deposit mass/energy/momentum
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
-   &CloudParticlePositionZ, &rank, &nCouple, &coupledMass_list, d_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &CloudParticlePositionZ, &rank, &nCouple, &coupledMass_list, d_dep, &left_edge_dep,
+   &nbx, &nby, &nbz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
-   &CloudParticlePositionZ, &rank, &nCouple, &coupledMomenta_x, vx_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &CloudParticlePositionZ, &rank, &nCouple, &coupledMomenta_x, vx_dep, &left_edge_dep,
+   &nbx, &nby, &nbz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
-   &CloudParticlePositionZ, &rank, &nCouple, &coupledMomenta_y, vy_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &CloudParticlePositionZ, &rank, &nCouple, &coupledMomenta_y, vy_dep, &left_edge_dep,
+   &nbx, &nby, &nbz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
-   &CloudParticlePositionZ, &rank, &nCouple, &coupledMomenta_z, vz_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &CloudParticlePositionZ, &rank, &nCouple, &coupledMomenta_z, vz_dep, &left_edge_dep,
+   &nbx, &nby, &nbz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
-   &CloudParticlePositionZ, &rank, &nCouple, &coupledMetals_list, mf_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &CloudParticlePositionZ, &rank, &nCouple, &coupledMetals_list, mf_dep, &left_edge_dep,
+   &nbx, &nby, &nbz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
-   &CloudParticlePositionZ, &rank, &nCouple, &coupledEnergy_list, te_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &CloudParticlePositionZ, &rank, &nCouple, &coupledEnergy_list, te_dep, &left_edge_dep,
+   &nbx, &nby, &nbz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
-   &CloudParticlePositionZ, &rank, &nCouple, &coupledGasEnergy_list, ge_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &CloudParticlePositionZ, &rank, &nCouple, &coupledGasEnergy_list, ge_dep, &left_edge_dep,
+   &nbx, &nby, &nbz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
@@ -1465,23 +1493,27 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
 
 
   // copy deposited quantites to original fields
-  for (int i=0; i<size; i++){
+  for (int iz_=lo[2]; iz_<=hi[2]; iz_++) {
+   for (int iy_=lo[1]; iy_<=hi[1]; iy_++) {
+    for (int ix_=lo[0]; ix_<=hi[0]; ix_++) {
+    const int i = INDEX(ix_,iy_,iz_,mx,my);
+    const int i_dep = INDEX(ix_-lo[0],iy_-lo[1],iz_-lo[2],nbx,nby);
 
     double d_old = d[i]; 
-    d[i] += d_dep[i];
+    d[i] += d_dep[i_dep];
     double d_new = d[i];
 
     double cell_mass = d_new*cell_volume_code;
     double M_scale = d_new / d_old;
 
-    mf[i] += mf_dep[i]; 
+    mf[i] += mf_dep[i_dep]; 
 
     // need to rescale specific energies to account for added mass
-    te[i] = te[i]/M_scale + te_dep[i] * cell_volume_code/cell_mass;
-    ge[i] = ge[i]/M_scale + ge_dep[i] * cell_volume_code/cell_mass;
-    vx[i] += vx_dep[i];
-    vy[i] += vy_dep[i];
-    vz[i] += vz_dep[i];
+    te[i] = te[i]/M_scale + te_dep[i_dep] * cell_volume_code/cell_mass;
+    ge[i] = ge[i]/M_scale + ge_dep[i_dep] * cell_volume_code/cell_mass;
+    vx[i] += vx_dep[i_dep];
+    vy[i] += vy_dep[i_dep];
+    vz[i] += vz_dep[i_dep];
      
     // Rescale color fields to account for new densities.
     // Don't need to rescale metal_density because we already deposited
@@ -1494,28 +1526,23 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
 
     // add deposited quantities to fields that track depositions
     // of all star particles in the block this cycle
-     d_dep_tot[i] += d_dep[i];
-    mf_dep_tot[i] += mf_dep[i];
-    te_dep_tot[i] += te_dep[i];
-    ge_dep_tot[i] += ge_dep[i];
-    vx_dep_tot[i] += vx_dep[i];
-    vy_dep_tot[i] += vy_dep[i];
-    vz_dep_tot[i] += vz_dep[i];  
+     d_dep_tot[i] += d_dep[i_dep];
+    mf_dep_tot[i] += mf_dep[i_dep];
+    te_dep_tot[i] += te_dep[i_dep];
+    ge_dep_tot[i] += ge_dep[i_dep];
+    vx_dep_tot[i] += vx_dep[i_dep];
+    vy_dep_tot[i] += vy_dep[i_dep];
+    vz_dep_tot[i] += vz_dep[i_dep];  
+    }
+   }
   }
 
   // transform velocities back to "lab" frame
   // convert velocity (actually momentum density at the moment) field back to velocity 
-  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,mz, -1);
-  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,mz, -1);
-
-  // clear temporary fields 
-  delete []  d_dep;
-  delete [] mf_dep;
-  delete [] te_dep;
-  delete [] ge_dep;
-  delete [] vx_dep;
-  delete [] vy_dep;
-  delete [] vz_dep;
+  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,mz,lo,hi, -1);
+  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,mz,lo,hi, -1);
+
+  // temporary deposit arrays are released when scratch goes out of scope
 }
 
 
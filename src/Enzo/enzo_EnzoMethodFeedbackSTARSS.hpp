@@ -50,10 +50,17 @@ public:
    // Compute the maximum timestep for this method
    virtual double timestep (Block * block) throw();
 
-   int determineSN (double age_Myr, int * nSNII, int * nSNIA,
-                    double mass_Msun, double tunit, float dt);
+   /// Determine the number of supernovae from Type II and Ia rates
+   /// (per Msun per Myr) evaluated by EnzoFeedbackRateTable, drawing
+   /// random numbers for the star particle with the given id
+   int determineSN (double rate_snii, double rate_snia, int * nSNII, int * nSNIA,
+                    double mass_Msun, double tunit, float dt,
+                    const Random & random, uint64_t item);
    
-   int determineWinds(double age_Myr, double * eWinds, double * mWinds, double * zWinds,
+   /// Determine wind energy, mass and metals from the wind factors
+   /// evaluated by EnzoFeedbackRateTable
+   int determineWinds(double age_Myr, double wind_factor, double e_factor,
+                      double * eWinds, double * mWinds, double * zWinds,
                       double mass_Msun, double metallicity_Zsun, double tunit, double dt); 
 
    // this can raise errors -- remove const throw() ???
@@ -68,7 +75,8 @@ public:
    void transformComovingWithStar(enzo_float * density,
                                   enzo_float * velocity_x, enzo_float * velocity_y, enzo_float * velocity_z,
                                   const enzo_float up, const enzo_float vp, const enzo_float wp,
-                                  const int mx, const int my, const int mz, int direction) const throw();
+                                  const int mx, const int my, const int mz,
+                                  const int lo[3], const int hi[3], int direction) const throw();
 
    void add_accumulate_fields(EnzoBlock * enzo_block) throw();
 
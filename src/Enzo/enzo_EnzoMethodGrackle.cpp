@@ -21,8 +21,11 @@ EnzoMethodGrackle::EnzoMethodGrackle
 #ifdef CONFIG_USE_GRACKLE
     ,
     grackle_units_(),
-    grackle_rates_(),
-    time_grackle_data_initialized_(ENZO_FLOAT_UNDEFINED)
+    grackle_rates_(nullptr),
+    time_grackle_data_initialized_(ENZO_FLOAT_UNDEFINED),
+    field_binding_(),
+    field_binding_cycle_(-1),
+    cooling_table_()
 #endif
 {
 #ifdef CONFIG_USE_GRACKLE
@@ -41,6 +44,16 @@ EnzoMethodGrackle::EnzoMethodGrackle
   /// Define Grackle's internal data structures
   time_grackle_data_initialized_ = ENZO_FLOAT_UNDEFINED;
   initialize_grackle_chemistry_data(time);
+
+  const EnzoConfig * enzo_config = enzo::config();
+  if (enzo_config->method_grackle_subcycle_batch_size > 0 &&
+      ! batching_supported(enzo_config->method_grackle_chemistry)) {
+    WARNING
+      ("EnzoMethodGrackle::EnzoMethodGrackle()",
+       "Method:grackle:subcycle_batch_size is ignored: the shielding, "
+       "dust, ISRF or heating rate options in use require solving "
+       "chemistry on the Block's grid");
+  }
 #endif /* CONFIG_USE_GRACKLE */
 }
 
@@ -179,7 +192,7 @@ void EnzoMethodGrackle::initialize_grackle_chemistry_data
   if (this->time_grackle_data_initialized_ == current_time) return;
 
   if (this->time_grackle_data_initialized_ != ENZO_FLOAT_UNDEFINED){
-    // deallocate previously the allocated allocated grackle_rates_ (doesn't
+    // release the previously requested grackle_rates_ (doesn't
     // actually affect the chemistry_data pointer)
     deallocate_grackle_rates_();
   }
@@ -194,15 +207,25 @@ void EnzoMethodGrackle::initialize_grackle_chemistry_data
     setup_grackle_units (current_time, &grackle_units_);
   }
 
-  // Initialize grackle units and data
+  // Request grackle data shared by PEs in this process: the rates
+  // depend only on the chemistry parameters, which are the same for
+  // all PEs, and the units
   TRACE("Calling initialize_chemistry_data from EnzoMethodGrackle::EnzoMethodGrackle()");
 
-  if (_initialize_chemistry_data(enzo_config->method_grackle_chemistry,
-				 &grackle_rates_, &grackle_units_)
-      == ENZO_FAIL) {
-    ERROR("EnzoMethodGrackle::initialize_grackle_chemistry_data",
-    "Error in _initialize_chemistry_data");
-  }
+  const code_units & units = grackle_units_;
+  char key[256];
+  snprintf (key,sizeof(key),
+            "grackle:rates:%d:%.17g:%.17g:%.17g:%.17g:%.17g:%.17g",
+            units.comoving_coordinates,
+            units.density_units, units.length_units,
+            units.time_units, units.velocity_units,
+            units.a_units, units.a_value);
+
+  chemistry_data * grackle_chemistry =
+    enzo_config->method_grackle_chemistry;
+  grackle_rates_ = SharedTable::get<EnzoGrackleRates>
+    (key, [grackle_chemistry,&units]()
+     { return new EnzoGrackleRates(grackle_chemistry, units); });
 
   this->time_grackle_data_initialized_ = current_time;
 
@@ -484,36 +507,31 @@ void EnzoMethodGrackle::compute_ ( Block * block) throw()
            nohydro | !enzo::fluid_props()->dual_energy_config().is_disabled());
   }
 
-  Field field = block->data()->field();
-
-  int gx,gy,gz;
-  field.ghost_depth (0,&gx,&gy,&gz);
-
-  int nx,ny,nz;
-  field.size (&nx,&ny,&nz);
-
-  int ngx = nx + 2*gx;
-  int ngy = ny + 2*gy;
-  int ngz = nz + 2*gz;
-
-  const int rank = cello::rank();
-
   /* Set code units for use in grackle */
-  grackle_field_data grackle_fields;
-
   EnzoFieldAdaptor fadaptor(block, 0);
 
   setup_grackle_units(fadaptor, &this->grackle_units_);
-  setup_grackle_fields(fadaptor, &grackle_fields);
+
+  EnzoGrackleFieldBinding * binding = bind_grackle_fields_(block, fadaptor);
+  grackle_field_data * grackle_fields = &binding->grackle_fields;
 
   chemistry_data * grackle_chemistry =
     enzo::config()->method_grackle_chemistry;
 
-  // Solve chemistry
+  // Solve chemistry on active cells only: ghost zones are updated by
+  // the refresh following this method
   double dt = block->dt();
-  if (local_solve_chemistry(grackle_chemistry, &grackle_rates_,
-			    &grackle_units_, &grackle_fields, dt)
-      == ENZO_FAIL) {
+  const int batch_size = enzo_config->method_grackle_subcycle_batch_size;
+  if (batch_size > 0 && batching_supported(grackle_chemistry)) {
+    if (solve_chemistry_batched(grackle_chemistry, grackle_rates_ptr_(),
+                                &grackle_units_, grackle_fields,
+                                dt, batch_size) == ENZO_FAIL) {
+      ERROR("EnzoMethodGrackle::compute()",
+            "Error in solve_chemistry_batched.\n");
+    }
+  } else if (local_solve_chemistry(grackle_chemistry, grackle_rates_ptr_(),
+                                   &grackle_units_, grackle_fields, dt)
+             == ENZO_FAIL) {
     ERROR("EnzoMethodGrackle::compute()",
     "Error in local_solve_chemistry.\n");
   }
@@ -522,44 +540,331 @@ void EnzoMethodGrackle::compute_ ( Block * block) throw()
   enforce_metallicity_floor(block);
 
   /* Correct total energy for changes in internal energy */
-  gr_float * v3[3];
-  v3[0] = grackle_fields.x_velocity;
-  v3[1] = grackle_fields.y_velocity;
-  v3[2] = grackle_fields.z_velocity;
+  update_total_energy_(block, grackle_fields);
 
-  const bool mhd = field.is_field("bfield_x");
-  enzo_float * b3[3] = {NULL, NULL, NULL};
-  if (mhd) {
-    b3[0]                = (enzo_float*) field.values("bfield_x");
-    if (rank >= 2) b3[1] = (enzo_float*) field.values("bfield_y");
-    if (rank >= 3) b3[2] = (enzo_float*) field.values("bfield_z");
+  // For testing purposes - reset internal energies with changes in mu
+  if (enzo_config->initial_grackle_test_reset_energies){
+    this->ResetEnergies(block);
   }
 
-  enzo_float * total_energy    = (enzo_float *) field.values("total_energy");
-  for (int i = 0; i < ngx*ngy*ngz; i++){
-    total_energy[i] = grackle_fields.internal_energy[i];
+  return;
+}
+
+//----------------------------------------------------------------------
+
+EnzoGrackleFieldBinding * EnzoMethodGrackle::bind_grackle_fields_
+(Block * block, const EnzoFieldAdaptor& fadaptor) const throw()
+{
+  const int cycle = block->cycle();
+
+  // forget Blocks not seen since the previous cycle, e.g. Blocks
+  // removed by refinement, coarsening or migration
 
-    enzo_float inv_density;
-    if (mhd) inv_density = 1.0 / grackle_fields.density[i];
-    for (int dim = 0; dim < rank; dim++){
-      total_energy[i] += 0.5 * v3[dim][i] * v3[dim][i];
-      if (mhd) total_energy[i] += 0.5 * b3[dim][i] * b3[dim][i] * inv_density;
+  if (cycle != field_binding_cycle_) {
+    for (auto it = field_binding_.begin(); it != field_binding_.end(); ) {
+      if (it->second->cycle < field_binding_cycle_) {
+        it = field_binding_.erase(it);
+      } else {
+        ++it;
+      }
     }
+    field_binding_cycle_ = cycle;
   }
 
-  // For testing purposes - reset internal energies with changes in mu
-  if (enzo_config->initial_grackle_test_reset_energies){
-    this->ResetEnergies(block);
+  std::unique_ptr<EnzoGrackleFieldBinding> & binding = field_binding_[block];
+
+  // rebuild if new, or if the Block address was reused or its fields
+  // reallocated since the binding was created
+
+  const void * density = fadaptor.ptr_for_grackle("density", true);
+
+  if (! binding ||
+      binding->index != block->index() ||
+      binding->density != density) {
+
+    binding.reset(new EnzoGrackleFieldBinding);
+
+    grackle_field_data * grackle_fields = &binding->grackle_fields;
+
+    setup_grackle_fields(fadaptor, grackle_fields);
+
+    // restrict grid to active cells
+
+    Field field = block->data()->field();
+    int g3[3];
+    field.ghost_depth (0,g3,g3+1,g3+2);
+    for (int i=0; i<3; i++) {
+      binding->grid_start_all[i] = grackle_fields->grid_start[i];
+      binding->grid_end_all[i]   = grackle_fields->grid_end[i];
+      grackle_fields->grid_start[i] += g3[i];
+      grackle_fields->grid_end[i]   -= g3[i];
+    }
+
+    // fields updated by Grackle
+
+    const char * field_modified[] = {
+      "internal_energy",
+      "HI_density", "HII_density", "HeI_density", "HeII_density",
+      "HeIII_density", "e_density",
+      "HM_density", "H2I_density", "H2II_density",
+      "DI_density", "DII_density", "HDI_density",
+      "metal_density" };
+    for (const char * name : field_modified) {
+      const int id_field = field.field_id(name);
+      if (id_field >= 0) binding->field_modified.push_back(id_field);
+    }
+
+    // fields read by Grackle
+
+    const char * field_input[] = {
+      "density",
+      "RT_heating_rate", "RT_HI_ionization_rate", "RT_HeI_ionization_rate",
+      "RT_HeII_ionization_rate", "RT_H2_dissociation_rate" };
+    binding->field_input = binding->field_modified;
+    for (const char * name : field_input) {
+      const int id_field = field.field_id(name);
+      if (id_field >= 0) binding->field_input.push_back(id_field);
+    }
+
+    binding->index   = block->index();
+    binding->density = density;
   }
 
-  delete_grackle_fields(&grackle_fields);
+  binding->cycle = cycle;
 
-  return;
+  return binding.get();
+}
+
+//----------------------------------------------------------------------
+
+bool EnzoMethodGrackle::batching_supported
+(const chemistry_data * grackle_chemistry) throw()
+{
+  // H2 self-shielding method 1 uses neighboring cells and the cell
+  // width, and methods using per-cell shielding lengths or factors
+  // read fields that are not gathered into batches
+
+  return (grackle_chemistry->H2_self_shielding != 1 &&
+          grackle_chemistry->H2_self_shielding != 3 &&
+          grackle_chemistry->H2_custom_shielding == 0 &&
+          grackle_chemistry->use_dust_density_field == 0 &&
+          grackle_chemistry->use_isrf_field == 0 &&
+          grackle_chemistry->use_volumetric_heating_rate == 0 &&
+          grackle_chemistry->use_specific_heating_rate == 0);
 }
+
+//----------------------------------------------------------------------
+
+int EnzoMethodGrackle::solve_chemistry_batched
+(chemistry_data * grackle_chemistry,
+ chemistry_data_storage * grackle_rates,
+ code_units * grackle_units,
+ grackle_field_data * grackle_fields,
+ double dt, int batch_size) throw()
+{
+  const int * d3 = grackle_fields->grid_dimension;
+  const int * s3 = grackle_fields->grid_start;
+  const int * e3 = grackle_fields->grid_end;
+
+  // compute cooling time over the solved cells
+
+  std::vector<gr_float> cooling_time (d3[0]*d3[1]*d3[2]);
+
+  if (local_calculate_cooling_time
+      (grackle_chemistry, grackle_rates, grackle_units,
+       grackle_fields, cooling_time.data()) == ENZO_FAIL) {
+    return ENZO_FAIL;
+  }
+
+  // order cells so that those requiring more than one Grackle
+  // subcycle (each limited to 10% of the cooling time) are contiguous
+
+  std::vector<int> cells;
+  cells.reserve((e3[0]-s3[0]+1)*(e3[1]-s3[1]+1)*(e3[2]-s3[2]+1));
+  for (int iz=s3[2]; iz<=e3[2]; iz++) {
+    for (int iy=s3[1]; iy<=e3[1]; iy++) {
+      for (int ix=s3[0]; ix<=e3[0]; ix++) {
+        cells.push_back(INDEX(ix,iy,iz,d3[0],d3[1]));
+      }
+    }
+  }
+  std::stable_partition
+    (cells.begin(), cells.end(),
+     [&](int i) { return std::abs(cooling_time[i]) < 10.0*dt; });
+
+  // fields gathered into batches
+
+  gr_float * grackle_field_data::* const members[] = {
+    &grackle_field_data::density,
+    &grackle_field_data::internal_energy,
+    &grackle_field_data::x_velocity,
+    &grackle_field_data::y_velocity,
+    &grackle_field_data::z_velocity,
+    &grackle_field_data::HI_density,
+    &grackle_field_data::HII_density,
+    &grackle_field_data::HeI_density,
+    &grackle_field_data::HeII_density,
+    &grackle_field_data::HeIII_density,
+    &grackle_field_data::e_density,
+    &grackle_field_data::HM_density,
+    &grackle_field_data::H2I_density,
+    &grackle_field_data::H2II_density,
+    &grackle_field_data::DI_density,
+    &grackle_field_data::DII_density,
+    &grackle_field_data::HDI_density,
+    &grackle_field_data::metal_density,
+    &grackle_field_data::RT_heating_rate,
+    &grackle_field_data::RT_HI_ionization_rate,
+    &grackle_field_data::RT_HeI_ionization_rate,
+    &grackle_field_data::RT_HeII_ionization_rate,
+    &grackle_field_data::RT_H2_dissociation_rate };
+
+  std::vector<gr_float * grackle_field_data::*> used;
+  for (auto member : members) {
+    if (grackle_fields->*member != nullptr) used.push_back(member);
+  }
+
+  const int nu = used.size();
+  std::vector<gr_float> buffer (nu*batch_size);
+
+  grackle_field_data batch = *grackle_fields;
+  int batch_dimension[3] = {0,1,1};
+  int batch_start[3]     = {0,0,0};
+  int batch_end[3]       = {0,0,0};
+  batch.grid_rank      = 1;
+  batch.grid_dimension = batch_dimension;
+  batch.grid_start     = batch_start;
+  batch.grid_end       = batch_end;
+  for (int k=0; k<nu; k++) {
+    batch.*used[k] = buffer.data() + k*batch_size;
+  }
+
+  const int num_cells = cells.size();
+  for (int i0=0; i0<num_cells; i0+=batch_size) {
+
+    const int n = std::min(batch_size, num_cells - i0);
+    const int * cell = cells.data() + i0;
+    batch_dimension[0] = n;
+    batch_end[0]       = n - 1;
+
+    for (int k=0; k<nu; k++) {
+      const gr_float * array = grackle_fields->*used[k];
+      gr_float * values = batch.*used[k];
+      for (int j=0; j<n; j++) values[j] = array[cell[j]];
+    }
+
+    if (local_solve_chemistry(grackle_chemistry, grackle_rates,
+                              grackle_units, &batch, dt) == ENZO_FAIL) {
+      return ENZO_FAIL;
+    }
+
+    for (int k=0; k<nu; k++) {
+      gr_float * array = grackle_fields->*used[k];
+      const gr_float * values = batch.*used[k];
+      for (int j=0; j<n; j++) array[cell[j]] = values[j];
+    }
+  }
+
+  return ENZO_SUCCESS;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::update_total_energy_
+(Block * block, const grackle_field_data * grackle_fields) const throw()
+{
+  const int rank = cello::rank();
+
+  const int * d3 = grackle_fields->grid_dimension;
+  const int * s3 = grackle_fields->grid_start;
+  const int * e3 = grackle_fields->grid_end;
+
+  const gr_float * density         = grackle_fields->density;
+  const gr_float * internal_energy = grackle_fields->internal_energy;
+  const gr_float * v3[3] = { grackle_fields->x_velocity,
+                             grackle_fields->y_velocity,
+                             grackle_fields->z_velocity };
+
+  Field field = block->data()->field();
+  const Field & field_const = field;
+
+  const bool mhd = field.is_field("bfield_x");
+  const enzo_float * b3[3] = {NULL, NULL, NULL};
+  if (mhd) {
+    b3[0]                = (const enzo_float*) field_const.values("bfield_x");
+    if (rank >= 2) b3[1] = (const enzo_float*) field_const.values("bfield_y");
+    if (rank >= 3) b3[2] = (const enzo_float*) field_const.values("bfield_z");
+  }
+
+  enzo_float * total_energy = (enzo_float *) field.values("total_energy");
+
+  // separate unit-stride loops per term so each vectorizes
+
+  for (int iz=s3[2]; iz<=e3[2]; iz++) {
+    for (int iy=s3[1]; iy<=e3[1]; iy++) {
+      const int i0 = INDEX(0,iy,iz,d3[0],d3[1]);
+      const int ixs = i0 + s3[0];
+      const int ixe = i0 + e3[0];
+      #pragma omp simd
+      for (int i=ixs; i<=ixe; i++) {
+        total_energy[i] = internal_energy[i];
+      }
+      for (int dim = 0; dim < rank; dim++) {
+        const gr_float * v = v3[dim];
+        #pragma omp simd
+        for (int i=ixs; i<=ixe; i++) {
+          total_energy[i] += 0.5 * v[i] * v[i];
+        }
+      }
+      if (mhd) {
+        for (int dim = 0; dim < rank; dim++) {
+          const enzo_float * b = b3[dim];
+          #pragma omp simd
+          for (int i=ixs; i<=ixe; i++) {
+            total_energy[i] += 0.5 * b[i] * b[i] / density[i];
+          }
+        }
+      }
+    }
+  }
+}
+
 #endif // config use grackle
 
 //----------------------------------------------------------------------
 
+bool EnzoMethodGrackle::data_access (Access & access) const throw()
+{
+#ifdef CONFIG_USE_GRACKLE
+  // fields not defined for the Grackle parameters in use are ignored
+
+  access.field_read =
+    { "density", "internal_energy", "total_energy",
+      "velocity_x", "velocity_y", "velocity_z",
+      "bfield_x", "bfield_y", "bfield_z",
+      "RT_heating_rate", "RT_HI_ionization_rate", "RT_HeI_ionization_rate",
+      "RT_HeII_ionization_rate", "RT_H2_dissociation_rate",
+      "specific_heating_rate", "volumetric_heating_rate" };
+  access.field_write =
+    { "internal_energy", "total_energy", "cooling_time" };
+
+  // species and metal densities are in the "color" group
+
+  Grouping * field_groups = cello::field_descr()->groups();
+  const int num_color = field_groups->size("color");
+  for (int ic = 0; ic < num_color; ic++) {
+    const std::string name = field_groups->item("color",ic);
+    access.field_read.push_back(name);
+    access.field_write.push_back(name);
+  }
+  return true;
+#else /* CONFIG_USE_GRACKLE */
+  return false;
+#endif /* CONFIG_USE_GRACKLE */
+}
+
+//----------------------------------------------------------------------
+
 double EnzoMethodGrackle::timestep ( Block * block ) throw()
 {
   const EnzoConfig * config = enzo::config();
@@ -567,7 +872,13 @@ double EnzoMethodGrackle::timestep ( Block * block ) throw()
   double dt = std::numeric_limits<double>::max();;
 
 #ifdef CONFIG_USE_GRACKLE
-  if (config->method_grackle_use_cooling_timestep){
+  if (config->method_grackle_use_cooling_timestep &&
+      config->method_grackle_cooling_time_table &&
+      EnzoGrackleCoolingTable::supported(config->method_grackle_chemistry)) {
+
+    dt = min_cooling_time_tabulated_(block);
+
+  } else if (config->method_grackle_use_cooling_timestep){
     Field field = block->data()->field();
 
     enzo_float * cooling_time = field.is_field("cooling_time") ?
@@ -592,8 +903,7 @@ double EnzoMethodGrackle::timestep ( Block * block ) throw()
       delete_cooling_time = true;
     }
 
-    calculate_cooling_time(EnzoFieldAdaptor(block,0), cooling_time, 0,
-                           nullptr, nullptr);
+    calculate_cooling_time(block, cooling_time);
 
     // make sure to exclude the ghost zone. Because there is no refresh before
     // this method is called (at least during the very first cycle) - this can
@@ -758,6 +1068,139 @@ void EnzoMethodGrackle::ResetEnergies ( Block * block) throw()
 
 //----------------------------------------------------------------------
 
+std::vector<long long> EnzoGrackleDerivedField::make_key
+(const Field & field, const std::vector<int> & field_input)
+{
+  return EnzoDerivedFields::key(field,field_input);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::compute_memoized_
+(Block * block, enzo_float * values,
+ EnzoGrackleDerivedField EnzoGrackleFieldBinding::* cache,
+ grackle_local_property_func func, std::string func_name) const throw()
+{
+  EnzoFieldAdaptor fadaptor(block, 0);
+
+  EnzoGrackleFieldBinding * binding = bind_grackle_fields_(block, fadaptor);
+  EnzoGrackleDerivedField & derived = binding->*cache;
+
+  grackle_field_data * grackle_fields = &binding->grackle_fields;
+  const int * d3 = grackle_fields->grid_dimension;
+  const size_t size = d3[0]*d3[1]*d3[2];
+
+  const std::vector<long long> key =
+    EnzoGrackleDerivedField::make_key(block->data()->field(),
+                                      binding->field_input);
+
+  const double time = block->time();
+
+  if (! derived.is_current(time, key, size)) {
+
+    code_units grackle_units;
+    EnzoMethodGrackle::setup_grackle_units(fadaptor, &grackle_units);
+
+    derived.values.resize(size);
+
+    // Grackle's local property functions require the full grid
+
+    int * grid_start = grackle_fields->grid_start;
+    int * grid_end   = grackle_fields->grid_end;
+    grackle_fields->grid_start = binding->grid_start_all;
+    grackle_fields->grid_end   = binding->grid_end_all;
+    const int err = (*func)(enzo::config()->method_grackle_chemistry,
+                            grackle_rates_ptr_(), &grackle_units,
+                            grackle_fields, derived.values.data());
+    grackle_fields->grid_start = grid_start;
+    grackle_fields->grid_end   = grid_end;
+
+    if (err == ENZO_FAIL) {
+      ERROR1("EnzoMethodGrackle::compute_memoized_()",
+             "Error in call to Grackles's %s routine", func_name.c_str());
+    }
+
+    derived.key  = key;
+    derived.time = time;
+  }
+
+  std::copy(derived.values.begin(), derived.values.end(), values);
+}
+
+//----------------------------------------------------------------------
+
+double EnzoMethodGrackle::min_cooling_time_tabulated_(Block * block) throw()
+{
+  chemistry_data * grackle_chemistry =
+    enzo::config()->method_grackle_chemistry;
+  const bool metals = (grackle_chemistry->metal_cooling != 0);
+
+  Field field = block->data()->field();
+  const Field & field_const = field;
+  const enzo_float * density =
+    (const enzo_float *) field_const.values("density");
+  const enzo_float * internal_energy =
+    (const enzo_float *) field_const.values("internal_energy");
+  const enzo_float * metal_density = metals ?
+    (const enzo_float *) field_const.values("metal_density") : nullptr;
+
+  int gx,gy,gz;
+  field.ghost_depth (0,&gx,&gy,&gz);
+  int nx,ny,nz;
+  field.size (&nx,&ny,&nz);
+  const int ngx = nx + 2*gx;
+  const int ngy = ny + 2*gy;
+
+  // log density, log specific internal energy and metal mass fraction
+  // of active cells
+
+  const int n = nx*ny*nz;
+  std::vector<double> log_density (n);
+  std::vector<double> log_energy (n);
+  std::vector<double> metal_fraction (n,0.0);
+  double range[2][2] = { { std::numeric_limits<double>::max(),
+                           -std::numeric_limits<double>::max() },
+                         { std::numeric_limits<double>::max(),
+                           -std::numeric_limits<double>::max() } };
+  int k = 0;
+  for (int iz=gz; iz<nz+gz; iz++) {
+    for (int iy=gy; iy<ny+gy; iy++) {
+      for (int ix=gx; ix<nx+gx; ix++, k++) {
+        const int i = INDEX(ix,iy,iz,ngx,ngy);
+        log_density[k] = std::log10(density[i]);
+        log_energy[k]  = std::log10(internal_energy[i]);
+        if (metals) metal_fraction[k] = metal_density[i] / density[i];
+        range[0][0] = std::min(range[0][0], log_density[k]);
+        range[0][1] = std::max(range[0][1], log_density[k]);
+        range[1][0] = std::min(range[1][0], log_energy[k]);
+        range[1][1] = std::max(range[1][1], log_energy[k]);
+      }
+    }
+  }
+
+  // rebuild table if units changed or values are out of range
+
+  code_units grackle_units;
+  setup_grackle_units(EnzoFieldAdaptor(block,0), &grackle_units);
+
+  cooling_table_.update (grackle_chemistry, grackle_rates_ptr_(), grackle_units,
+                         range[0], range[1]);
+
+  // interpolate rates at active cells
+
+  double rate_max = 0.0;
+  for (int i=0; i<n; i++) {
+    const double rate = cooling_table_.rate
+      (log_density[i], log_energy[i], metal_fraction[i]);
+    rate_max = std::max(rate_max, std::abs(rate));
+  }
+
+  return (rate_max > 0.0) ?
+    1.0 / rate_max : std::numeric_limits<double>::max();
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMethodGrackle::compute_local_property_
 (const EnzoFieldAdaptor& fadaptor, enzo_float* values, int stale_depth,
  code_units* grackle_units, grackle_field_data* grackle_fields,
@@ -802,14 +1245,7 @@ void EnzoMethodGrackle::compute_local_property_
            (ax_start == 0) & ((ax_end+1) == ax_dim));
   }
 
-  // because this function is const-qualified, grackle_rates_ currently has
-  // the type: const chemistry_data_storage *
-  // we need to drop the `const` to be able to pass to to func (this is okay
-  // because func will not actually modify the value).
-  chemistry_data_storage * grackle_rates_ptr
-    = const_cast<chemistry_data_storage *>(&grackle_rates_);
-
-  if ((*func)(enzo_config->method_grackle_chemistry, grackle_rates_ptr,
+  if ((*func)(enzo_config->method_grackle_chemistry, grackle_rates_ptr_(),
 	      grackle_units, grackle_fields, values) == ENZO_FAIL){
     ERROR1("EnzoMethodGrackle::compute_local_property_()",
 	   "Error in call to Grackles's %s routine", func_name.c_str());
@@ -837,9 +1273,10 @@ void EnzoMethodGrackle::deallocate_grackle_rates_() throw()
 	  "grackle_rates_ data has not been allocated");
   }
 
-  // deallocate previously the allocated allocated grackle_rates_ (doesn't
-  // actually affect the chemistry_data pointer)
-  _free_chemistry_data(enzo_config->method_grackle_chemistry, &grackle_rates_);
+  // release grackle_rates_; the tables remain in SharedTable for other
+  // PEs in this process (doesn't actually affect the chemistry_data
+  // pointer)
+  grackle_rates_.reset();
   // signal that grackle_data_ is not initialized
   time_grackle_data_initialized_ = ENZO_FLOAT_UNDEFINED;
 #endif //CONFIG_USE_GRACKLE
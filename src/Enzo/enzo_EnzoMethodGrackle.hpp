@@ -33,6 +33,129 @@ typedef int (*grackle_local_property_func)(chemistry_data*,
 					   chemistry_data_storage *,
 					   code_units*, grackle_field_data*,
 					   enzo_float*);
+
+/// @struct   EnzoGrackleDerivedField
+/// @ingroup  Enzo
+/// @brief    [\ref Enzo] Memoized Grackle-derived field of a Block
+///
+/// Values are reused while the Block time, the modification epochs of
+/// Grackle's input fields, and the Block's ghost epoch are unchanged
+struct EnzoGrackleDerivedField {
+
+  EnzoGrackleDerivedField()
+    : values(), key(), time(-1.0)
+  { }
+
+  /// Return the key for the given input fields, as for other derived
+  /// fields (see EnzoDerivedFields::key())
+  static std::vector<long long> make_key
+  (const Field & field, const std::vector<int> & field_input);
+
+  /// Return whether values of the given size are current for the
+  /// Block time and key
+  bool is_current (double t, const std::vector<long long> & k,
+                   size_t size) const
+  { return time == t && key == k && values.size() == size; }
+
+  /// Derived field values, including ghost zones
+  std::vector<enzo_float> values;
+  /// Input field epochs and ghost epoch when values were computed
+  std::vector<long long> key;
+  /// Block time when values were computed
+  double time;
+};
+
+/// @struct   EnzoGrackleFieldBinding
+/// @ingroup  Enzo
+/// @brief    [\ref Enzo] Grackle field data bound to a Block's fields
+///
+/// Cached by EnzoMethodGrackle across cycles to avoid rebuilding
+/// grackle_field_data each time the method is applied.  The binding
+/// is valid as long as the Block's field storage is unchanged.
+struct EnzoGrackleFieldBinding {
+
+  EnzoGrackleFieldBinding()
+    : grackle_fields(),
+      grid_start_all(),
+      grid_end_all(),
+      index(),
+      density(nullptr),
+      cycle(-1),
+      field_modified(),
+      field_input(),
+      cooling_time(),
+      temperature()
+  { }
+
+  ~EnzoGrackleFieldBinding()
+  {
+    delete [] grackle_fields.grid_dimension;
+    delete [] grackle_fields.grid_start;
+    delete [] grackle_fields.grid_end;
+  }
+
+  EnzoGrackleFieldBinding(const EnzoGrackleFieldBinding&) = delete;
+  EnzoGrackleFieldBinding& operator=(const EnzoGrackleFieldBinding&) = delete;
+
+  /// Grackle fields; grid_start and grid_end exclude ghost zones
+  grackle_field_data grackle_fields;
+  /// Grid start and end including ghost zones
+  int grid_start_all[3];
+  int grid_end_all[3];
+  /// Index of the bound Block, used to detect reused Block addresses
+  Index index;
+  /// Density array of the bound Block, used to detect reallocation
+  const void * density;
+  /// Cycle in which the binding was last used
+  int cycle;
+  /// Ids of fields updated by local_solve_chemistry()
+  std::vector<int> field_modified;
+  /// Ids of fields read by Grackle
+  std::vector<int> field_input;
+  /// Memoized cooling time
+  EnzoGrackleDerivedField cooling_time;
+  /// Memoized temperature
+  EnzoGrackleDerivedField temperature;
+};
+
+/// @struct   EnzoGrackleRates
+/// @ingroup  Enzo
+/// @brief    [\ref Enzo] Grackle rate tables shared by the PEs of a process
+///
+/// Includes the Cloudy metal cooling tables read from the Grackle data
+/// file.  Requested from SharedTable, so that the tables are read once
+/// per process rather than once per PE
+struct EnzoGrackleRates {
+
+  /// Initialize Grackle's rate tables for the given units
+  EnzoGrackleRates(chemistry_data * grackle_chemistry,
+                   const code_units & grackle_units)
+    : chemistry(),
+      units(grackle_units),
+      rates()
+  {
+    if (_initialize_chemistry_data(grackle_chemistry, &rates, &units)
+        == ENZO_FAIL) {
+      ERROR("EnzoGrackleRates::EnzoGrackleRates()",
+            "Error in _initialize_chemistry_data");
+    }
+    chemistry = *grackle_chemistry;
+  }
+
+  ~EnzoGrackleRates()
+  { _free_chemistry_data(&chemistry, &rates); }
+
+  EnzoGrackleRates(const EnzoGrackleRates&) = delete;
+  EnzoGrackleRates& operator=(const EnzoGrackleRates&) = delete;
+
+  /// Copy of the chemistry parameters the tables were built for, kept
+  /// so that the tables can be freed after EnzoConfig is destroyed
+  chemistry_data chemistry;
+  /// Units the tables were built for
+  code_units units;
+  /// Grackle's rate tables
+  chemistry_data_storage rates;
+};
 #endif
 
 
@@ -63,8 +186,11 @@ public: // interface
     : Method (m)
 #ifdef CONFIG_USE_GRACKLE
       , grackle_units_()
-      , grackle_rates_()
+      , grackle_rates_(nullptr)
       , time_grackle_data_initialized_(ENZO_FLOAT_UNDEFINED)
+      , field_binding_()
+      , field_binding_cycle_(-1)
+      , cooling_table_()
 #endif
     {  }
 
@@ -87,10 +213,10 @@ public: // interface
       ASSERT("EnzoMethodGrackle::pup",
              "grackle_chemistry_data must have previously been initialized",
              last_init_time!=ENZO_FLOAT_UNDEFINED);
-      // the following recomputes grackle_rates_ (and sets the value of
-      // time_grackle_data_initialized_ to last_init_time). This is done
-      // to avoid writing pup methods for all of Grackle's internal data
-      // structures.
+      // the following requests grackle_rates_ again (and sets the value
+      // of time_grackle_data_initialized_ to last_init_time). This is
+      // done to avoid writing pup methods for all of Grackle's internal
+      // data structures, and shares the tables with other PEs.
       time_grackle_data_initialized_ = ENZO_FLOAT_UNDEFINED;
       initialize_grackle_chemistry_data(last_init_time, true);
     }
@@ -108,6 +234,10 @@ public: // interface
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
+  /// Reads the fluid and Grackle input fields, and updates the
+  /// energies, species and cooling time
+  virtual bool data_access (Access & access) const throw();
+
 #ifdef CONFIG_USE_GRACKLE
 
   void define_required_grackle_fields();
@@ -141,6 +271,23 @@ public: // interface
                          grackle_fields, 0, false);
   }
 
+  /// Return whether chemistry can be solved with
+  /// solve_chemistry_batched(), which requires every cell to be
+  /// solved independently of its position and neighbors
+  static bool batching_supported
+  (const chemistry_data * grackle_chemistry) throw();
+
+  /// Solve chemistry on the cells between grid_start and grid_end
+  /// compacted into contiguous 1D batches of batch_size cells, with
+  /// cells that require subcycling grouped together.  Returns
+  /// ENZO_FAIL if Grackle fails
+  static int solve_chemistry_batched
+  (chemistry_data * grackle_chemistry,
+   chemistry_data_storage * grackle_rates,
+   code_units * grackle_units,
+   grackle_field_data * grackle_fields,
+   double dt, int batch_size) throw();
+
   /// Assists with problem initialization
   ///
   /// Scales species density fields to be sensible mass fractions of the
@@ -205,6 +352,24 @@ public: // interface
 			    "local_calculate_pressure");
   }
 
+  /// Compute the cooling time of a Block, reusing the previous result
+  /// if none of Grackle's input fields changed since it was computed
+  void calculate_cooling_time(Block * block, enzo_float* ct) const throw()
+  {
+    compute_memoized_(block, ct, &EnzoGrackleFieldBinding::cooling_time,
+                      &local_calculate_cooling_time,
+                      "local_calculate_cooling_time");
+  }
+
+  /// Compute the temperature of a Block, reusing the previous result
+  /// if none of Grackle's input fields changed since it was computed
+  void calculate_temperature(Block * block, enzo_float* t) const throw()
+  {
+    compute_memoized_(block, t, &EnzoGrackleFieldBinding::temperature,
+                      &local_calculate_temperature,
+                      "local_calculate_temperature");
+  }
+
   void calculate_temperature(const EnzoFieldAdaptor& fadaptor,
                              enzo_float* temperature, int stale_depth = 0,
 			     code_units* grackle_units = nullptr,
@@ -226,6 +391,32 @@ protected: // methods
 
 #ifdef CONFIG_USE_GRACKLE
 
+  /// Return Grackle's rate tables.  Grackle's functions take a
+  /// non-const pointer, but do not modify the tables
+  chemistry_data_storage * grackle_rates_ptr_() const throw()
+  { return const_cast<chemistry_data_storage *>(&grackle_rates_->rates); }
+
+  /// Return the cached Grackle field binding for the Block, creating
+  /// or rebuilding it if the Block's field storage changed
+  EnzoGrackleFieldBinding * bind_grackle_fields_
+  (Block * block, const EnzoFieldAdaptor& fadaptor) const throw();
+
+  /// Compute a local property of the Block over all cells, reusing
+  /// the memoized values if still valid
+  void compute_memoized_(Block * block, enzo_float * values,
+                         EnzoGrackleDerivedField EnzoGrackleFieldBinding::* cache,
+                         grackle_local_property_func func,
+                         std::string func_name) const throw();
+
+  /// Estimate the minimum absolute cooling time over active cells by
+  /// interpolating in a table of cooling rates
+  double min_cooling_time_tabulated_(Block * block) throw();
+
+  /// Recompute total energy from internal energy on active cells
+  void update_total_energy_(Block * block,
+                            const grackle_field_data * grackle_fields)
+    const throw();
+
   // when grackle_units is NULL, new values are temporarily allocated
   void compute_local_property_(const EnzoFieldAdaptor& fadaptor,
                                enzo_float* values, int stale_depth,
@@ -246,9 +437,24 @@ protected: // methods
 // protected: // attributes
 
   code_units grackle_units_;
-  chemistry_data_storage grackle_rates_;
+
+  /// Grackle rate tables shared with other PEs.  Not pup'ed: requested
+  /// again when unpacking
+  std::shared_ptr<const EnzoGrackleRates> grackle_rates_;
   double time_grackle_data_initialized_;
 
+  /// Cached Grackle field bindings of Blocks on this process.  Not
+  /// pup'ed: bindings are rebuilt on first use
+  mutable std::unordered_map
+  <const Block *, std::unique_ptr<EnzoGrackleFieldBinding> > field_binding_;
+
+  /// Most recent cycle in which field_binding_ was pruned
+  mutable int field_binding_cycle_;
+
+  /// Table of cooling rates for Method:grackle:cooling_time_table.
+  /// Not pup'ed: rebuilt on first use
+  EnzoGrackleCoolingTable cooling_table_;
+
 #endif
 
 };
@@ -110,6 +110,25 @@ EnzoMethodGravity::EnzoMethodGravity
 
 //----------------------------------------------------------------------
 
+bool EnzoMethodGravity::data_access (Access & access) const throw()
+{
+  // temporary fields of the linear solver are private to the solve,
+  // and debugging copies that are not defined are ignored
+
+  access.field_read =
+    { "density", "density_total", "B", "potential",
+      "density_particle", "density_particle_accumulate",
+      "acceleration_x", "acceleration_y", "acceleration_z" };
+  access.field_write =
+    { "density_total", "B", "potential",
+      "acceleration_x", "acceleration_y", "acceleration_z",
+      "density_particle_accumulate",
+      "B_copy", "D_copy", "DT_copy", "potential_copy" };
+  return true;
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMethodGravity::compute(Block * block) throw()
 {
   if (enzo::simulation()->cycle() == enzo::config()->initial_cycle) {
@@ -87,6 +87,9 @@ public: // interface
   /// Compute maximum timestep for this method
   virtual double timestep (Block * block) throw() ;
 
+  /// Reads densities and updates the potential and accelerations
+  virtual bool data_access (Access & access) const throw();
+
   /// Compute accelerations from potential and exit solver
   void compute_accelerations (EnzoBlock * enzo_block) throw();
 
@@ -14,7 +14,8 @@
 EnzoMethodHeat::EnzoMethodHeat (double alpha, double courant)
   : Method(),
     alpha_(alpha),
-    courant_(courant)
+    courant_(courant),
+    i_old_(-1)
 {
 
   cello::define_field ("temperature");
@@ -25,6 +26,10 @@ EnzoMethodHeat::EnzoMethodHeat (double alpha, double courant)
   Refresh * refresh = cello::refresh(ir_post_);
   refresh->add_field("temperature");
 
+  // Temporary field for values before the update
+
+  i_old_ = cello::field_descr()->insert_temporary();
+
 }
 
 //----------------------------------------------------------------------
@@ -40,6 +45,33 @@ void EnzoMethodHeat::pup (PUP::er &p)
 
   p | alpha_;
   p | courant_;
+  p | i_old_;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodHeat::compute_interior ( Block * block) throw()
+{
+  if (block->is_leaf()) {
+
+    Field field = block->data()->field();
+
+    enzo_float * T = (enzo_float *) field.values ("temperature");
+
+    // save values before the update, since the boundary cells updated
+    // in compute() depend on old values of interior cells
+
+    field.allocate_temporary (i_old_);
+
+    enzo_float * U = (enzo_float *) field.values (i_old_);
+
+    int mx,my,mz;
+    field.dimensions ("temperature",&mx,&my,&mz);
+
+    copy_ (U,T,mx,my,mz);
+
+    compute_ (block,T,U,true);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -51,9 +83,40 @@ void EnzoMethodHeat::compute ( Block * block) throw()
 
     Field field = block->data()->field();
 
+    // compute_interior() is not called if refreshes are not overlapped
+
+    if (field.values (i_old_) == nullptr) compute_interior (block);
+
     enzo_float * T = (enzo_float *) field.values ("temperature");
+    enzo_float * U = (enzo_float *) field.values (i_old_);
+
+    // copy refreshed ghost zone values
+
+    int mx,my,mz;
+    int gx,gy,gz;
+    field.dimensions  ("temperature",&mx,&my,&mz);
+    field.ghost_depth ("temperature",&gx,&gy,&gz);
+    if (my == 1) gy = 0;
+    if (mz == 1) gz = 0;
+
+    for (int iz=0; iz<mz; iz++) {
+      for (int iy=0; iy<my; iy++) {
+        for (int ix=0; ix<mx; ix++) {
+          const bool is_ghost =
+            (ix < gx || ix >= mx-gx) ||
+            (iy < gy || iy >= my-gy) ||
+            (iz < gz || iz >= mz-gz);
+          if (is_ghost) {
+            const int i = ix + mx*(iy + my*iz);
+            U[i] = T[i];
+          }
+        }
+      }
+    }
 
-    compute_ (block,T);
+    compute_ (block,T,U,false);
+
+    field.deallocate_temporary (i_old_);
   }
 
   block->compute_done();
@@ -87,7 +150,9 @@ double EnzoMethodHeat::timestep ( Block * block ) throw()
 
 //======================================================================
 
-void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) throw()
+void EnzoMethodHeat::compute_
+(Block * block, enzo_float * Unew, const enzo_float * U, bool interior)
+  throw()
 {
   Data * data = block->data();
   Field field   =      data->field();
@@ -114,61 +179,47 @@ void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) throw()
   double dyi = 1.0/(hy*hy);
   double dzi = 1.0/(hz*hz);
 
-  const int m = mx*my*mz;
-
   const int rank = ((mz == 1) ? ((my == 1) ? 1 : 2) : 3);
 
   double dt = timestep(block);
 
-  enzo_float * U = new enzo_float [m];
-  for (int i=0; i<m; i++) U[i]=Unew[i];
-
-  if (rank == 1) {
-
-    for (int ix=gx; ix<mx-gx; ix++) {
+  // Active cells are [lo,hi), and interior cells [li,hi_i) those
+  // that compute_interior() may update
 
-      int i = ix;
+  int lo[3] = {gx,    gy,    gz};
+  int hi[3] = {mx-gx, my-gy, mz-gz};
+  if (rank < 2) { lo[1] = 0; hi[1] = 1; }
+  if (rank < 3) { lo[2] = 0; hi[2] = 1; }
 
-      enzo_float Uxx = dxi*(U[i-idx] - 2*U[i] + U[i+idx]);
+  int li[3], hi_i[3];
+  interior_range_ (block,id_temp_,1,li,hi_i);
 
-      Unew[i] = U[i] + alpha_*dt*(Uxx);
+  const int * kl = interior ? li   : lo;
+  const int * kh = interior ? hi_i : hi;
 
-    }
-
-  } else if (rank == 2) {
-
-    for (int iy=gy; iy<my-gy; iy++) {
-      for (int ix=gy; ix<mx-gy; ix++) {
+  for (int iz=kl[2]; iz<kh[2]; iz++) {
+    for (int iy=kl[1]; iy<kh[1]; iy++) {
 
-	int i = ix + mx*iy;
+      // boundary cells in rows through the interior are only at the ends
 
-	enzo_float Uxx = dxi*(U[i-idx] - 2*U[i] + U[i+idx]);
-	enzo_float Uyy = dyi*(U[i-idy] - 2*U[i] + U[i+idy]);
+      const bool skip_interior = (! interior) &&
+        (li[2] <= iz && iz < hi_i[2]) &&
+        (li[1] <= iy && iy < hi_i[1]);
 
-	Unew[i] = U[i] + alpha_*dt*(Uxx + Uyy);
+      for (int ix=kl[0]; ix<kh[0]; ix++) {
 
-      }
-    }
+        if (skip_interior && ix == li[0]) ix = std::max(li[0],hi_i[0]);
+        if (ix >= kh[0]) break;
 
-  } else if (rank == 3) {
+        int i = ix + mx*(iy + my*iz);
 
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
+        enzo_float Ut = dxi*(U[i-idx] - 2*U[i] + U[i+idx]);
+        if (rank >= 2) Ut += dyi*(U[i-idy] - 2*U[i] + U[i+idy]);
+        if (rank >= 3) Ut += dzi*(U[i-idz] - 2*U[i] + U[i+idz]);
 
-	  int i = ix + mx*(iy + my*iz);
+        Unew[i] = U[i] + alpha_*dt*(Ut);
 
-	  enzo_float Uxx = dxi*(U[i-idx] - 2*U[i] + U[i+idx]);
-	  enzo_float Uyy = dyi*(U[i-idy] - 2*U[i] + U[i+idy]);
-	  enzo_float Uzz = dzi*(U[i-idz] - 2*U[i] + U[i+idz]);
-
-	  Unew[i] = U[i] + alpha_*dt*(Uxx + Uyy + Uzz);
-
-	}
       }
     }
   }
-
-  delete [] U;
-
 }
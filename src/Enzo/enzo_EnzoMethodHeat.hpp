@@ -25,7 +25,8 @@ public: // interface
   EnzoMethodHeat()
     : Method(),
       alpha_(0.0),
-      courant_(0.0)
+      courant_(0.0),
+      i_old_(-1)
   { }
 
   /// Charm++ PUP::able declarations
@@ -35,7 +36,8 @@ public: // interface
   EnzoMethodHeat (CkMigrateMessage *m)
     : Method (m),
       alpha_(0.0),
-      courant_(0.0)
+      courant_(0.0),
+      i_old_(-1)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -44,15 +46,33 @@ public: // interface
   /// Apply the method to advance a block one timestep 
   virtual void compute( Block * block) throw();
 
+  /// Update interior cells while ghost zones are being refreshed
+  virtual bool overlap_refresh () const throw()
+  { return true; }
+
+  /// Update cells whose stencils do not include ghost zones
+  virtual void compute_interior( Block * block) throw();
+
   virtual std::string name () throw () 
   { return "heat"; }
 
+  /// Reads and writes temperature
+  virtual bool data_access (Access & access) const throw()
+  {
+    access.field_read.push_back("temperature");
+    access.field_write.push_back("temperature");
+    return true;
+  }
+
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
 protected: // methods
 
-  void compute_ (Block * block, enzo_float * Unew ) throw();
+  /// Update cells in Unew from old values U, either only the
+  /// interior cells or only the remaining active cells
+  void compute_ (Block * block, enzo_float * Unew, const enzo_float * U,
+                 bool interior) throw();
 
 protected: // attributes
 
@@ -61,6 +81,9 @@ protected: // attributes
 
   /// Courant safety number
   double courant_;
+
+  /// Temporary field holding temperature values before the update
+  int i_old_;
 };
 
 #endif /* ENZO_ENZO_METHOD_HEAT_HPP */
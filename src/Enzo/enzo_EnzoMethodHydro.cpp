@@ -108,6 +108,31 @@ void EnzoMethodHydro::pup (PUP::er &p)
 
 //----------------------------------------------------------------------
 
+bool EnzoMethodHydro::data_access (Access & access) const throw()
+{
+  const std::vector<std::string> field_list =
+    { "density", "total_energy", "internal_energy", "pressure",
+      "velocity_x", "velocity_y", "velocity_z" };
+
+  Grouping * field_groups = cello::field_descr()->groups();
+  const int num_color = field_groups->size("color");
+
+  for (int pass = 0; pass < 2; pass++) {
+    std::vector<std::string> & list =
+      (pass == 0) ? access.field_read : access.field_write;
+    list.insert(list.end(), field_list.begin(), field_list.end());
+    for (int ic = 0; ic < num_color; ic++) {
+      list.push_back(field_groups->item("color",ic));
+    }
+  }
+  access.field_read.push_back("acceleration_x");
+  access.field_read.push_back("acceleration_y");
+  access.field_read.push_back("acceleration_z");
+  return true;
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMethodHydro::compute ( Block * block) throw()
 {
 
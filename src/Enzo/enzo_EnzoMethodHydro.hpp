@@ -183,6 +183,9 @@ public: // virtual methods
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
+  /// Reads accelerations and updates the hydrodynamic and color fields
+  virtual bool data_access (Access & access) const throw();
+
 protected: // methods
 
   void ppm_method_ (Block * block);
@@ -9,12 +9,8 @@
 
 #include "enzo.hpp"
 
-//#define DEBUG_PRINT_REDUCED_VARIABLES
 //#define DEBUG_PRINT_GROUP_PARAMETERS
-//#define DEBUG_RECOMBINATION
 //#define DEBUG_INJECTION
-//#define DEBUG_TRANSPORT
-//#define DEBUG_ATTENUATION
 
 //----------------------------------------------------------------------
 
@@ -143,8 +139,8 @@ EnzoMethodM1Closure ::EnzoMethodM1Closure(const int N_groups)
        ("photon_density_"+istring+"_deposit", "photon_density_"+istring); 
   }
 
-  // read in data tables
-  M1_tables = new M1Tables();
+  // read in data tables, or share them if already read on this node
+  M1_tables = shared_tables_();
 
   refresh_injection->set_callback(CkIndex_EnzoBlock::p_method_m1_closure_solve_transport_eqn()); 
 }
@@ -157,6 +153,19 @@ M1Tables::M1Tables ()
     read_hll_eigenvalues(enzo_config->method_m1_closure_hll_file);
   } 
 }
+
+//----------------------------------------------------------------------
+
+std::shared_ptr<const M1Tables> EnzoMethodM1Closure::shared_tables_() throw()
+{
+  const EnzoConfig * enzo_config = enzo::config();
+  std::string key = "m1_closure:" + enzo_config->method_m1_closure_flux_function;
+  if (enzo_config->method_m1_closure_flux_function == "HLL") {
+    key += ":" + enzo_config->method_m1_closure_hll_file;
+  }
+  return SharedTable::get<M1Tables>(key, []() { return new M1Tables(); });
+}
+
 //----------------------------------------------------------------------
 
 void EnzoMethodM1Closure ::pup (PUP::er &p)
@@ -170,6 +179,9 @@ void EnzoMethodM1Closure ::pup (PUP::er &p)
 
   p | N_groups_;
   p | ir_injection_;
+
+  // tables are not pup'ed but shared again after unpacking
+  if (p.isUnpacking()) M1_tables = shared_tables_();
 }
 
 //----------------------------------------------------------------------
@@ -657,255 +669,76 @@ void M1Tables::read_hll_eigenvalues(std::string hll_file) throw()
                     this->hll_table_lambda_max_[i]) i++;
 
     inFile.close();
-}
 
-
-
-void EnzoMethodM1Closure::compute_hll_eigenvalues (double f, double theta, double * lmin, double * lmax, 
-                                                    double clight) throw() 
-{
-  double lf = f*100;
-  double lt = theta/cello::pi * 100;
-
-  int i = std::min(int(lf),99);
-  int j = std::min(int(lt),99);
-
-  double dd1 = lf - i;
-  double dd2 = lt - j;
-  double de1 = 1 - dd1; 
-  double de2 = 1 - dd2;
-
-  *lmin = 0.0;
-  *lmin += de1*de2*M1_tables->hll_table_lambda_min(i  ,j  );
-  *lmin += dd1*de2*M1_tables->hll_table_lambda_min(i+1,j  );
-  *lmin += de1*dd2*M1_tables->hll_table_lambda_min(i  ,j+1);
-  *lmin += dd1*dd2*M1_tables->hll_table_lambda_min(i+1,j+1);
-
-  *lmax = 0.0;
-  *lmax += de1*de2*M1_tables->hll_table_lambda_max(i  ,j  );
-  *lmax += dd1*de2*M1_tables->hll_table_lambda_max(i+1,j  );
-  *lmax += de1*dd2*M1_tables->hll_table_lambda_max(i  ,j+1);
-  *lmax += dd1*dd2*M1_tables->hll_table_lambda_max(i+1,j+1);
+    // interleave (lambda_min,lambda_max) so that each interpolation
+    // stencil point is a single 16-byte load
+    hll_table_lambda_.resize(2*line_count);
+    for (int k=0; k<line_count; k++) {
+      hll_table_lambda_[2*k  ] = hll_table_lambda_min_[k];
+      hll_table_lambda_[2*k+1] = hll_table_lambda_max_[k];
+    }
 }
 
 //----------------------------------------------------------------------
 
-double EnzoMethodM1Closure::flux_function (double U_l, double U_lplus1,
-					    double Q_l, double Q_lplus1, double clight,
-                                            double lmin, double lmax,  
-					    std::string type) throw()
-{
-  // returns face-flux of a cell at index idx
-  if (type == "GLF") {
-    return 0.5*(  Q_l+Q_lplus1 - clight*(U_lplus1-U_l) ); 
-  }
+namespace {
 
-  else if (type == "HLL") {
-    return (lmax*Q_l - lmin*Q_lplus1 + lmax*lmin*clight*(U_lplus1-U_l)) / (lmax - lmin);
+  /// bilinear interpolation of the interleaved (lambda_min,lambda_max)
+  /// HLL eigenvalue table
+  inline void m1_hll_eigenvalues
+  (const double * table, double f, double theta, double * lmin, double * lmax)
+  {
+    double lf = f*100;
+    double lt = theta/cello::pi * 100;
+
+    int i = std::min(int(lf),99);
+    int j = std::min(int(lt),99);
+
+    double dd1 = lf - i;
+    double dd2 = lt - j;
+    double de1 = 1 - dd1;
+    double de2 = 1 - dd2;
+
+    const double * l00 = table + 2*(100*(i  ) + j  );
+    const double * l10 = table + 2*(100*(i+1) + j  );
+    const double * l01 = table + 2*(100*(i  ) + j+1);
+    const double * l11 = table + 2*(100*(i+1) + j+1);
+
+    *lmin = 0.0;
+    *lmin += de1*de2*l00[0];
+    *lmin += dd1*de2*l10[0];
+    *lmin += de1*dd2*l01[0];
+    *lmin += dd1*dd2*l11[0];
+
+    *lmax = 0.0;
+    *lmax += de1*de2*l00[1];
+    *lmax += dd1*de2*l10[1];
+    *lmax += de1*dd2*l01[1];
+    *lmax += dd1*dd2*l11[1];
   }
 
-  else {
-    ERROR("EnzoMethodM1Closure::flux_function",
-	     "flux_function type not recognized");
-    return 0.0; 
-  }
-}
-
-//--------------------------------------------------------------------------
-
-double EnzoMethodM1Closure::deltaQ_faces (double U_l, double U_lplus1, double U_lminus1,
-                                                  double Q_l, double Q_lplus1, double Q_lminus1,
-                                                  double clight, double lmin, double lmax, 
-                                                  std::string flux_type) throw()
-{
-  // calls flux_function(), and calculates Q_{i-1/2} - Q_{i+1/2}
-  
-  return flux_function(U_lminus1, U_l     , Q_lminus1, Q_l     , clight, lmin, lmax, flux_type) - 
-         flux_function(U_l      , U_lplus1, Q_l      , Q_lplus1, clight, lmin, lmax, flux_type); 
-}
-
-//--------------------------------------------------------------------------
-
-void EnzoMethodM1Closure::get_reduced_variables (double * chi, double (*n)[3], int i, double clight,
-                               enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz) throw()
-{
-  double Fnorm = sqrt(Fx[i]*Fx[i] + Fy[i]*Fy[i] + Fz[i]*Fz[i]);
-  double f = N[i] > 0 ? std::min(Fnorm / (clight*N[i] ), 1.0) : 0.0; // reduced flux ( 0 < f < 1)
-  *chi = (3 + 4*f*f) / (5 + 2*sqrt(4-3*f*f)); // isotropy measure (1/3 < chi < 1)
-  if (Fnorm > 0.0) {
-    (*n)[0] = Fx[i]/Fnorm;
-    (*n)[1] = Fy[i]/Fnorm; 
-    (*n)[2] = Fz[i]/Fnorm;
+  /// face flux between cells l and l+1 (GLF or HLL)
+  inline double m1_flux_function
+  (bool is_hll, double U_l, double U_lplus1, double Q_l, double Q_lplus1,
+   double clight, double lmin, double lmax)
+  {
+    return is_hll ?
+      (lmax*Q_l - lmin*Q_lplus1 + lmax*lmin*clight*(U_lplus1-U_l)) / (lmax - lmin) :
+      0.5*(  Q_l+Q_lplus1 - clight*(U_lplus1-U_l) );
   }
 
-  #ifdef DEBUG_PRINT_REDUCED_VARIABLES
-    CkPrintf("i = %d; N = %1.2e; Fx = %1.2e; Fy = %1.2e; Fz = %1.2e; f = %1.2e; chi = %1.2e; n=[%1.2e,%1.2e,%1.2e]\n", i, N[i], Fx[i], Fy[i], Fz[i], f, *chi, (*n)[0], (*n)[1], (*n)[2]); 
-  #endif
-}
-
-//--------------------------------------------------------------------------
-
-void EnzoMethodM1Closure::get_pressure_tensor (EnzoBlock * enzo_block, 
-                       enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz, double clight) 
-                       throw()
-{
-  Field field = enzo_block->data()->field();
-  int mx,my,mz;  
-  field.dimensions(0,&mx, &my, &mz); //field dimensions, including ghost zones
-  int gx,gy,gz;
-  field.ghost_depth(0,&gx, &gy, &gz);
-
-  // if rank >= 1
-  enzo_float * P00 = (enzo_float *) field.values("P00");
-  // if rank >= 2
-  enzo_float * P10 = (enzo_float *) field.values("P10");
-  enzo_float * P01 = (enzo_float *) field.values("P01");
-  enzo_float * P11 = (enzo_float *) field.values("P11");
-  // if rank >= 3
-  enzo_float * P02 = (enzo_float *) field.values("P02");
-  enzo_float * P12 = (enzo_float *) field.values("P12");
-  enzo_float * P20 = (enzo_float *) field.values("P20");
-  enzo_float * P21 = (enzo_float *) field.values("P21"); 
-  enzo_float * P22 = (enzo_float *) field.values("P22"); 
-
-  // Need to directly calculate pressure tensor elements 
-  // one layer deep into the ghost zones because active cells
-  // need information about their neighbors, and there's no 
-  // guarantee that a neighboring block will have updated
-  // its pressure tensor by the time this block starts
-  //
-  // Note that we're actually storing c^P, since that's the actual
-  // value that's being converted to a flux 
-  for (int iz=gz-1; iz<mz-gz+1; iz++) { 
-   for (int iy=gy-1; iy<my-gy+1; iy++) {
-    for (int ix=gx-1; ix<mx-gx+1; ix++) {
-      int i = INDEX(ix,iy,iz,mx,my); //index of current cell
-      double chi;
-      double n[3] = {0.0, 0.0, 0.0}; 
-      get_reduced_variables( &chi, &n, i, clight, 
-                            N, Fx, Fy, Fz);
-      double iterm = 0.5*(1.0-chi);   // identity term
-      double oterm = 0.5*(3.0*chi-1); // outer product term
-      double cc = clight * clight;
-      P00[i] = cc * N[i] * (oterm *n[0]*n[0] + iterm );
-      P10[i] = cc * N[i] *  oterm *n[1]*n[0];
-      P01[i] = cc * N[i] *  oterm *n[0]*n[1];
-      P11[i] = cc * N[i] * (oterm *n[1]*n[1] + iterm );
-      P02[i] = cc * N[i] *  oterm *n[0]*n[2];
-      P12[i] = cc * N[i] *  oterm *n[1]*n[2];
-      P20[i] = cc * N[i] *  oterm *n[2]*n[0];
-      P21[i] = cc * N[i] *  oterm *n[2]*n[1];
-      P22[i] = cc * N[i] * (oterm *n[2]*n[2] + iterm );
-    }
-   }
+  /// Q_{k-1/2} - Q_{k+1/2} along the axis with (group-major) stride d
+  inline double m1_delta_q
+  (bool is_hll, const enzo_float * U, const enzo_float * Q, int k, int d,
+   double clight, double lmin, double lmax)
+  {
+    return
+      m1_flux_function(is_hll, U[k-d], U[k], Q[k-d], Q[k], clight, lmin, lmax) -
+      m1_flux_function(is_hll, U[k], U[k+d], Q[k], Q[k+d], clight, lmin, lmax);
   }
 
 }
 
-//--------------------------------------------------------------------------
-
-
-void EnzoMethodM1Closure::get_U_update (EnzoBlock * enzo_block, double * N_update, 
-                       double * Fx_update, double * Fy_update, double * Fz_update, 
-                       enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz,
-                       double hx, double hy, double hz, double dt, double clight, 
-                       int i, int idx, int idy, int idz) throw()
-{
-  Field field = enzo_block->data()->field();
-  // if rank >= 1
-  enzo_float * P00 = (enzo_float *) field.values("P00");
-  // if rank >= 2
-  enzo_float * P10 = (enzo_float *) field.values("P10");
-  enzo_float * P01 = (enzo_float *) field.values("P01");
-  enzo_float * P11 = (enzo_float *) field.values("P11");
-  // if rank >= 3
-  enzo_float * P02 = (enzo_float *) field.values("P02");
-  enzo_float * P12 = (enzo_float *) field.values("P12");
-  enzo_float * P20 = (enzo_float *) field.values("P20");
-  enzo_float * P21 = (enzo_float *) field.values("P21"); 
-  enzo_float * P22 = (enzo_float *) field.values("P22"); 
-
-  // if using HLL flux function, compute eigenvalues here
-  std::string flux_type = enzo::config()->method_m1_closure_flux_function;
-
-  // HLL min and max eigenvalues
-  // +/- clight corresponds to GLF flux function
-  double lmin_x = -1.0, lmin_y = -1.0, lmin_z = -1.0;
-  double lmax_x =  1.0, lmax_y =  1.0, lmax_z =  1.0;
-
-  if (flux_type == "HLL") {
-    double Fnorm = sqrt(Fx[i]*Fx[i] + Fy[i]*Fy[i] + Fz[i]*Fz[i]);
-    double f = std::min(Fnorm / (N[i]*clight), 1.0);
-
-    double theta_x = acos(std::min(Fx[i] / Fnorm, -1.0));
-    double theta_y = acos(std::min(Fy[i] / Fnorm, -1.0));
-    double theta_z = acos(std::min(Fz[i] / Fnorm, -1.0));
-
-    compute_hll_eigenvalues(f, theta_x, &lmin_x, &lmax_x, clight);
-    compute_hll_eigenvalues(f, theta_y, &lmin_y, &lmax_y, clight);
-    compute_hll_eigenvalues(f, theta_z, &lmin_z, &lmax_z, clight);
-  } 
-  
-  // if rank >= 1
-  *N_update += dt/hx * deltaQ_faces( N[i],  N[i+idx],  N[i-idx],
-                                   Fx[i], Fx[i+idx], Fx[i-idx], clight, lmin_x, lmax_x, flux_type );
-    
-  *Fx_update += dt/hx * deltaQ_faces(Fx[i], Fx[i+idx], Fx[i-idx],
-                                   P00[i],
-                                   P00[i+idx],
-                                   P00[i-idx], clight, lmin_x, lmax_x, flux_type );
-
-  // if rank >= 2
-  *N_update += dt/hy * deltaQ_faces( N[i],  N[i+idy],  N[i-idy],
-                                   Fy[i], Fy[i+idy], Fy[i-idy], clight, lmin_y, lmax_y, flux_type );
-
-  *Fx_update += dt/hy * deltaQ_faces(Fx[i], Fx[i+idy], Fx[i-idy],
-                                   P10[i],
-                                   P10[i+idy],
-                                   P10[i-idy], clight, lmin_y, lmax_y, flux_type );
-
-  *Fy_update += dt/hx * deltaQ_faces(Fy[i], Fy[i+idx], Fy[i-idx],
-                                   P01[i],
-                                   P01[i+idx],
-                                   P01[i-idx], clight, lmin_x, lmax_x, flux_type );
-
-  *Fy_update += dt/hy * deltaQ_faces(Fy[i], Fy[i+idy], Fy[i-idy],
-                                   P11[i],
-                                   P11[i+idy],
-                                   P11[i-idy], clight, lmin_y, lmax_y, flux_type );
-
-
-   // if rank >= 3
-  *N_update += dt/hz * deltaQ_faces( N[i],  N[i+idz],  N[i-idz],
-                                   Fz[i], Fz[i+idz], Fz[i-idz], clight, lmin_z, lmax_z, flux_type );
-
-  *Fx_update += dt/hz * deltaQ_faces(Fx[i], Fx[i+idz], Fx[i-idz],
-                                   P20[i],
-                                   P20[i+idz],
-                                   P20[i-idz], clight, lmin_z, lmax_z, flux_type );
-
-  *Fy_update += dt/hz * deltaQ_faces(Fy[i], Fy[i+idz], Fy[i-idz],
-                                   P21[i],
-                                   P21[i+idz],
-                                   P21[i-idz], clight, lmin_z, lmax_z, flux_type);
-
-  *Fz_update += dt/hx * deltaQ_faces(Fz[i], Fz[i+idx], Fz[i-idx],
-                                   P02[i],
-                                   P02[i+idx],
-                                   P02[i-idx], clight, lmin_x, lmax_x, flux_type);
-
-  *Fz_update += dt/hy * deltaQ_faces(Fz[i], Fz[i+idy], Fz[i-idy],
-                                   P12[i],
-                                   P12[i+idy],
-                                   P12[i-idy], clight, lmin_y, lmax_y, flux_type);
-
-  *Fz_update += dt/hz * deltaQ_faces(Fz[i], Fz[i+idz], Fz[i-idz],
-                                   P22[i],
-                                   P22[i+idz],
-                                   P22[i-idz], clight, lmin_z, lmax_z, flux_type);
-
-}
-
 //----------------------------------
 
 double EnzoMethodM1Closure::sigma_vernier (double energy, int type) throw()
@@ -1169,105 +1002,17 @@ int EnzoMethodM1Closure::get_b_boolean (double E_lower, double E_upper, int spec
 
 //---------------------------------
 
-double EnzoMethodM1Closure::C_add_recombination (EnzoBlock * enzo_block,
-                                                enzo_float * T, int i, int igroup,
-                                                double E_lower, double E_upper) throw()
-{
-  // update photon_density to account for recombination
-  // 2nd half of eq 25, using backwards-in-time quantities for all variables.
-  // this is called once for each group.
-
-  Field field = enzo_block->data()->field();
-  if (! field.is_field("density")) return 0.0;
-
-  EnzoUnits * enzo_units = enzo::units();
-  double rhounit = enzo_units->density();
-  double Cunit = enzo_units->photon_number_density() / enzo_units->time(); 
-
-  enzo_float * e_density = (enzo_float *) field.values("e_density");
-
-  std::vector<std::string> chemistry_fields = {"HI_density", 
-                                               "HeI_density", "HeII_density"};
-  double mH  = enzo_constants::mass_hydrogen; // cgs
-
-  std::vector<double> masses = {mH,4*mH, 4*mH};
-
-  double C = 0.0;
-  for (std::size_t j=0; j<chemistry_fields.size(); j++) {  
-    enzo_float * density_j = (enzo_float *) field.values(chemistry_fields[j]);
-     
-    int b = get_b_boolean(E_lower, E_upper, j);
-
-    double alpha_A = get_alpha(T[i], j, 'A');  // cgs
-    double alpha_B = get_alpha(T[i], j, 'B');
-
-    double n_j = density_j[i]*rhounit/masses[j];
-    double n_e = e_density[i]*rhounit/mH; // electrons have same mass as protons in code units
-
-    C += b*(alpha_A-alpha_B) * n_j*n_e / Cunit;
-
-#ifdef DEBUG_RECOMBINATION
-    CkPrintf("MethodM1Closure::C_add_recombination -- j=%d; alpha_A = %1.3e; alpha_B = %1.3e; n_j = %1.3e; n_e = %1.3e; b_boolean = %d\n", j, alpha_A, alpha_B, n_j, n_e, b);
-#endif
-  }
-
-#ifdef DEBUG_RECOMBINATION
-  CkPrintf("MethodM1Closure::C_add_recombination -- [E_lower, E_upper] = [%.2f, %.2f]; dN_dt[i] = %1.3e; dt = %1.3e\n", E_lower, E_upper, C, enzo_block->dt);
-#endif 
-
-  return C;
-}
-
-//---------------------------------
-
-double EnzoMethodM1Closure::D_add_attenuation ( EnzoBlock * enzo_block, 
-                                             double clight, int i, int igroup) throw()
-{
-  // Attenuate radiation
-
-  EnzoUnits * enzo_units = enzo::units();
-  double rhounit = enzo_units->density();
-  double tunit = enzo_units->time();
-
-  Field field = enzo_block->data()->field();
-
-  if (! field.is_field("density")) return 0.0;
- 
-  std::vector<std::string> chemistry_fields = {"HI_density", 
-                                               "HeI_density", "HeII_density"};
-
-  double mH = enzo_constants::mass_hydrogen;
-  std::vector<double> masses = {mH,4*mH, 4*mH};
- 
-  Scalar<double> scalar = enzo_block->data()->scalar_double();
-  double D = 0.0;
-  for (std::size_t j=0; j<chemistry_fields.size(); j++) {  
-    enzo_float * density_j = (enzo_float *) field.values(chemistry_fields[j]);
-    double n_j = density_j[i]*rhounit / masses[j];     
-    double sigN_ij = *(scalar.value( scalar.index( sigN_string(igroup, j) )));
-    
-    D += n_j * clight*sigN_ij * tunit; // code_time^-1
-
-    #ifdef DEBUG_ATTENUATION
-      CkPrintf("[i,j]=[%d,%d]; sigN_ij=%1.2e; n_j=%1.2e; clight=%1.2e\n", igroup, j, sigN_ij, n_j, clight);
-    #endif
-  }
-
-#ifdef DEBUG_ATTENUATION
-    CkPrintf("i=%d; D=%e s^-1; dt = %e\n",i, D / tunit, enzo_block->dt*enzo_units->time());
-#endif 
-  return D; 
-}
-
-//----------------------
-
-void EnzoMethodM1Closure::solve_transport_eqn ( EnzoBlock * enzo_block, int igroup ) throw()
+void EnzoMethodM1Closure::solve_transport_eqn ( EnzoBlock * enzo_block ) throw()
 {
   // Solve dU/dt + del[F(U)] = 0; F(U) = { (Fx,Fy,Fz), c^2 P }
   //                                U  = { N, (Fx,Fy,Fz) }
   // M1 closure: P_i = D_i * N_i, where D_i is the Eddington tensor for 
   // photon group i
- 
+  //
+  // All photon groups are updated in a single sweep.  Group fields are
+  // gathered into group-major scratch arrays (index i*ng + g), so the
+  // innermost loop runs over the groups of one cell with unit stride
+
   const EnzoConfig * enzo_config = enzo::config();
   EnzoUnits * enzo_units = enzo::units();
 
@@ -1282,35 +1027,19 @@ void EnzoMethodM1Closure::solve_transport_eqn ( EnzoBlock * enzo_block, int igro
   enzo_block->lower(&xm,&ym,&zm);
   enzo_block->upper(&xp,&yp,&zp);
 
-  // array incremenent (because 3D array of field values are flattened to 1D)
-  const int idx = 1;
-  const int idy = mx;
-  const int idz = mx*my; 
-
-  // energy bounds for this group (leave in eV)
-  double E_lower = enzo_config->method_m1_closure_energy_lower[igroup]; 
-  double E_upper = enzo_config->method_m1_closure_energy_upper[igroup]; 
-  
-  std::string istring = std::to_string(igroup);
-  enzo_float * N  = (enzo_float *) field.values("photon_density_" + istring);
-  enzo_float * Fx = (enzo_float *) field.values("flux_x_" + istring);
-  enzo_float * Fy = (enzo_float *) field.values("flux_y_" + istring);
-  enzo_float * Fz = (enzo_float *) field.values("flux_z_" + istring);
-
-  enzo_float * T = (enzo_float *) field.values("temperature");
-
+  const int ng = enzo_config->method_m1_closure_N_groups;
   const int m = mx*my*mz;
 
-  // extra copy of fields needed to store
-  // the evolved values until the end
-  enzo_float * Nnew  = new enzo_float[m]; 
-  enzo_float * Fxnew = new enzo_float[m];
-  enzo_float * Fynew = new enzo_float[m];
-  enzo_float * Fznew = new enzo_float[m];
+  // array increments in the group-major scratch arrays
+  const int dx = ng;
+  const int dy = ng*mx;
+  const int dz = ng*mx*my; 
 
   double lunit = enzo_units->length();
   double tunit = enzo_units->time();
   double Nunit = enzo_units->photon_number_density();
+  double rhounit = enzo_units->density();
+  double Cunit = enzo_units->photon_number_density() / enzo_units->time(); 
 
   double dt = enzo_block->dt;
   double hx = (xp-xm)/(mx-2*gx);
@@ -1318,93 +1047,257 @@ void EnzoMethodM1Closure::solve_transport_eqn ( EnzoBlock * enzo_block, int igro
   double hz = (zp-zm)/(mz-2*gz);
   double clight_cgs = enzo_config->method_m1_closure_clight_frac*enzo_constants::clight; 
   double clight_code = clight_cgs * tunit/lunit;
-  
-  for (int i=0; i<m; i++)
-  {
-    Nnew [i] = N [i];
-    Fxnew[i] = Fx[i];
-    Fynew[i] = Fy[i];
-    Fznew[i] = Fz[i];
-  }
 
+  const double dt_hx = dt/hx;
+  const double dt_hy = dt/hy;
+  const double dt_hz = dt/hz;
 
-  //calculate the radiation pressure tensor
-  get_pressure_tensor(enzo_block, N, Fx, Fy, Fz, clight_code);
-  
   double Nmin = enzo_config->method_m1_closure_min_photon_density / Nunit;
 
-  for (int iz=gz; iz<mz-gz; iz++) {
-    for (int iy=gy; iy<my-gy; iy++) {
-      for (int ix=gx; ix<mx-gx; ix++) {
-        int i = INDEX(ix,iy,iz,mx,my); //index of current cell
-        double N_update=0, Fx_update=0, Fy_update=0, Fz_update=0;
-      
-        get_U_update( enzo_block, &N_update, &Fx_update, &Fy_update, &Fz_update,
-                             N, Fx, Fy, Fz, hx, hy, hz, dt, clight_code,
-                             i, idx, idy, idz ); 
-        
-        // get updated fluxes
-        Fxnew[i] += Fx_update;
-        Fynew[i] += Fy_update;
-        Fznew[i] += Fz_update;
+  const bool is_hll = (enzo_config->method_m1_closure_flux_function == "HLL");
+  const double * hll_table = is_hll ? M1_tables->hll_table_lambda() : nullptr;
 
-        // now get updated photon densities
-        Nnew[i] = std::max(Nnew[i] + N_update, Nmin);
+  // look up group fields and per-group scalars once per block
 
+  std::vector<enzo_float *> N_g(ng), Fx_g(ng), Fy_g(ng), Fz_g(ng);
+  for (int g=0; g<ng; g++) {
+    std::string istring = std::to_string(g);
+    N_g [g] = (enzo_float *) field.values("photon_density_" + istring);
+    Fx_g[g] = (enzo_float *) field.values("flux_x_" + istring);
+    Fy_g[g] = (enzo_float *) field.values("flux_y_" + istring);
+    Fz_g[g] = (enzo_float *) field.values("flux_z_" + istring);
+  }
 
-      #ifdef DEBUG_TRANSPORT
-        CkPrintf("i = %d; N_update = %f; Fx_update = %f; Nnew[i] = %f; hx = %f; dt = %f \n", i, N_update, Fx_update, Nnew[i], hx, dt);
-      #endif
-
+  // only three ionizable species (HI, HeI, HeII) interact with the
+  // radiation here
+  const int ns = 3;
+  const char * chemistry_fields[ns] = {"HI_density", "HeI_density", "HeII_density"};
+  double mH  = enzo_constants::mass_hydrogen; // cgs
+  const double masses[ns] = {mH, 4*mH, 4*mH};
+
+  const bool has_density = field.is_field("density");
+  const bool do_attenuation =
+    has_density && enzo_config->method_m1_closure_attenuation;
+  // Grackle does recombination chemistry, but doesn't
+  // do anything about the radiation that comes out of recombination
+  const bool do_recombination =
+    has_density && enzo_config->method_m1_closure_recombination_radiation;
+
+  enzo_float * density_j[ns] = {nullptr, nullptr, nullptr};
+  enzo_float * e_density = nullptr;
+  enzo_float * T = nullptr;
+  if (do_attenuation || do_recombination) {
+    for (int j=0; j<ns; j++) {
+      density_j[j] = (enzo_float *) field.values(chemistry_fields[j]);
+    }
+  }
+  if (do_recombination) {
+    e_density = (enzo_float *) field.values("e_density");
+    T = (enzo_float *) field.values("temperature");
+  }
 
-        // add interactions with matter 
+  // sigN[j*ng+g] and b[j*ng+g]: photoionization cross section and
+  // recombination boolean of species j for group g
+  std::vector<double> sigN(ns*ng, 0.0);
+  std::vector<double> b(ns*ng, 0.0);
+  Scalar<double> scalar = enzo_block->data()->scalar_double();
+  for (int g=0; g<ng; g++) {
+    double E_lower = enzo_config->method_m1_closure_energy_lower[g]; 
+    double E_upper = enzo_config->method_m1_closure_energy_upper[g]; 
+    for (int j=0; j<ns; j++) {
+      if (do_attenuation) {
+        sigN[j*ng+g] = *(scalar.value( scalar.index( sigN_string(g, j) )));
+      }
+      b[j*ng+g] = get_b_boolean(E_lower, E_upper, j);
+    }
+  }
 
-        double C = 0.0; // photon creation term
-        double D = 0.0; // photon destruction term
+  // gather group fields into group-major scratch arrays
+
+  ScratchFrame scratch;
+  enzo_float * N  = scratch.allocate<enzo_float>(m*ng);
+  enzo_float * Fx = scratch.allocate<enzo_float>(m*ng);
+  enzo_float * Fy = scratch.allocate<enzo_float>(m*ng);
+  enzo_float * Fz = scratch.allocate<enzo_float>(m*ng);
+  for (int i=0; i<m; i++) {
+    for (int g=0; g<ng; g++) {
+      N [i*ng+g] = N_g [g][i];
+      Fx[i*ng+g] = Fx_g[g][i];
+      Fy[i*ng+g] = Fy_g[g][i];
+      Fz[i*ng+g] = Fz_g[g][i];
+    }
+  }
 
-        if (enzo_config->method_m1_closure_attenuation) {
-          D = D_add_attenuation(enzo_block, clight_cgs, i, igroup);
+  // Calculate the radiation pressure tensor directly one layer deep
+  // into the ghost zones because active cells need information about
+  // their neighbors, and there's no guarantee that a neighboring block
+  // will have updated its pressure tensor by the time this block starts
+  //
+  // Note that we're actually storing c^2 P, since that's the actual
+  // value that's being converted to a flux.  P is symmetric, so only
+  // its six unique components are stored
+
+  enzo_float * P00 = scratch.allocate<enzo_float>(m*ng);
+  enzo_float * P01 = scratch.allocate<enzo_float>(m*ng);
+  enzo_float * P02 = scratch.allocate<enzo_float>(m*ng);
+  enzo_float * P11 = scratch.allocate<enzo_float>(m*ng);
+  enzo_float * P12 = scratch.allocate<enzo_float>(m*ng);
+  enzo_float * P22 = scratch.allocate<enzo_float>(m*ng);
+
+  const double cc = clight_code * clight_code;
+  for (int iz=gz-1; iz<mz-gz+1; iz++) { 
+    for (int iy=gy-1; iy<my-gy+1; iy++) {
+      for (int ix=gx-1; ix<mx-gx+1; ix++) {
+        const int i = INDEX(ix,iy,iz,mx,my); //index of current cell
+#pragma omp simd
+        for (int g=0; g<ng; g++) {
+          const int k = i*ng + g;
+          double Fnorm = sqrt(Fx[k]*Fx[k] + Fy[k]*Fy[k] + Fz[k]*Fz[k]);
+          // reduced flux ( 0 < f < 1)
+          double f = N[k] > 0 ? std::min(Fnorm / (clight_code*N[k] ), 1.0) : 0.0;
+          // isotropy measure (1/3 < chi < 1)
+          double chi = (3 + 4*f*f) / (5 + 2*sqrt(4-3*f*f));
+          double n0 = (Fnorm > 0.0) ? Fx[k]/Fnorm : 0.0;
+          double n1 = (Fnorm > 0.0) ? Fy[k]/Fnorm : 0.0;
+          double n2 = (Fnorm > 0.0) ? Fz[k]/Fnorm : 0.0;
+          double iterm = 0.5*(1.0-chi);   // identity term
+          double oterm = 0.5*(3.0*chi-1); // outer product term
+          P00[k] = cc * N[k] * (oterm *n0*n0 + iterm );
+          P01[k] = cc * N[k] *  oterm *n0*n1;
+          P02[k] = cc * N[k] *  oterm *n0*n2;
+          P11[k] = cc * N[k] * (oterm *n1*n1 + iterm );
+          P12[k] = cc * N[k] *  oterm *n1*n2;
+          P22[k] = cc * N[k] * (oterm *n2*n2 + iterm );
         }
+      }
+    }
+  }
 
-        if (enzo_config->method_m1_closure_recombination_radiation) {
-          // update photon density due to recombinations
-          // Grackle does recombination chemistry, but doesn't
-          // do anything about the radiation that comes out of recombination
-          C = C_add_recombination(enzo_block, T, i, igroup, E_lower, E_upper);
+  // the "Pij" fields hold the pressure tensor of the last group, as
+  // they did when groups were solved one at a time
+  {
+    enzo_float * P_field[9];
+    const char * P_name[9] =
+      {"P00", "P10", "P01", "P11", "P02", "P12", "P20", "P21", "P22"};
+    const enzo_float * P_src[9] =
+      {P00, P01, P01, P11, P02, P12, P02, P12, P22};
+    for (int l=0; l<9; l++) P_field[l] = (enzo_float *) field.values(P_name[l]);
+    const int g = ng - 1;
+    for (int iz=gz-1; iz<mz-gz+1; iz++) { 
+      for (int iy=gy-1; iy<my-gy+1; iy++) {
+        for (int ix=gx-1; ix<mx-gx+1; ix++) {
+          const int i = INDEX(ix,iy,iz,mx,my);
+          for (int l=0; l<9; l++) P_field[l][i] = P_src[l][i*ng+g];
         }
-        
-        // update radiation fields due to thermochemistry (see appendix A)
-        double mult = 1.0/(1+dt*D);
-        Nnew [i] = std::max((Nnew [i] + dt*C) * mult, Nmin);
-        Fxnew[i] = Fxnew[i] * mult;
-        Fynew[i] = Fynew[i] * mult;
-        Fznew[i] = Fznew[i] * mult;
       }
-    } 
-  } 
-  
-  // now copy values over  
+    }
+  }
+
+  std::vector<double> D(ng), C(ng);
+  int num_nan = 0;
+
   for (int iz=gz; iz<mz-gz; iz++) {
     for (int iy=gy; iy<my-gy; iy++) {
       for (int ix=gx; ix<mx-gx; ix++) {
-        int i = INDEX(ix,iy,iz,mx,my); //index of current cell
-        N [i] = Nnew [i];
-        Fx[i] = Fxnew[i];
-        Fy[i] = Fynew[i];
-        Fz[i] = Fznew[i];
-  
-        if ( isnan(N[i]) ) {
-          ERROR("EnzoMethodM1Closure::solve_transport_eqn()", 
-                "N[i] is NaN!\n");
+        const int i = INDEX(ix,iy,iz,mx,my); //index of current cell
+
+        // interactions with matter: D (photon destruction term) and C
+        // (photon creation term, eq 25) depend on the group only through
+        // sigN and b, so per-cell species terms are evaluated once
+
+        for (int g=0; g<ng; g++) {
+          D[g] = 0.0;
+          C[g] = 0.0;
+        }
+        for (int j=0; j<ns; j++) {
+          if (do_attenuation) {
+            double n_j = density_j[j][i]*rhounit / masses[j];     
+            const double * sigN_j = sigN.data() + j*ng;
+            for (int g=0; g<ng; g++) {
+              D[g] += n_j * clight_cgs*sigN_j[g] * tunit; // code_time^-1
+            }
+          }
+          if (do_recombination) {
+            double alpha_A = get_alpha(T[i], j, 'A');  // cgs
+            double alpha_B = get_alpha(T[i], j, 'B');
+            double n_j = density_j[j][i]*rhounit/masses[j];
+            double n_e = e_density[i]*rhounit/mH; // electrons have same mass as protons in code units
+            double c_j = (alpha_A-alpha_B) * n_j*n_e / Cunit;
+            const double * b_j = b.data() + j*ng;
+            for (int g=0; g<ng; g++) {
+              C[g] += b_j[g]*c_j;
+            }
+          }
+        }
+
+#pragma omp simd reduction(+:num_nan)
+        for (int g=0; g<ng; g++) {
+          const int k = i*ng + g;
+
+          // HLL min and max eigenvalues
+          // +/- clight corresponds to GLF flux function
+          double lmin_x = -1.0, lmin_y = -1.0, lmin_z = -1.0;
+          double lmax_x =  1.0, lmax_y =  1.0, lmax_z =  1.0;
+
+          if (is_hll) {
+            double Fnorm = sqrt(Fx[k]*Fx[k] + Fy[k]*Fy[k] + Fz[k]*Fz[k]);
+            double f = std::min(Fnorm / (N[k]*clight_code), 1.0);
+
+            double theta_x = acos(std::min(Fx[k] / Fnorm, -1.0));
+            double theta_y = acos(std::min(Fy[k] / Fnorm, -1.0));
+            double theta_z = acos(std::min(Fz[k] / Fnorm, -1.0));
+
+            m1_hll_eigenvalues(hll_table, f, theta_x, &lmin_x, &lmax_x);
+            m1_hll_eigenvalues(hll_table, f, theta_y, &lmin_y, &lmax_y);
+            m1_hll_eigenvalues(hll_table, f, theta_z, &lmin_z, &lmax_z);
+          }
+
+          const double c = clight_code;
+          double N_update = 0.0;
+          double Fx_update = 0.0, Fy_update = 0.0, Fz_update = 0.0;
+
+          N_update  += dt_hx * m1_delta_q(is_hll, N,  Fx,  k, dx, c, lmin_x, lmax_x);
+          Fx_update += dt_hx * m1_delta_q(is_hll, Fx, P00, k, dx, c, lmin_x, lmax_x);
+          N_update  += dt_hy * m1_delta_q(is_hll, N,  Fy,  k, dy, c, lmin_y, lmax_y);
+          Fx_update += dt_hy * m1_delta_q(is_hll, Fx, P01, k, dy, c, lmin_y, lmax_y);
+          Fy_update += dt_hx * m1_delta_q(is_hll, Fy, P01, k, dx, c, lmin_x, lmax_x);
+          Fy_update += dt_hy * m1_delta_q(is_hll, Fy, P11, k, dy, c, lmin_y, lmax_y);
+          N_update  += dt_hz * m1_delta_q(is_hll, N,  Fz,  k, dz, c, lmin_z, lmax_z);
+          Fx_update += dt_hz * m1_delta_q(is_hll, Fx, P02, k, dz, c, lmin_z, lmax_z);
+          Fy_update += dt_hz * m1_delta_q(is_hll, Fy, P12, k, dz, c, lmin_z, lmax_z);
+          Fz_update += dt_hx * m1_delta_q(is_hll, Fz, P02, k, dx, c, lmin_x, lmax_x);
+          Fz_update += dt_hy * m1_delta_q(is_hll, Fz, P12, k, dy, c, lmin_y, lmax_y);
+          Fz_update += dt_hz * m1_delta_q(is_hll, Fz, P22, k, dz, c, lmin_z, lmax_z);
+
+          // get updated fluxes and photon densities
+          enzo_float Fxnew = Fx[k] + Fx_update;
+          enzo_float Fynew = Fy[k] + Fy_update;
+          enzo_float Fznew = Fz[k] + Fz_update;
+          enzo_float Nnew  = std::max(N[k] + N_update, Nmin);
+
+          // update radiation fields due to thermochemistry (see appendix A)
+          double mult = 1.0/(1+dt*D[g]);
+          Nnew  = std::max((Nnew + dt*C[g]) * mult, Nmin);
+          Fxnew = Fxnew * mult;
+          Fynew = Fynew * mult;
+          Fznew = Fznew * mult;
+
+          num_nan += std::isnan(Nnew) ? 1 : 0;
+
+          // scatter back into the group fields
+          N_g [g][i] = Nnew;
+          Fx_g[g][i] = Fxnew;
+          Fy_g[g][i] = Fynew;
+          Fz_g[g][i] = Fznew;
         }
       }
-    }
+    } 
   } 
 
-  delete [] Nnew;
-  delete [] Fxnew;
-  delete [] Fynew;
-  delete [] Fznew;
+  if (num_nan > 0) {
+    ERROR("EnzoMethodM1Closure::solve_transport_eqn()", 
+          "N[i] is NaN!\n");
+  }
 }
 
 //----------------------------------------------------------------------
@@ -1666,13 +1559,10 @@ void EnzoMethodM1Closure::call_solve_transport_eqn(EnzoBlock * enzo_block) throw
   const EnzoConfig * enzo_config = enzo::config();
   EnzoUnits * enzo_units = enzo::units();
 
-  int N_groups = enzo_config->method_m1_closure_N_groups;
   double clight = enzo_config->method_m1_closure_clight_frac * enzo_constants::clight;
 
-  // loop through groups and solve transport equation for each group
-  for (int igroup=0; igroup<N_groups; igroup++) {
-    this->solve_transport_eqn(enzo_block, igroup);
-  }
+  // solve transport equation for all groups at once
+  this->solve_transport_eqn(enzo_block);
 
   if (enzo_config->method_m1_closure_thermochemistry) {
     // Calculate photoheating and photoionization rates.
@@ -26,12 +26,16 @@ public:
   double hll_table_col3       (int i, int j) const throw() { return hll_table_col3_[100*i+j]; }
   double hll_table_col4       (int i, int j) const throw() { return hll_table_col4_[100*i+j]; }
 
+  /// interleaved (lambda_min,lambda_max) pairs, indexed as 2*(100*i+j)
+  const double * hll_table_lambda () const throw() { return hll_table_lambda_.data(); }
+
 private:
   void read_hll_eigenvalues(std::string hll_file) throw(); 
  
   std::vector<int> hll_table_f_, hll_table_theta_;
   std::vector<double> hll_table_lambda_min_, hll_table_lambda_max_;
   std::vector<double> hll_table_col3_, hll_table_col4_;
+  std::vector<double> hll_table_lambda_;
 };
 
 //-----------------------------------------------
@@ -59,6 +63,7 @@ public: // interface
     : Method (m)
     , N_groups_(0)
     , ir_injection_(-1)
+    , M1_tables()
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -77,8 +82,7 @@ public: // interface
   //--------- CONTROL FLOW --------
   //  compute_ -> call_inject_photons -> inject_photons ->
   //  refresh -> call_solve_transport_eqn -> 
-  //  solve_transport_eqn, C_add_recombination, D_add_attenuation, 
-  //    get_photoionization_and_heating_rates 
+  //  solve_transport_eqn, get_photoionization_and_heating_rates 
 
 
  /// calls inject_photons(), sets the groups' mean cross sections & energies,
@@ -178,51 +182,21 @@ protected: // methods
 
   //--------- TRANSPORT STEP --------
 
-
-  double flux_function (double U_l, double U_lplus1,
-                        double Q_l, double Q_lplus1,
-                        double clight, double lmin, double lmax, std::string type) throw();
-
-  void compute_hll_eigenvalues(double f, double theta, double * lmin, double * lmax, double clight) throw();
-
-  double deltaQ_faces (double U_l, double U_lplus1, double U_lminus1, 
-                       double Q_l, double Q_lplus1, double Q_lminus1,
-                       double clight, double lmin, double lmax, std::string flux_type) throw();
-
-  void get_reduced_variables (double * chi_idx, double (*n_idx)[3], int i, double clight,
-                              enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz) 
-                              throw(); 
-
-  void get_pressure_tensor (EnzoBlock * enzo_block, 
-                       enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz,
-                       double clight) throw();
-
-  void get_U_update (EnzoBlock * enzo_block, double * N_update, 
-                       double * Fx_update, double * Fy_update, double * Fz_update, 
-                       enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz,
-                       double hx, double hy, double hz, double dt, double clight, 
-                       int i, int idx, int idy, int idz) throw();
-
-  void solve_transport_eqn (EnzoBlock * enzo_block, int igroup) throw();
+  /// solves the transport equation for all photon groups in one sweep,
+  /// including attenuation and recombination radiation from local gas
+  void solve_transport_eqn (EnzoBlock * enzo_block) throw();
 
   void add_LWB (EnzoBlock * enzo_block, double J21);
 
   //---------- THERMOCHEMISTRY STEP ------------
   // Interaction with matter is completely local, so don't need a refresh before this step
 
-  /// computes the photon-loss term from attenuation by local gas
-  double D_add_attenuation ( EnzoBlock * enzo_block, double clight, int i, int igroup) throw(); 
-
-  /// helper function used in C_add_recombination
+  /// recombination rate coefficient used for recombination radiation
   double get_alpha (double T, int species, char rec_case) throw();
 
-  /// helper function used in C_add_recombination
+  /// whether a recombination photon of the given species lies in a group
   int get_b_boolean (double E_lower, double E_upper, int species) throw();
 
-  /// computes the photon-creation term from recombination in local gas
-  double C_add_recombination (EnzoBlock * enzo_block, 
-                              enzo_float * T, int i, int igroup, double E_lower, double E_uppe) throw();
-
   /// Computes the photoionization cross-section of particles in a given gas
   /// species (specified by type) and for photons of energy E
   double sigma_vernier (double energy, int type) throw();
@@ -236,8 +210,17 @@ protected: // attributes
   // Refresh id's
   int ir_injection_;
 
-  // Tables relevant to M1 closure method
-  M1Tables * M1_tables;
+protected: // functions
+
+  /// Return the M1 tables shared by all PEs in the process, reading
+  /// them if this is the first request
+  static std::shared_ptr<const M1Tables> shared_tables_() throw();
+
+protected: // attributes
+
+  // Tables relevant to M1 closure method, shared read-only and not
+  // pup'ed
+  std::shared_ptr<const M1Tables> M1_tables;
 };
 
 
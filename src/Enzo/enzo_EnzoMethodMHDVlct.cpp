@@ -207,6 +207,28 @@ void EnzoMethodMHDVlct::pup (PUP::er &p)
 
 //----------------------------------------------------------------------
 
+bool EnzoMethodMHDVlct::data_access (Access & access) const throw()
+{
+  str_vec_t field_list =
+    concat_str_vec_(integration_field_list_, primitive_field_list_);
+  field_list = concat_str_vec_(field_list, *(lazy_passive_list_.get_list()));
+  field_list.push_back("pressure");
+  if (mhd_choice_ == bfield_choice::constrained_transport) {
+    field_list.push_back("bfieldi_x");
+    field_list.push_back("bfieldi_y");
+    field_list.push_back("bfieldi_z");
+  }
+
+  access.field_read = field_list;
+  access.field_write = field_list;
+  access.field_read.push_back("acceleration_x");
+  access.field_read.push_back("acceleration_y");
+  access.field_read.push_back("acceleration_z");
+  return true;
+}
+
+//----------------------------------------------------------------------
+
 EnzoEFltArrayMap EnzoMethodMHDVlct::get_integration_map_
 (Block * block,  const str_vec_t *passive_list) const noexcept
 {
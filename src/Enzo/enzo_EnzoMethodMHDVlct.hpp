@@ -136,6 +136,11 @@ public: // interface
   ~EnzoMethodMHDVlct();
 
   /// Apply the method to advance a block one timestep 
+  ///
+  /// Does not override overlap_refresh(): the half and full steps
+  /// are applied to whole arrays, with the valid region shrinking by
+  /// the stale depth after each stage, so no cells can be updated
+  /// before the refresh completes
   virtual void compute( Block * block) throw();
 
   virtual std::string name () throw () 
@@ -144,6 +149,10 @@ public: // interface
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
+  /// Reads accelerations and updates the integration, primitive,
+  /// passive scalar and interface magnetic fields
+  virtual bool data_access (Access & access) const throw();
+
 protected: // methods
 
   /// returns the bfield_choice enum that matches the input string
@@ -398,6 +407,19 @@ public:
     primitive_map = setup("primitive", {0,0,0}, primitive_key_list);
     priml_map = setup("priml", {0,0,0}, primitive_key_list);
     primr_map = setup("primr", {0,0,0}, primitive_key_list);
+
+    // report the allocated arrays to the Memory scratch category
+    int64_t num_values = interface_vel_arr.size();
+    for (const EnzoEFltArrayMap* map : {&temp_integration_map, &xflux_map,
+                                        &yflux_map, &zflux_map, &dUcons_map,
+                                        &primitive_map, &priml_map,
+                                        &primr_map}){
+      if (map->size() == 0) { continue; }
+      num_values += (int64_t(map->size()) * map->array_shape(0) *
+                     map->array_shape(1) * map->array_shape(2));
+    }
+    memory_account.set(memory_category_scratch,
+                       num_values * int64_t(sizeof(enzo_float)));
   }
 
 public: // attributes
@@ -437,6 +459,9 @@ public: // attributes
   /// is used, this map won't hold arrays for accumulating changes to the
   /// magnetic fields (that update is handled separately).
   EnzoEFltArrayMap dUcons_map;
+
+  /// Bytes of the arrays reported to Memory categories
+  MemoryAccount memory_account;
 };
 
 #endif /* ENZO_ENZO_METHOD_VLCT_HPP */
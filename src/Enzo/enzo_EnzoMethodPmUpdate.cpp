@@ -70,6 +70,25 @@ void EnzoMethodPmUpdate::pup (PUP::er &p)
 
 //----------------------------------------------------------------------
 
+bool EnzoMethodPmUpdate::data_access (Access & access) const throw()
+{
+  access.field_read.push_back("acceleration_x");
+  access.field_read.push_back("acceleration_y");
+  access.field_read.push_back("acceleration_z");
+
+  Grouping * particle_groups = cello::particle_descr()->groups();
+
+  const int num_is_grav = particle_groups->size("is_gravitating");
+  for (int ipt = 0; ipt < num_is_grav; ipt++) {
+    std::string particle_type = particle_groups->item("is_gravitating",ipt);
+    access.particle_read.push_back(particle_type);
+    access.particle_write.push_back(particle_type);
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMethodPmUpdate::compute ( Block * block) throw()
 {
   TRACE_PM("compute()");
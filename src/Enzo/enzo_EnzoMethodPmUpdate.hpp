@@ -40,6 +40,9 @@ public: // interface
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
+  /// Reads accelerations and updates gravitating particles
+  virtual bool data_access (Access & access) const throw();
+
 protected: // attributes
 
   double max_dt_;
@@ -103,6 +103,31 @@ void EnzoMethodPpm::pup (PUP::er &p)
 
 //----------------------------------------------------------------------
 
+bool EnzoMethodPpm::data_access (Access & access) const throw()
+{
+  const std::vector<std::string> field_list =
+    { "density", "total_energy", "internal_energy", "pressure",
+      "velocity_x", "velocity_y", "velocity_z", "internal_energy_error" };
+
+  Grouping * field_groups = cello::field_descr()->groups();
+  const int num_color = field_groups->size("color");
+
+  for (int pass = 0; pass < 2; pass++) {
+    std::vector<std::string> & list =
+      (pass == 0) ? access.field_read : access.field_write;
+    list.insert(list.end(), field_list.begin(), field_list.end());
+    for (int ic = 0; ic < num_color; ic++) {
+      list.push_back(field_groups->item("color",ic));
+    }
+  }
+  access.field_read.push_back("acceleration_x");
+  access.field_read.push_back("acceleration_y");
+  access.field_read.push_back("acceleration_z");
+  return true;
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMethodPpm::compute ( Block * block) throw()
 {
   TRACE_PPM("BEGIN compute()");
@@ -241,14 +266,18 @@ double EnzoMethodPpm::timestep ( Block * block ) throw()
 
   int rank = cello::rank();
 
-  enzo_float * density    = (enzo_float *)field.values("density");
+  // read-only access, so that derived fields of the block stay cached
+
+  const Field & field_const = field;
+
+  enzo_float * density    = (enzo_float *)field_const.values("density");
   enzo_float * velocity_x = (rank >= 1) ?
-    (enzo_float *)field.values("velocity_x") : NULL;
+    (enzo_float *)field_const.values("velocity_x") : NULL;
   enzo_float * velocity_y = (rank >= 2) ?
-    (enzo_float *)field.values("velocity_y") : NULL;
+    (enzo_float *)field_const.values("velocity_y") : NULL;
   enzo_float * velocity_z = (rank >= 3) ?
-    (enzo_float *)field.values("velocity_z") : NULL;
-  enzo_float * pressure = (enzo_float *) field.values("pressure");
+    (enzo_float *)field_const.values("velocity_z") : NULL;
+  enzo_float * pressure = (enzo_float *) field_const.values("pressure");
 
   /* calculate minimum timestep */
 
@@ -35,6 +35,10 @@ public: // interface
 public: // virtual methods
 
   /// Apply the method to advance a block one timestep 
+  ///
+  /// Does not override overlap_refresh(): the Fortran solver sweeps
+  /// full pencils including ghost zones, so no cells can be updated
+  /// before the refresh completes
   virtual void compute( Block * block) throw();
 
   virtual std::string name () throw () 
@@ -43,6 +47,9 @@ public: // virtual methods
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
+  /// Reads accelerations and updates the hydrodynamic and color fields
+  virtual bool data_access (Access & access) const throw();
+
 protected: // interface
 
   bool comoving_coordinates_;
@@ -59,6 +59,7 @@ EnzoMethodStarMaker::EnzoMethodStarMaker
   use_cooling_time_          = enzo_config->method_star_maker_use_cooling_time;
   use_temperature_threshold_ = enzo_config->method_star_maker_use_temperature_threshold;
   temperature_threshold_     = enzo_config->method_star_maker_temperature_threshold;
+  use_candidate_selection_   = enzo_config->method_star_maker_select_candidates;
 }
 
 //-------------------------------------------------------------------
@@ -84,6 +85,7 @@ void EnzoMethodStarMaker::pup (PUP::er &p)
   p | use_cooling_time_;
   p | use_overdensity_threshold_;
   p | critical_metallicity_;
+  p | use_candidate_selection_;
 
   return;
 }
@@ -190,28 +192,6 @@ void EnzoMethodStarMaker::convert_densities_to_fraction(EnzoBlock * enzo_block,
 
 // ---------------------------------------------------------
 
-int EnzoMethodStarMaker::check_number_density_threshold(
-                                                       const double &d
-                                                        ){
-
-  ///  Apply the criteria that the local number density be greater
-  ///  than the provided number density if use_density_threshold_ is
-  ///  desired by the user.
-
-  return !(this->use_density_threshold_) +
-          (d >= this->number_density_threshold_);
-}
-
-int EnzoMethodStarMaker::check_overdensity_threshold(const double &rho)
-{
-  //#ifdef DEBUG_SF
-  //  CkPrintf("MethodStarMaker -- overdensity = %f\n", rho);
-  //#endif
-  return !(this->use_overdensity_threshold_) +  
-          (rho >= this->overdensity_threshold_);
-}
-
-
 int EnzoMethodStarMaker::check_self_gravitating_alt(const double total_energy, const double potential)
 {
 
@@ -348,17 +328,6 @@ int EnzoMethodStarMaker::check_velocity_divergence(
    return div < 0;
 }
 
-int EnzoMethodStarMaker::check_mass(const double &m){
-  /// Apply the condition that the mass of gas converted into
-  /// stars in a single cell cannot exceed a certain fraction
-  /// of that cell's mass. There does not need to be a check on
-  /// the maximum particle mass.
-
-  int minlimit = ((maximum_star_fraction_ * m) > star_particle_min_mass_);
-  return minlimit;
-
-}
-
 int EnzoMethodStarMaker::check_cooling_time(const double &cooling_time,const double &total_density,
                          const double tunit, const double rhounit)
 {
@@ -374,22 +343,3 @@ int EnzoMethodStarMaker::check_cooling_time(const double &cooling_time,const dou
   return cooling_time*tunit < dynamical_time;
   
 }
-
-int EnzoMethodStarMaker::check_metallicity(const double &Z) 
-{
-  // Enforce a critical metallicity for star formation
-  #ifdef DEBUG_SF
-    CkPrintf("MethodStarMaker -- Z = %f, Zcrit = %f\n",Z, critical_metallicity_); 
-  #endif
-  return !(this->use_critical_metallicity_) +
-          (Z >= critical_metallicity_);
-}
-
-int EnzoMethodStarMaker::check_temperature(const double &T)
-{
-  #ifdef DEBUG_SF
-    CkPrintf("MethodStarMaker -- T = %f, Tcrit = %f\n", T, temperature_threshold_); 
-  #endif
-  return !(this->use_temperature_threshold_) +
-          (T < temperature_threshold_);
-}
@@ -65,17 +65,70 @@ public:
 
 protected: // methods
 
+  /// Write the indices of active cells for which pass(i) is true to
+  /// candidates[], which must hold nx*ny*nz values, and return their
+  /// number.  Cheap criteria are applied to every cell in a
+  /// vectorizable pass, so that expensive criteria need only be
+  /// checked on the (usually few) candidate cells.  pass must not
+  /// have side effects.  If use_candidate_selection_ is false, all
+  /// active cells are candidates, and the caller must apply pass
+  /// itself
+  template <class F>
+  int select_candidates_ (int mx, int my,
+                          int gx, int gy, int gz,
+                          int nx, int ny, int nz,
+                          F pass, int * candidates) const
+  {
+    ScratchFrame scratch;
+    char * flag = scratch.allocate<char>(nx);
+    int n = 0;
+    for (int iz=gz; iz<nz+gz; iz++) {
+      for (int iy=gy; iy<ny+gy; iy++) {
+        const int i0 = gx + mx*(iy + my*iz);
+#pragma omp simd
+        for (int ix=0; ix<nx; ix++) {
+          flag[ix] = (! use_candidate_selection_ || pass(i0 + ix)) ? 1 : 0;
+        }
+        // branch-free compaction
+        for (int ix=0; ix<nx; ix++) {
+          candidates[n] = i0 + ix;
+          n += flag[ix];
+        }
+      }
+    }
+    return n;
+  }
+
   // Routine functions for checking certain conditions
   //
-  int check_number_density_threshold(const double &d);
-  int check_overdensity_threshold(const double &rho);
+
+  ///  Apply the criteria that the local number density be greater
+  ///  than the provided number density if use_density_threshold_ is
+  ///  desired by the user.
+  int check_number_density_threshold(const double &d) const
+  {
+    return !(this->use_density_threshold_) +
+      (d >= this->number_density_threshold_);
+  }
+
+  int check_overdensity_threshold(const double &rho) const
+  {
+    return !(this->use_overdensity_threshold_) +
+      (rho >= this->overdensity_threshold_);
+  }
+
   int check_velocity_divergence(
                 enzo_float *vx, enzo_float *vy, enzo_float *vz,
                 const int &index, const int &dix, const int &diy,
                 const int &diz,
                 const double dx, const double dy, const double dz);
 
-  int check_mass(const double &m);
+  /// Apply the condition that the mass of gas converted into
+  /// stars in a single cell cannot exceed a certain fraction
+  /// of that cell's mass. There does not need to be a check on
+  /// the maximum particle mass.
+  int check_mass(const double &m) const
+  { return ((maximum_star_fraction_ * m) > star_particle_min_mass_); }
 
   int check_self_gravitating(
     const double mean_particle_mass, const double density,
@@ -97,8 +150,19 @@ protected: // methods
     const double munit, const double rhounit);
   int check_cooling_time(const double &cooling_time, const double &total_density,
     const double rhounit, const double tunit);
-  int check_metallicity(const double &Z);
-  int check_temperature(const double &T);
+
+  /// Enforce a critical metallicity for star formation
+  int check_metallicity(const double &Z) const
+  {
+    return !(this->use_critical_metallicity_) +
+      (Z >= critical_metallicity_);
+  }
+
+  int check_temperature(const double &T) const
+  {
+    return !(this->use_temperature_threshold_) +
+      (T < temperature_threshold_);
+  }
 
 
 protected: // attributes
@@ -122,6 +186,10 @@ protected: // attributes
   double star_particle_min_mass_;
   double star_particle_max_mass_;
   double temperature_threshold_;
+  /// Whether select_candidates_() applies the cheap criteria; if
+  /// false every active cell is a candidate and all criteria are
+  /// checked in the original single pass
+  bool use_candidate_selection_;
   // variables to be passsed here
 };
 
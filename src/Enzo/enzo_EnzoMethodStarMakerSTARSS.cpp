@@ -12,7 +12,6 @@
 
 #include "cello.hpp"
 #include "enzo.hpp"
-#include <time.h>
 
 // #define DEBUG_SF_CRITERIA
 // #define DEBUG_STORE_INITIAL_PROPERTIES
@@ -53,8 +52,6 @@ void EnzoMethodStarMakerSTARSS::compute ( Block *block) throw()
   // Loop through the grid and check star formation criteria
   // stochastically form stars if zone meets these criteria
 
-  // TODO: Make random seed an input parameter
-  std::mt19937 mt(std::time(nullptr));
   int count = 0;
 
   const EnzoConfig * enzo_config = enzo::config();
@@ -160,12 +157,14 @@ void EnzoMethodStarMakerSTARSS::compute ( Block *block) throw()
   
   enzo_float * potential    = (enzo_float *) field.values("potential");
 
+  // velocities are only read
+  const Field & field_const = field;
   enzo_float * velocity_x = (rank >= 1) ?
-    (enzo_float *)field.values("velocity_x") : NULL;
+    (enzo_float *)field_const.values("velocity_x") : NULL;
   enzo_float * velocity_y = (rank >= 2) ?
-    (enzo_float *)field.values("velocity_y") : NULL;
+    (enzo_float *)field_const.values("velocity_y") : NULL;
   enzo_float * velocity_z = (rank >= 3) ?
-    (enzo_float *)field.values("velocity_z") : NULL;
+    (enzo_float *)field_const.values("velocity_z") : NULL;
 
   enzo_float * metal = field.is_field("metal_density") ?
     (enzo_float *) field.values("metal_density") : NULL;
@@ -230,305 +229,323 @@ void EnzoMethodStarMakerSTARSS::compute ( Block *block) throw()
   compute_temperature.compute(enzo_block);
 
 
-  double mu = static_cast<double>(enzo::fluid_props()->mol_weight());
-  // iterate over all cells (not including ghost zones)
-  for (int iz=gz; iz<nz+gz; iz++){
-    for (int iy=gy; iy<ny+gy; iy++){
-      for (int ix=gx; ix<nx+gx; ix++){
+  // mean molecular weight in cell i
+  // TODO: Make EnzoComputeMeanMolecularWeight class and reference
+  // mu_field here?
+  const double mu_default = static_cast<double>(enzo::fluid_props()->mol_weight());
+  #ifdef CONFIG_USE_GRACKLE
+    const chemistry_data * grackle_chemistry = enzo_config->method_grackle_chemistry;
+    const int primordial_chemistry = (grackle_chemistry) ?
+      grackle_chemistry->primordial_chemistry : 0;
+  #else
+    const int primordial_chemistry = 0;
+  #endif
+  auto mean_molecular_weight = [&](int i) -> double {
+    if (primordial_chemistry == 0) return mu_default;
+    double n = d_el[i] + dHI[i] + dHII[i] + 0.25*(dHeI[i]+dHeII[i]+dHeIII[i]);
+    if (primordial_chemistry > 1) {
+      n += dHM[i] + 0.5*(dH2I[i]+dH2II[i]);
+    }
+    if (primordial_chemistry > 2) {
+      n += 0.5*(dDI[i] + dDII[i]) + dHDI[i]/3.0;
+    }
+    return density[i] / n;
+  };
+
+  // Phase one: apply the cheap, cell-local criteria to every active
+  // cell and keep only the candidates that pass them all
+  //
+  // In cosmology, units are scaled such that mean(density) = 1,
+  // so density IS overdensity in these units
+
+  // velocity divergence, shared with other methods through the
+  // Block's DerivedFieldCache
+  const double * velocity_divergence = use_velocity_divergence_ ?
+    EnzoDerivedFields::velocity_divergence(block) : nullptr;
+
+  auto cheap_criteria = [&](int i) -> bool {
+    const double ndens = density[i] * rhounit /
+      (mean_molecular_weight(i) * enzo_constants::mass_hydrogen);
+    const double metallicity = (metal) ?
+      metal[i]/density[i]/enzo_constants::metallicity_solar : 0.0;
+    return this->check_number_density_threshold(ndens)
+      &&   this->check_overdensity_threshold(density[i])
+      &&   this->check_temperature(temperature[i])
+      &&   this->check_metallicity(metallicity)
+      &&   (! use_velocity_divergence_ || velocity_divergence[i] < 0);
+  };
+
+  ScratchFrame scratch;
+  int * candidates = scratch.allocate<int>(nx*ny*nz);
+  const int num_candidates = select_candidates_
+    (mx,my,gx,gy,gz,nx,ny,nz,cheap_criteria,candidates);
 
-        int i = INDEX(ix,iy,iz,mx,my);//ix + mx*(iy + my*iz);
-     
-        // compute MMW -- TODO: Make EnzoComputeMeanMolecularWeight class and reference
-        // mu_field here?
-        #ifdef CONFIG_USE_GRACKLE
-          int primordial_chemistry = (enzo::config()->method_grackle_chemistry)->primordial_chemistry;
-          if (primordial_chemistry > 0) {
-            mu = d_el[i] + dHI[i] + dHII[i] + 0.25*(dHeI[i]+dHeII[i]+dHeIII[i]);
-
-            if (primordial_chemistry > 1) {
-              mu += dHM[i] + 0.5*(dH2I[i]+dH2II[i]);
-            }
-            if (primordial_chemistry > 2) {
-              mu += 0.5*(dDI[i] + dDII[i]) + dHDI[i]/3.0;
-            }
-          }
-          mu /= density[i];
-          mu = 1.0/mu; 
-        #endif
-
-        double rho_cgs = density[i] * enzo_units->density();
-        double mean_particle_mass = mu * enzo_constants::mass_hydrogen;
-        double ndens = rho_cgs / mean_particle_mass;
-
-        double cell_mass  = density[i] * cell_volume;
-        double metallicity = (metal) ? metal[i]/density[i]/enzo_constants::metallicity_solar : 0.0;
-
-        //
-        // Apply the criteria for star formation
-        //
-        
-        // check number density threshold
-        if (! this->check_number_density_threshold(ndens) ) continue;
+  #ifdef DEBUG_SF_CRITERIA
+     CkPrintf("MethodStarMakerSTARSS -- %d of %d cells are candidates\n",
+              num_candidates, nx*ny*nz);
+  #endif
 
-        // check overdensity threshold
-        // In cosmology, units are scaled such that mean(density) = 1,
-        // so density IS overdensity in these units  
+  // reproducible random numbers keyed by (seed, block, cycle, cell)
+  const Random random_draw = block->random(name());
 
-        if (! this->check_overdensity_threshold(density[i]) ) continue;
+  // Phase two: check the remaining criteria on candidate cells only
+  for (int ic=0; ic<num_candidates; ic++){
 
-        #ifdef DEBUG_SF_CRITERIA 
-           CkPrintf("MethodFeedbackSTARSS -- overdensity threshold passed! rho=%f\n",dmean);
-        #endif
-        
-        // check velocity divergence < 0
-        if (! this->check_velocity_divergence(velocity_x, velocity_y,
-                                              velocity_z, i,
-                                              idx, idy, idz, dx, dy, dz)) continue;
-      
-        #ifdef DEBUG_SF_CRITERIA
-           CkPrintf("MethodStarMakerSTARSS -- div(v) < 0 in cell %d\n", i);
-        #endif 
-
-        // check that alpha < 1
-        if (use_altAlpha_) {
-          if (! this->check_self_gravitating_alt(total_energy[i], potential[i])) continue;
-        }
+    const int i  = candidates[ic];
+    const int ix = i % mx;
+    const int iy = (i / mx) % my;
+    const int iz = i / (mx*my);
 
-        else {
-          if (! this->check_self_gravitating(mean_particle_mass, density[i], temperature[i],
-                                             velocity_x, velocity_y, velocity_z,
-                                             lunit, vunit, rhounit,
-                                             i, idx, idy, idz, dx, dy, dz)) continue;
-        }
+    // without candidate selection, every active cell is scanned
+    if (! use_candidate_selection_ && ! cheap_criteria(i)) continue;
 
-        #ifdef DEBUG_SF_CRITERIA
-           CkPrintf("MethodStarMakerSTARSS -- alpha < 1 in cell %d\n", i);
-        #endif 
+    const double mu = mean_molecular_weight(i);
 
-        // check that (T<Tcrit) or (dynamical_time < cooling_time)
-        // In order to check cooling time, must have use_temperature_threshold=true;
-        double total_density = density[i] + density_particle_accumulate[i];
+    double mean_particle_mass = mu * enzo_constants::mass_hydrogen;
 
-        // if T > Tcrit
-        if (! this->check_temperature(temperature[i])) continue;
+    double cell_mass  = density[i] * cell_volume;
+    double metallicity = (metal) ? metal[i]/density[i]/enzo_constants::metallicity_solar : 0.0;
 
-        if (cooling_time){ // if we are evolving a "cooling_time" field
-           if (! this->check_cooling_time(cooling_time[i], total_density, tunit, rhounit)) continue;
-        }
-        
-        // check that M > Mjeans
-        if (! check_jeans_mass(temperature[i], mean_particle_mass, density[i], cell_mass,
-                               munit,rhounit )) continue;
+    //
+    // Apply the remaining criteria for star formation
+    //
 
-        #ifdef DEBUG_SF_CRITERIA
-           CkPrintf("MethodStarMakerSTARSS -- M > M_jeans in cell %d\n", i);
-        #endif     
-        
-        // check that H2 self shielded fraction f_shield > 0
-        double f_shield = this->h2_self_shielding_factor(density,metallicity,
-                     rhounit,lunit,i,idx,idy,idz,dx,dy,dz); 
-        if (f_shield < 0) continue;
+    #ifdef DEBUG_SF_CRITERIA 
+       CkPrintf("MethodStarMakerSTARSS -- density thresholds passed! rho=%f\n",density[i]);
+    #endif
+    
+    // check that alpha < 1
+    if (use_altAlpha_) {
+      if (! this->check_self_gravitating_alt(total_energy[i], potential[i])) continue;
+    }
+
+    else {
+      if (! this->check_self_gravitating(mean_particle_mass, density[i], temperature[i],
+                                         velocity_x, velocity_y, velocity_z,
+                                         lunit, vunit, rhounit,
+                                         i, idx, idy, idz, dx, dy, dz)) continue;
+    }
 
-        // check that Z > Z_crit
-        if (! check_metallicity(metallicity)) continue;
+    #ifdef DEBUG_SF_CRITERIA
+       CkPrintf("MethodStarMakerSTARSS -- alpha < 1 in cell %d\n", i);
+    #endif 
 
-//-----------------------------------CREATION ROUTINE-------------------------------
-      
-        #ifdef DEBUG_SF_CRITERIA
-           CkPrintf("MethodStarMakerSTARSS -- SF criteria passed in cell %d\n", i);
-        #endif 
-        
-        //free fall time in code units
-        double tff = sqrt(3*cello::pi/(32*enzo_constants::grav_constant*density[i]*rhounit))/tunit;        
-       /* Determine Mass of new particle
-                WARNING: this removes the mass of the formed particle from the
-                         host cell.  If your simulation has very small (>15 Msun) baryon mass
-                         per cell, it will break your sims! - AIW
-       */
-        double divisor = std::max(1.0, tff * tunit/enzo_constants::Myr_s);
-        double maximum_star_mass = enzo_config->method_star_maker_maximum_star_mass;
-        double minimum_star_mass = enzo_config->method_star_maker_minimum_star_mass;
-         
-        if (maximum_star_mass < 0){
-            maximum_star_mass = this->maximum_star_fraction_ * cell_mass * munit_solar; //Msun
-        }
+    // check that (T<Tcrit) or (dynamical_time < cooling_time)
+    // In order to check cooling time, must have use_temperature_threshold=true;
+    double total_density = density[i] + density_particle_accumulate[i];
 
-        double bulk_SFR = f_shield * this->maximum_star_fraction_ * cell_mass*munit_solar/divisor;
-        
-        // Probability has the last word
-        // FIRE-2 uses p = 1 - exp (-MassShouldForm*dt / M_gas_particle) to convert a whole particle to star particle
-        //  We convert a fixed portion of the baryon mass (or the calculated amount)
-       
-        double p_form = 1.0 - std::exp(-bulk_SFR*dt*(tunit/enzo_constants::Myr_s)/
-                (this->maximum_star_fraction_*cell_mass*munit_solar));
-
-        if (enzo_config->method_star_maker_turn_off_probability) p_form = 1.0;
-
-        double random = double(mt()) / double(mt.max()); 
-
-        /* New star is mass_should_form up to f_shield*maximum_star_fraction_ * baryon mass of the cell,
-           but at least 15 msun */       
-        double new_mass = std::min(f_shield*maximum_star_fraction_*cell_mass, maximum_star_mass/munit_solar);
-
-        #ifdef DEBUG_SF_CRITERIA
-          CkPrintf("MethodStarMakerSTARSS -- new_mass = %f; p_form = %f\n", new_mass*munit_solar, p_form);
-          CkPrintf("MethodStarMakerSTARSS -- cell_mass = %f Msun; divisor = %f\n", cell_mass*munit_solar,divisor);
-          CkPrintf("MethodStarMakerSTARSS -- (ix, iy, iz) = (%d, %d, %d)\n", ix,iy,iz);
-        #endif
-
-        if (
-                 (new_mass * munit_solar < minimum_star_mass) // too small
-                 || (random > p_form) // too unlikely
-                 || (new_mass > cell_mass) // too big compared to cell    
-           ) 
-           {
-           #ifdef DEBUG_SF_CRITERIA
-             CkPrintf("MethodStarMakerSTARSS -- star mass is either too big, too small, or failed the dice roll\n");
-           #endif
-             continue;
-           }
-
-        int n_newStars = 1; // track how many stars to form
-        double mFirmed = 0.0; // track total mass formed thus far
-        double massPerStar = new_mass;
-        double max_massPerStar = 5e3; // TODO: either make this a new parameter or replace 'maximum_star_mass'
-        double mass_split = 1e3; 
-        if (new_mass * munit_solar > max_massPerStar) { //
-          // for large particles, split them into several 1e3-ish Msun particles 
-          // that have slightly different birth times,
-          // spread over three dynamical times. This is to prevent huge particles suddenly dumping a HUGE
-          // amount of ionizing radiation at once.
-          // TODO: Enforce that if dt < 3 dynamical times, new star particles form in the next timestep
-          //       Can do this by creating the particle now so we can still access it at the next timestep,
-          //       but not assigning it any attributes until it's actually supposed to form
-         
-          n_newStars = std::floor(new_mass * munit_solar / mass_split);
-          massPerStar = new_mass / n_newStars;
-        #ifdef DEBUG_SF_CRITERIA
-          CkPrintf("MethodStarMakerSTARSS -- Predicted cluster mass %1.3e Msun > %1.3e Msun;\n" 
-                   "                         splitting into %d particles with mass %1.3e Msun\n",
-                                             new_mass*munit_solar, max_massPerStar, n_newStars, massPerStar*munit_solar);
-        #endif
-        } 
-          for (int n=0; n<n_newStars; n++) {
-            double ctime = enzo_block->time(); 
-            if (n > 0) {
-              double mod = n * 3.0 * tff/tunit/n_newStars;
-              ctime += mod;
-            }
-            count++; // time to form a star!
-      
-          #ifdef DEBUG_SF_CRITERIA
-            CkPrintf("MethodStarMakerSTARSS -- Forming star in gas with number density %f cm^-3\n", ndens);
-          #endif
-
-          // now create a star particle
-          int my_particle = particle.insert_particles(it, 1);
-
-          // For the inserted particle, obtain the batch number (ib)
-          // and the particle index (ipp)
-          particle.index(my_particle, &ib, &ipp);
-
-          int io = ipp; // ipp*ps
-          // pointer to mass array in block
-          pmass = (enzo_float *) particle.attribute_array(it, ia_m, ib);
-
-          pmass[io] = massPerStar;
-          px = (enzo_float *) particle.attribute_array(it, ia_x, ib);
-          py = (enzo_float *) particle.attribute_array(it, ia_y, ib);
-          pz = (enzo_float *) particle.attribute_array(it, ia_z, ib);
-
-          // give it position at center of host cell
-          // TODO: Calculate CM instead?
-          px[io] = lx + (ix - gx + 0.5) * dx;
-          py[io] = ly + (iy - gy + 0.5) * dy;
-          pz[io] = lz + (iz - gz + 0.5) * dz;
-
-          pvx = (enzo_float *) particle.attribute_array(it, ia_vx, ib);
-          pvy = (enzo_float *) particle.attribute_array(it, ia_vy, ib);
-          pvz = (enzo_float *) particle.attribute_array(it, ia_vz, ib);
-
-          // average particle velocity over many cells to prevent runaway
-          double rhosum = 0.0;
-          double vx = 0.0;
-          double vy = 0.0;
-          double vz = 0.0;
-          for (int ix_=std::max(0,ix-3); ix_ <= std::min(ix+3,mx); ix_++) {
-              for (int iy_=std::max(0,iy-3); iy_ <= std::min(iy+3,my); iy_++) {
-                  for (int iz_=std::max(0,iz-3); iz_ <= std::min(iz+3,mz); iz_++) {
-                      int i_ = INDEX(ix_,iy_,iz_,mx,my);
-                      vx += velocity_x[i_]*density[i_];
-                      vy += velocity_y[i_]*density[i_];
-                      vz += velocity_z[i_]*density[i_];
-                      rhosum += density[i_];
-                  }
-              } 
-          }  
-          vx /= rhosum;
-          vy /= rhosum;
-          vz /= rhosum;
-
-          // TODO: Make this an input parameter
-          double max_velocity = 150e5/vunit; 
-          if (std::abs(vx) > max_velocity) vx = vx/std::abs(vx) * max_velocity; 
-          if (std::abs(vy) > max_velocity) vy = vy/std::abs(vy) * max_velocity;
-          if (std::abs(vz) > max_velocity) vz = vz/std::abs(vz) * max_velocity;
-
-          pvx[io] = vx;
-          pvy[io] = vy;
-          pvz[io] = vz;
-
-          // finalize attributes
-          plifetime = (enzo_float *) particle.attribute_array(it, ia_l, ib);
-          pform     = (enzo_float *) particle.attribute_array(it, ia_to, ib);
-          plevel    = (enzo_float *) particle.attribute_array(it, ia_lev, ib);
-
-          pform[io]     =  ctime;   // formation time
-
-          //TODO: Need to have some way of calculating lifetime based on particle mass
-          plifetime[io] =  25.0 * enzo_constants::Myr_s / enzo_units->time() ; // lifetime (not accessed for STARSS FB)
-
-          plevel[io] = enzo_block->level(); // formation level
-
-          if (metal){
-            pmetal     = (enzo_float *) particle.attribute_array(it, ia_metal, ib);
-            pmetal[io] = metal[i] / density[i]; // in ABSOLUTE units
-          }
-
-          // Remove mass from grid and rescale fraction fields
-          // TODO: If particle position is updated to CM instead of being cell-centered, will have to 
-          //       remove mass using CiC, which could complicate things because that CiC cloud could
-          //       leak into the ghost zones. Would have to use same refresh+accumulate machinery
-          //       as MethodFeedbackSTARSS to account for this.
-          double scale = (1.0 - pmass[io] / cell_mass);
-          density[i] *= scale;
-          // rescale color fields too 
-          this->rescale_densities(enzo_block, i, scale);
-
-          #ifdef DEBUG_STORE_INITIAL_PROPERTIES 
-            enzo_float * pmass0 = (enzo_float *) particle.attribute_array(it, ia_m_0 , ib);
-            enzo_float * px0    = (enzo_float *) particle.attribute_array(it, ia_x_0 , ib);
-            enzo_float * py0    = (enzo_float *) particle.attribute_array(it, ia_y_0 , ib);
-            enzo_float * pz0    = (enzo_float *) particle.attribute_array(it, ia_z_0 , ib);
-            enzo_float * pvx0   = (enzo_float *) particle.attribute_array(it, ia_vx_0, ib);
-            enzo_float * pvy0   = (enzo_float *) particle.attribute_array(it, ia_vy_0, ib);
-            enzo_float * pvz0   = (enzo_float *) particle.attribute_array(it, ia_vz_0, ib);
-
-            pmass0[io] = pmass[io];
-            px0 [io] = px[io];
-            py0 [io] = py[io];
-            pz0 [io] = pz[io];
-            pvx0[io] = pvx[io];
-            pvy0[io] = pvy[io];
-            pvz0[io] = pvz[io];
-          #endif
-
-        } // end loop through particles created in this cell
+    if (cooling_time){ // if we are evolving a "cooling_time" field
+       if (! this->check_cooling_time(cooling_time[i], total_density, tunit, rhounit)) continue;
+    }
+    
+    // check that M > Mjeans
+    if (! check_jeans_mass(temperature[i], mean_particle_mass, density[i], cell_mass,
+                           munit,rhounit )) continue;
+
+    #ifdef DEBUG_SF_CRITERIA
+       CkPrintf("MethodStarMakerSTARSS -- M > M_jeans in cell %d\n", i);
+    #endif     
+    
+    // check that H2 self shielded fraction f_shield > 0
+    double f_shield = this->h2_self_shielding_factor(density,metallicity,
+                 rhounit,lunit,i,idx,idy,idz,dx,dy,dz); 
+    if (f_shield < 0) continue;
 
+//-----------------------------------CREATION ROUTINE-------------------------------
+  
+    #ifdef DEBUG_SF_CRITERIA
+       CkPrintf("MethodStarMakerSTARSS -- SF criteria passed in cell %d\n", i);
+    #endif 
+    
+    //free fall time in code units
+    double tff = sqrt(3*cello::pi/(32*enzo_constants::grav_constant*density[i]*rhounit))/tunit;        
+   /* Determine Mass of new particle
+            WARNING: this removes the mass of the formed particle from the
+                     host cell.  If your simulation has very small (>15 Msun) baryon mass
+                     per cell, it will break your sims! - AIW
+   */
+    double divisor = std::max(1.0, tff * tunit/enzo_constants::Myr_s);
+    double maximum_star_mass = enzo_config->method_star_maker_maximum_star_mass;
+    double minimum_star_mass = enzo_config->method_star_maker_minimum_star_mass;
+     
+    if (maximum_star_mass < 0){
+        maximum_star_mass = this->maximum_star_fraction_ * cell_mass * munit_solar; //Msun
+    }
 
+    double bulk_SFR = f_shield * this->maximum_star_fraction_ * cell_mass*munit_solar/divisor;
+    
+    // Probability has the last word
+    // FIRE-2 uses p = 1 - exp (-MassShouldForm*dt / M_gas_particle) to convert a whole particle to star particle
+    //  We convert a fixed portion of the baryon mass (or the calculated amount)
+   
+    double p_form = 1.0 - std::exp(-bulk_SFR*dt*(tunit/enzo_constants::Myr_s)/
+            (this->maximum_star_fraction_*cell_mass*munit_solar));
+
+    if (enzo_config->method_star_maker_turn_off_probability) p_form = 1.0;
+
+    double random = random_draw.uniform(i); 
+
+    /* New star is mass_should_form up to f_shield*maximum_star_fraction_ * baryon mass of the cell,
+       but at least 15 msun */       
+    double new_mass = std::min(f_shield*maximum_star_fraction_*cell_mass, maximum_star_mass/munit_solar);
+
+    #ifdef DEBUG_SF_CRITERIA
+      CkPrintf("MethodStarMakerSTARSS -- new_mass = %f; p_form = %f\n", new_mass*munit_solar, p_form);
+      CkPrintf("MethodStarMakerSTARSS -- cell_mass = %f Msun; divisor = %f\n", cell_mass*munit_solar,divisor);
+      CkPrintf("MethodStarMakerSTARSS -- (ix, iy, iz) = (%d, %d, %d)\n", ix,iy,iz);
+    #endif
+
+    if (
+             (new_mass * munit_solar < minimum_star_mass) // too small
+             || (random > p_form) // too unlikely
+             || (new_mass > cell_mass) // too big compared to cell    
+       ) 
+       {
+       #ifdef DEBUG_SF_CRITERIA
+         CkPrintf("MethodStarMakerSTARSS -- star mass is either too big, too small, or failed the dice roll\n");
+       #endif
+         continue;
+       }
+
+    int n_newStars = 1; // track how many stars to form
+    double mFirmed = 0.0; // track total mass formed thus far
+    double massPerStar = new_mass;
+    double max_massPerStar = 5e3; // TODO: either make this a new parameter or replace 'maximum_star_mass'
+    double mass_split = 1e3; 
+    if (new_mass * munit_solar > max_massPerStar) { //
+      // for large particles, split them into several 1e3-ish Msun particles 
+      // that have slightly different birth times,
+      // spread over three dynamical times. This is to prevent huge particles suddenly dumping a HUGE
+      // amount of ionizing radiation at once.
+      // TODO: Enforce that if dt < 3 dynamical times, new star particles form in the next timestep
+      //       Can do this by creating the particle now so we can still access it at the next timestep,
+      //       but not assigning it any attributes until it's actually supposed to form
+     
+      n_newStars = std::floor(new_mass * munit_solar / mass_split);
+      massPerStar = new_mass / n_newStars;
+    #ifdef DEBUG_SF_CRITERIA
+      CkPrintf("MethodStarMakerSTARSS -- Predicted cluster mass %1.3e Msun > %1.3e Msun;\n" 
+               "                         splitting into %d particles with mass %1.3e Msun\n",
+                                         new_mass*munit_solar, max_massPerStar, n_newStars, massPerStar*munit_solar);
+    #endif
+    } 
+      for (int n=0; n<n_newStars; n++) {
+        double ctime = enzo_block->time(); 
+        if (n > 0) {
+          double mod = n * 3.0 * tff/tunit/n_newStars;
+          ctime += mod;
+        }
+        count++; // time to form a star!
+  
+      #ifdef DEBUG_SF_CRITERIA
+        CkPrintf("MethodStarMakerSTARSS -- Forming star in gas with number density %f cm^-3\n",
+                 density[i]*rhounit/mean_particle_mass);
+      #endif
+
+      // now create a star particle
+      int my_particle = particle.insert_particles(it, 1);
+
+      // For the inserted particle, obtain the batch number (ib)
+      // and the particle index (ipp)
+      particle.index(my_particle, &ib, &ipp);
+
+      int io = ipp; // ipp*ps
+      // pointer to mass array in block
+      pmass = (enzo_float *) particle.attribute_array(it, ia_m, ib);
+
+      pmass[io] = massPerStar;
+      px = (enzo_float *) particle.attribute_array(it, ia_x, ib);
+      py = (enzo_float *) particle.attribute_array(it, ia_y, ib);
+      pz = (enzo_float *) particle.attribute_array(it, ia_z, ib);
+
+      // give it position at center of host cell
+      // TODO: Calculate CM instead?
+      px[io] = lx + (ix - gx + 0.5) * dx;
+      py[io] = ly + (iy - gy + 0.5) * dy;
+      pz[io] = lz + (iz - gz + 0.5) * dz;
+
+      pvx = (enzo_float *) particle.attribute_array(it, ia_vx, ib);
+      pvy = (enzo_float *) particle.attribute_array(it, ia_vy, ib);
+      pvz = (enzo_float *) particle.attribute_array(it, ia_vz, ib);
+
+      // average particle velocity over many cells to prevent runaway
+      double rhosum = 0.0;
+      double vx = 0.0;
+      double vy = 0.0;
+      double vz = 0.0;
+      for (int ix_=std::max(0,ix-3); ix_ <= std::min(ix+3,mx); ix_++) {
+          for (int iy_=std::max(0,iy-3); iy_ <= std::min(iy+3,my); iy_++) {
+              for (int iz_=std::max(0,iz-3); iz_ <= std::min(iz+3,mz); iz_++) {
+                  int i_ = INDEX(ix_,iy_,iz_,mx,my);
+                  vx += velocity_x[i_]*density[i_];
+                  vy += velocity_y[i_]*density[i_];
+                  vz += velocity_z[i_]*density[i_];
+                  rhosum += density[i_];
+              }
+          } 
+      }  
+      vx /= rhosum;
+      vy /= rhosum;
+      vz /= rhosum;
+
+      // TODO: Make this an input parameter
+      double max_velocity = 150e5/vunit; 
+      if (std::abs(vx) > max_velocity) vx = vx/std::abs(vx) * max_velocity; 
+      if (std::abs(vy) > max_velocity) vy = vy/std::abs(vy) * max_velocity;
+      if (std::abs(vz) > max_velocity) vz = vz/std::abs(vz) * max_velocity;
+
+      pvx[io] = vx;
+      pvy[io] = vy;
+      pvz[io] = vz;
+
+      // finalize attributes
+      plifetime = (enzo_float *) particle.attribute_array(it, ia_l, ib);
+      pform     = (enzo_float *) particle.attribute_array(it, ia_to, ib);
+      plevel    = (enzo_float *) particle.attribute_array(it, ia_lev, ib);
+
+      pform[io]     =  ctime;   // formation time
+
+      //TODO: Need to have some way of calculating lifetime based on particle mass
+      plifetime[io] =  25.0 * enzo_constants::Myr_s / enzo_units->time() ; // lifetime (not accessed for STARSS FB)
+
+      plevel[io] = enzo_block->level(); // formation level
+
+      if (metal){
+        pmetal     = (enzo_float *) particle.attribute_array(it, ia_metal, ib);
+        pmetal[io] = metal[i] / density[i]; // in ABSOLUTE units
       }
-    }
-  } // end loop iz
+
+      // Remove mass from grid and rescale fraction fields
+      // TODO: If particle position is updated to CM instead of being cell-centered, will have to 
+      //       remove mass using CiC, which could complicate things because that CiC cloud could
+      //       leak into the ghost zones. Would have to use same refresh+accumulate machinery
+      //       as MethodFeedbackSTARSS to account for this.
+      double scale = (1.0 - pmass[io] / cell_mass);
+      density[i] *= scale;
+      // rescale color fields too 
+      this->rescale_densities(enzo_block, i, scale);
+
+      #ifdef DEBUG_STORE_INITIAL_PROPERTIES 
+        enzo_float * pmass0 = (enzo_float *) particle.attribute_array(it, ia_m_0 , ib);
+        enzo_float * px0    = (enzo_float *) particle.attribute_array(it, ia_x_0 , ib);
+        enzo_float * py0    = (enzo_float *) particle.attribute_array(it, ia_y_0 , ib);
+        enzo_float * pz0    = (enzo_float *) particle.attribute_array(it, ia_z_0 , ib);
+        enzo_float * pvx0   = (enzo_float *) particle.attribute_array(it, ia_vx_0, ib);
+        enzo_float * pvy0   = (enzo_float *) particle.attribute_array(it, ia_vy_0, ib);
+        enzo_float * pvz0   = (enzo_float *) particle.attribute_array(it, ia_vz_0, ib);
+
+        pmass0[io] = pmass[io];
+        px0 [io] = px[io];
+        py0 [io] = py[io];
+        pz0 [io] = pz[io];
+        pvx0[io] = pvx[io];
+        pvy0[io] = pvy[io];
+        pvz0[io] = pvz[io];
+      #endif
+
+    } // end loop through particles created in this cell
+
+  } // end loop over candidate cells
 
   #ifdef DEBUG_SF_CRITERIA
     if (count > 0){
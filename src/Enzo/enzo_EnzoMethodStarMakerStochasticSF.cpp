@@ -10,7 +10,6 @@
 
 #include "cello.hpp"
 #include "enzo.hpp"
-#include <time.h>
 
 
 // #define DEBUG_SF
@@ -22,8 +21,6 @@ EnzoMethodStarMakerStochasticSF::EnzoMethodStarMakerStochasticSF
 ()
   : EnzoMethodStarMaker()
 {
-  // To Do: Make the seed an input parameter
-  srand(time(NULL)); // need randum number generator for later
   return;
 }
 
@@ -126,12 +123,14 @@ void EnzoMethodStarMakerStochasticSF::compute ( Block *block) throw()
   enzo_float * density     = (enzo_float *) field.values("density");
   enzo_float * temperature = (enzo_float *) field.values("temperature");
 
+  // velocities are only read
+  const Field & field_const = field;
   enzo_float * velocity_x = (rank >= 1) ?
-    (enzo_float *)field.values("velocity_x") : NULL;
+    (enzo_float *)field_const.values("velocity_x") : NULL;
   enzo_float * velocity_y = (rank >= 2) ?
-    (enzo_float *)field.values("velocity_y") : NULL;
+    (enzo_float *)field_const.values("velocity_y") : NULL;
   enzo_float * velocity_z = (rank >= 3) ?
-    (enzo_float *)field.values("velocity_z") : NULL;
+    (enzo_float *)field_const.values("velocity_z") : NULL;
 
   enzo_float * metal = field.is_field("metal_density") ?
     (enzo_float *) field.values("metal_density") : NULL;
@@ -150,167 +149,194 @@ void EnzoMethodStarMakerStochasticSF::compute ( Block *block) throw()
 
   compute_temperature.compute(enzo_block);
 
-  // iterate over all cells (not including ghost zones)
+  // Phase one: apply the cheap, cell-local criteria to every active
+  // cell and keep only the candidates that pass them all.  The mass
+  // check is repeated below with the H2 self-shielded mass, which is
+  // never larger
+
+  const double rhounit = enzo_units->density();
+  const double cell_mass_solar =
+    dx*dy*dz * enzo_units->mass() / enzo_constants::mass_solar;
+  const double mean_particle_mass =
+    nominal_mol_weight * enzo_constants::mass_hydrogen;
+
+  // velocity divergence, shared with other methods through the
+  // Block's DerivedFieldCache
+  const double * velocity_divergence = use_velocity_divergence_ ?
+    EnzoDerivedFields::velocity_divergence(block) : nullptr;
+
+  auto cheap_criteria = [&](int i) -> bool {
+    const double ndens = density[i] * rhounit / mean_particle_mass;
+    return this->check_number_density_threshold(ndens)
+      &&   this->check_mass(density[i] * cell_mass_solar)
+      &&   (! use_velocity_divergence_ || velocity_divergence[i] < 0);
+  };
+
+  ScratchFrame scratch;
+  int * candidates = scratch.allocate<int>(nx*ny*nz);
+  const int num_candidates = select_candidates_
+    (mx,my,gx,gy,gz,nx,ny,nz,cheap_criteria,candidates);
+
+  // reproducible random numbers keyed by (seed, block, cycle, cell)
+  const Random random = block->random(name());
+
+  // Phase two: check the remaining criteria on candidate cells only
   //
   //   To Do: Allow for multi-zone star formation by adding mass in
   //          surrounding cells if needed to accumulte enough mass
   //          to hit target star particle mass ()
-  for (int iz=gz; iz<nz+gz; iz++){
-    for (int iy=gy; iy<ny+gy; iy++){
-      for (int ix=gx; ix<nx+gx; ix++){
-
-        int i = ix + mx*(iy + my*iz);
-
-        // need to compute this better for Grackle fields (on to-do list)
-        double rho_cgs = density[i] * enzo_units->density();
-        double mean_particle_mass = nominal_mol_weight * enzo_constants::mass_hydrogen;
-        double ndens = rho_cgs / mean_particle_mass;
-
-        double mass  = density[i] *dx*dy*dz * enzo_units->mass() / enzo_constants::mass_solar;
-        double metallicity = (metal) ? metal[i]/density[i]/Zsolar : 0.0;
-
-        //
-        // Apply the criteria for star formation
-        //
-        if (! this->check_number_density_threshold(ndens)) continue;
-        if (! this->check_self_gravitating( mean_particle_mass, rho_cgs, temperature[i],
-                                            velocity_x, velocity_y, velocity_z,
-                                            enzo_units->length(), enzo_units->velocity(),
-                                            enzo_units->density(),
-                                            i, 1, mx, mx*my, dx, dy, dz)) continue;
-
-        // AJE: TO DO ---
-        //      If Grackle is used, check for this and use the H2
-        //      fraction from there instead if h2 is used. Maybe could
-        //      do this in the self shielding factor function
-
-        // Only allow star formation out of the H2 shielding component (if used)
-        const double f_h2 = this->h2_self_shielding_factor(density,
-                                                           metallicity,
-                                                           enzo_units->density(),
-                                                           enzo_units->length(),
-                                                           i, 1, mx, mx*my,
-                                                           dx, dy, dz);
-        mass *= f_h2; // apply correction (f_h2 = 1 if not used)
-
-        if (! this->check_velocity_divergence(velocity_x, velocity_y,
-                                              velocity_z, i,
-                                              1, mx, mx*my, dx, dy, dz)) continue;
-        // Check whether mass in [min_mass, max_range] range and if specified, Jeans unstable
-        if (! this->check_mass(mass)) continue;
-
-        double tdyn = sqrt(3.0 * cello::pi / 32.0 / enzo_constants::grav_constant /
-                      (density[i] * enzo_units->density()));
-
-        //
-        // compute fraction that can / will be converted to stars this step
-        // (just set to efficiency if dynamical time is ignored)
-        //
-        double star_fraction =  this->use_dynamical_time_ ?
-                                std::min(this->efficiency_ * enzo_block->dt * enzo_units->time() / tdyn, 1.0) :
-                                         this->efficiency_ ;
-
-        // if this is less than the mass of a single particle,
-        // use a random number draw to generate the particle
-        if ( star_fraction * mass < this->star_particle_min_mass_){
-          // get a random number
-          double rnum = (double(rand())) / (double(RAND_MAX));
-          double probability = this->efficiency_ * mass / this->star_particle_min_mass_;
-          if (rnum > probability){
-              continue; // do not form stars
-          } else{
-            star_fraction = this->star_particle_min_mass_ / mass;
-          }
-        } else {
-          // else allow the total mass of stars to form to be up to the
-          // maximum particle mass OR the maximum gas->stars conversion fraction.
-          // AJE: Note, this forces there to be at most one particle formed per
-          //      cell per timestep. In principle, this could be bad if
-          //      the computed gas->stars mass (above) is >> than maximum particle
-          //      mass b/c it would artificially extend the lifetime of the SF
-          //      region and presumably increase the amount of SF and burstiness
-          //      of the SF and feedback cycle. Check this!!!!
-
-          if (star_fraction * mass > this->star_particle_max_mass_){
+  for (int ic=0; ic<num_candidates; ic++){
+
+    const int i  = candidates[ic];
+    const int ix = i % mx;
+    const int iy = (i / mx) % my;
+    const int iz = i / (mx*my);
+
+    // without candidate selection, every active cell is scanned
+    if (! use_candidate_selection_ && ! cheap_criteria(i)) continue;
+
+    // need to compute this better for Grackle fields (on to-do list)
+    double rho_cgs = density[i] * rhounit;
+
+    double mass  = density[i] * cell_mass_solar;
+    double metallicity = (metal) ? metal[i]/density[i]/Zsolar : 0.0;
+
+    //
+    // Apply the remaining criteria for star formation
+    //
+    if (! this->check_self_gravitating( mean_particle_mass, rho_cgs, temperature[i],
+                                        velocity_x, velocity_y, velocity_z,
+                                        enzo_units->length(), enzo_units->velocity(),
+                                        enzo_units->density(),
+                                        i, 1, mx, mx*my, dx, dy, dz)) continue;
+
+    // AJE: TO DO ---
+    //      If Grackle is used, check for this and use the H2
+    //      fraction from there instead if h2 is used. Maybe could
+    //      do this in the self shielding factor function
+
+    // Only allow star formation out of the H2 shielding component (if used)
+    const double f_h2 = this->h2_self_shielding_factor(density,
+                                                       metallicity,
+                                                       enzo_units->density(),
+                                                       enzo_units->length(),
+                                                       i, 1, mx, mx*my,
+                                                       dx, dy, dz);
+    mass *= f_h2; // apply correction (f_h2 = 1 if not used)
+
+    // Check whether mass in [min_mass, max_range] range and if specified, Jeans unstable
+    if (! this->check_mass(mass)) continue;
+
+    double tdyn = sqrt(3.0 * cello::pi / 32.0 / enzo_constants::grav_constant /
+                  (density[i] * enzo_units->density()));
+
+    //
+    // compute fraction that can / will be converted to stars this step
+    // (just set to efficiency if dynamical time is ignored)
+    //
+    double star_fraction =  this->use_dynamical_time_ ?
+                            std::min(this->efficiency_ * enzo_block->dt * enzo_units->time() / tdyn, 1.0) :
+                                     this->efficiency_ ;
+
+    // if this is less than the mass of a single particle,
+    // use a random number draw to generate the particle
+    if ( star_fraction * mass < this->star_particle_min_mass_){
+      // get a random number
+      double rnum = random.uniform(i);
+      double probability = this->efficiency_ * mass / this->star_particle_min_mass_;
+      if (rnum > probability){
+          continue; // do not form stars
+      } else{
+        star_fraction = this->star_particle_min_mass_ / mass;
+      }
+    } else {
+      // else allow the total mass of stars to form to be up to the
+      // maximum particle mass OR the maximum gas->stars conversion fraction.
+      // AJE: Note, this forces there to be at most one particle formed per
+      //      cell per timestep. In principle, this could be bad if
+      //      the computed gas->stars mass (above) is >> than maximum particle
+      //      mass b/c it would artificially extend the lifetime of the SF
+      //      region and presumably increase the amount of SF and burstiness
+      //      of the SF and feedback cycle. Check this!!!!
+
+      if (star_fraction * mass > this->star_particle_max_mass_){
 #ifdef DEBUG_SF
-            CkPrintf( "DEBUG_SF: StochasticSF - SF mass = %g ; max particle mass = %g\n",
-                                         star_fraction*mass, this->star_particle_max_mass_);
+        CkPrintf( "DEBUG_SF: StochasticSF - SF mass = %g ; max particle mass = %g\n",
+                                     star_fraction*mass, this->star_particle_max_mass_);
 #endif
-            star_fraction = this->star_particle_max_mass_ / mass;
-          }
-
-          star_fraction = std::min(star_fraction, this->maximum_star_fraction_);
-        }
-
-        count++; //
-
-        // now create a star particle
-        //    insert_particles( particle_type, number_of_particles )
-        int my_particle = particle.insert_particles(it, 1);
-
-        // For the inserted particle, obtain the batch number (ib)
-        //  and the particle index (ipp)
-        particle.index(my_particle, &ib, &ipp);
-
-        int io = ipp; // ipp*ps
-        // pointer to mass array in block
-        pmass = (enzo_float *) particle.attribute_array(it, ia_m, ib);
-
-        id = (int64_t * ) particle.attribute_array(it, ia_id, ib);
-
-        id[io] = CkMyPe() + (ParticleData::id_counter[cello::index_static()]++) * CkNumPes();
-
-        pmass[io] = star_fraction * (density[i] * dx * dy * dz);
-        px = (enzo_float *) particle.attribute_array(it, ia_x, ib);
-        py = (enzo_float *) particle.attribute_array(it, ia_y, ib);
-        pz = (enzo_float *) particle.attribute_array(it, ia_z, ib);
-
-        // need to double check that these are correctly handling ghost zones
-        //   I believe lx is lower coordinates of active region, but
-        //   ix is integer index of whole grid (active + ghost)
-        //
-        px[io] = lx + (ix - gx + 0.5) * dx;
-        py[io] = ly + (iy - gy + 0.5) * dy;
-        pz[io] = lz + (iz - gz + 0.5) * dz;
-
-        pvx = (enzo_float *) particle.attribute_array(it, ia_vx, ib);
-        pvy = (enzo_float *) particle.attribute_array(it, ia_vy, ib);
-        pvz = (enzo_float *) particle.attribute_array(it, ia_vz, ib);
-
-        pvx[io] = velocity_x[i];
-        if (velocity_y) pvy[io] = velocity_y[i];
-        if (velocity_z) pvz[io] = velocity_z[i];
-
-        // finalize attributes
-        plifetime = (enzo_float *) particle.attribute_array(it, ia_l, ib);
-        pform     = (enzo_float *) particle.attribute_array(it, ia_to, ib);
-
-        pform[io]     =  enzo_block->time();   // formation time
-        plifetime[io] =  tdyn;  // 10.0 * enzo_constants::Myr_s / enzo_units->time() ; // lifetime
-
-        if (metal){
-          pmetal     = (enzo_float *) particle.attribute_array(it, ia_metal, ib);
-          pmetal[io] = metal[i] / density[i];
-        }
-
-        // Remove mass from grid and rescale fraction fields
-        density[i] = (1.0 - star_fraction) * density[i];
-        double scale = (1.0 - star_fraction) / 1.0;
-
-        if (density[i] < 0){
-          CkPrintf("StochasticSF: density index star_fraction mass: %g %i %g %g\n",
-                   density[i],i,star_fraction,mass);
-          ERROR("EnzoMethodStarMakerStochasticSF::compute()",
-                "Negative densities in star formation");
-        }
-
-        // rescale tracer fields to maintain constant mass fraction
-        // with the corresponding new density...
-        //    scale = new_density / old_density
-        rescale_densities(enzo_block, i, scale);
+        star_fraction = this->star_particle_max_mass_ / mass;
       }
+
+      star_fraction = std::min(star_fraction, this->maximum_star_fraction_);
+    }
+
+    count++; //
+
+    // now create a star particle
+    //    insert_particles( particle_type, number_of_particles )
+    int my_particle = particle.insert_particles(it, 1);
+
+    // For the inserted particle, obtain the batch number (ib)
+    //  and the particle index (ipp)
+    particle.index(my_particle, &ib, &ipp);
+
+    int io = ipp; // ipp*ps
+    // pointer to mass array in block
+    pmass = (enzo_float *) particle.attribute_array(it, ia_m, ib);
+
+    id = (int64_t * ) particle.attribute_array(it, ia_id, ib);
+
+    id[io] = CkMyPe() + (ParticleData::id_counter[cello::index_static()]++) * CkNumPes();
+
+    pmass[io] = star_fraction * (density[i] * dx * dy * dz);
+    px = (enzo_float *) particle.attribute_array(it, ia_x, ib);
+    py = (enzo_float *) particle.attribute_array(it, ia_y, ib);
+    pz = (enzo_float *) particle.attribute_array(it, ia_z, ib);
+
+    // need to double check that these are correctly handling ghost zones
+    //   I believe lx is lower coordinates of active region, but
+    //   ix is integer index of whole grid (active + ghost)
+    //
+    px[io] = lx + (ix - gx + 0.5) * dx;
+    py[io] = ly + (iy - gy + 0.5) * dy;
+    pz[io] = lz + (iz - gz + 0.5) * dz;
+
+    pvx = (enzo_float *) particle.attribute_array(it, ia_vx, ib);
+    pvy = (enzo_float *) particle.attribute_array(it, ia_vy, ib);
+    pvz = (enzo_float *) particle.attribute_array(it, ia_vz, ib);
+
+    pvx[io] = velocity_x[i];
+    if (velocity_y) pvy[io] = velocity_y[i];
+    if (velocity_z) pvz[io] = velocity_z[i];
+
+    // finalize attributes
+    plifetime = (enzo_float *) particle.attribute_array(it, ia_l, ib);
+    pform     = (enzo_float *) particle.attribute_array(it, ia_to, ib);
+
+    pform[io]     =  enzo_block->time();   // formation time
+    plifetime[io] =  tdyn;  // 10.0 * enzo_constants::Myr_s / enzo_units->time() ; // lifetime
+
+    if (metal){
+      pmetal     = (enzo_float *) particle.attribute_array(it, ia_metal, ib);
+      pmetal[io] = metal[i] / density[i];
     }
-  } // end loop iz
+
+    // Remove mass from grid and rescale fraction fields
+    density[i] = (1.0 - star_fraction) * density[i];
+    double scale = (1.0 - star_fraction) / 1.0;
+
+    if (density[i] < 0){
+      CkPrintf("StochasticSF: density index star_fraction mass: %g %i %g %g\n",
+               density[i],i,star_fraction,mass);
+      ERROR("EnzoMethodStarMakerStochasticSF::compute()",
+            "Negative densities in star formation");
+    }
+
+    // rescale tracer fields to maintain constant mass fraction
+    // with the corresponding new density...
+    //    scale = new_density / old_density
+    rescale_densities(enzo_block, i, scale);
+  } // end loop over candidate cells
 
   if (count > 0){
       CkPrintf("StochasticSF: Number of particles formed = %i \n", count);
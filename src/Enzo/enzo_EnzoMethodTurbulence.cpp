@@ -27,13 +27,22 @@ EnzoMethodTurbulence::EnzoMethodTurbulence
  double density_initial,
  double temperature_initial,
  double mach_number,
- bool comoving_coordinates)
+ bool comoving_coordinates,
+ bool overlap_reduction,
+ const EnzoTurbulenceDrivingOU & driving_ou)
   : Method(),
     density_initial_(density_initial),
     temperature_initial_(temperature_initial),
     edot_(edot),
     mach_number_(mach_number),
-    comoving_coordinates_(comoving_coordinates)
+    comoving_coordinates_(comoving_coordinates),
+    overlap_reduction_(overlap_reduction),
+    driving_ou_(driving_ou),
+    i_sums_(-1),
+    i_contributed_(-1),
+    i_received_(-1),
+    i_waiting_(-1),
+    cycle_first_(-1)
 {
   TRACE_TURBULENCE;
 
@@ -54,6 +63,11 @@ EnzoMethodTurbulence::EnzoMethodTurbulence
     cello::define_field("velocity_z");
     cello::define_field("acceleration_z");
   }
+  if (driving_ou_.num_modes() > 0) {
+    if (rank >= 1) cello::define_field("driving_x");
+    if (rank >= 2) cello::define_field("driving_y");
+    if (rank >= 3) cello::define_field("driving_z");
+  }
 
   // Initialize default Refresh object
 
@@ -62,6 +76,16 @@ EnzoMethodTurbulence::EnzoMethodTurbulence
   Refresh * refresh = cello::refresh(ir_post_);
   refresh->add_all_fields();
 
+  if (overlap_reduction_) {
+    ScalarDescr * scalar_descr_double = cello::scalar_descr_double();
+    i_sums_ = scalar_descr_double->new_value
+      (name() + ":sums", max_turbulence_array);
+    ScalarDescr * scalar_descr_int = cello::scalar_descr_int();
+    i_contributed_ = scalar_descr_int->new_value(name() + ":contributed");
+    i_received_    = scalar_descr_int->new_value(name() + ":received");
+    i_waiting_     = scalar_descr_int->new_value(name() + ":waiting");
+  }
+
   // TURBULENCE parameters initialized in EnzoBlock::initialize()
 }
 
@@ -81,6 +105,13 @@ void EnzoMethodTurbulence::pup (PUP::er &p)
   p | temperature_initial_;
   p | mach_number_;
   p | comoving_coordinates_;
+  p | overlap_reduction_;
+  p | driving_ou_;
+  p | i_sums_;
+  p | i_contributed_;
+  p | i_received_;
+  p | i_waiting_;
+  // cycle_first_ not pup'd: reset on restart
 
 }
 
@@ -92,92 +123,256 @@ void EnzoMethodTurbulence::compute ( Block * block) throw()
 
   EnzoBlock * enzo_block = enzo::block(block);
 
-  Field field = block->data()->field();
-
-  const EnzoConfig * enzo_config = enzo::config();
+  if (driving_ou_.num_modes() > 0) {
+    // update the stochastic driving field
+    driving_ou_.advance(block->time());
+    if (block->is_leaf()) {
+      Field field = block->data()->field();
+      enzo_float * a3[3] = {
+        (enzo_float*) field.values ("driving_x"),
+        (enzo_float*) field.values ("driving_y"),
+        (enzo_float*) field.values ("driving_z") };
+      driving_ou_.evaluate(block,a3);
+    }
+  }
 
   EnzoComputeTemperature compute_temperature(enzo::fluid_props(),
                                              comoving_coordinates_);
 
   compute_temperature.compute(enzo_block);
 
-  enzo_float *  density = (enzo_float *) field.values("density");
-  enzo_float *  velocity[3] = {
-    (enzo_float *) field.values("velocity_x"),
-    (enzo_float *) field.values("velocity_y"),
-    (enzo_float *) field.values("velocity_z") };
-  enzo_float * driving[3] = {
-    (enzo_float *) field.values("driving_x"),
-    (enzo_float *) field.values("driving_y"),
-    (enzo_float *) field.values("driving_z") };
-  enzo_float * temperature = (enzo_float *) field.values("temperature");
+  if (! overlap_reduction_) {
+
+    // accumulate sums, then apply forcing in compute_resume() after
+    // the global reduction completes
+
+    double g[max_turbulence_array];
+    if (block->is_leaf()) update_(block,0.0,nullptr,g);
+    contribute_(block,g);
+
+  } else {
+
+    if (cycle_first_ < 0) cycle_first_ = block->cycle();
+
+    Scalar<int> scalar = block->data()->scalar_int();
+    const int contributed = *scalar.value(i_contributed_);
+    const int received    = *scalar.value(i_received_);
+
+    // wait for the previous cycle's reduction unless it was lost in a
+    // restart
+
+    if (received < contributed && block->cycle() != cycle_first_) {
+      *scalar.value(i_waiting_) = 1;
+    } else {
+      compute_overlap_(block);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodTurbulence::compute_overlap_ (Block * block) throw()
+{
+  TRACE_TURBULENCE;
+
+  Scalar<int> scalar_int = block->data()->scalar_int();
+  int * contributed = scalar_int.value(i_contributed_);
+  int * received    = scalar_int.value(i_received_);
+
+  const double * g_prev = block->data()->scalar_double().value(i_sums_);
+
+  // no forcing on the first cycle, or after a restart lost the
+  // pending reduction
+
+  const bool have_sums = (0 < *received && *received == *contributed);
+
+  double g[max_turbulence_array];
+
+  if (block->is_leaf()) {
+    const double norm = have_sums ? norm_(block,g_prev) : 0.0;
+    update_(block,norm,g_prev,g);
+  }
+
+  *contributed = block->cycle() + 1;
+  *scalar_int.value(i_waiting_) = 0;
+
+  contribute_(block,g);
+
+  block->compute_done();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodTurbulence::contribute_ (Block * block, double * g) const throw()
+{
+  if (! block->is_leaf()) {
+    for (int i=0; i<max_turbulence_array; i++) g[i] = 0.0;
+    g[index_turbulence_mind] = std::numeric_limits<double>::max();
+    g[index_turbulence_maxd] = - std::numeric_limits<double>::max();
+  }
+
+  EnzoBlock * enzo_block = enzo::block(block);
+
+  CkCallback callback (CkIndex_EnzoBlock::r_method_turbulence_end(NULL),
+		       enzo_block->proxy_array());
+  enzo_block->contribute(max_turbulence_array*sizeof(double),g,
+                         r_method_turbulence_type,callback);
+}
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  /// Compensated (Kahan-Babuska-Neumaier) summation, so that the sums
+  /// of many terms of varying magnitude do not lose precision.  Note
+  /// that compilers may remove the compensation under value-unsafe
+  /// floating-point optimizations such as -ffast-math
+  struct CompensatedSum {
+    CompensatedSum() : sum(0.0), comp(0.0) {}
+    void add (double x)
+    {
+      const double t = sum + x;
+      comp += (std::abs(sum) >= std::abs(x)) ? (sum - t) + x : (x - t) + sum;
+      sum = t;
+    }
+    double value() const { return sum + comp; }
+    double sum, comp;
+  };
+
+}
+
+//----------------------------------------------------------------------
 
+void EnzoMethodTurbulence::update_
+(Block * block, double norm, const double * g_prev, double * g) const throw()
+{
+  TRACE_TURBULENCE;
+
+  Field field = block->data()->field();
+
+  int mx,my,mz;
   int nx,ny,nz;
-  field.size(&nx,&ny,&nz);
   int gx,gy,gz;
+  field.dimensions (0,&mx,&my,&mz);
+  field.size         (&nx,&ny,&nz);
   field.ghost_depth(0,&gx,&gy,&gz);
-  int ndx = nx + 2*gx;
-  int ndy = ny + 2*gy;
 
-  const int n = max_turbulence_array;
-  double g[n];
+  const int n = nx*ny*nz;
+  const int rank = cello::rank();
+
+  enzo_float * density     = (enzo_float*) field.values ("density");
+  enzo_float * temperature = (enzo_float*) field.values ("temperature");
+  enzo_float * te = (enzo_float*) field.values ("total_energy");
+  enzo_float * v3[3] = {
+    (enzo_float*) field.values ("velocity_x"),
+    (enzo_float*) field.values ("velocity_y"),
+    (enzo_float*) field.values ("velocity_z") };
+  enzo_float * a3[3] = {
+    (enzo_float*) field.values ("driving_x"),
+    (enzo_float*) field.values ("driving_y"),
+    (enzo_float*) field.values ("driving_z") };
+
+  // bulk momentum
+  enzo_float bm[3] = {0.0, 0.0, 0.0};
+  if (norm != 0.0) {
+    bm[0] = enzo_float(g_prev[index_turbulence_dax]/n);
+    bm[1] = enzo_float(g_prev[index_turbulence_day]/n);
+    bm[2] = enzo_float(g_prev[index_turbulence_daz]/n);
+  }
 
-  for (int i=0; i<max_turbulence_array-2; i++) g[i] = 0.0;
+  //  for (int dim = 0; dim <  MetaData->TopGridRank; dim++)
+  //	bulkMomentum[dim] = GlobVal[7+dim]/numberOfGridZones;
 
-  g[index_turbulence_mind] = std::numeric_limits<double>::max();
-  g[index_turbulence_maxd] = - std::numeric_limits<double>::max();
+  const double kelvin_per_energy_u = enzo::units()->kelvin_per_energy_units();
 
-  int mx,my,mz;
-  field.dimensions (0,&mx,&my,&mz);
-  const int rank = ((mz == 1) ? ((my == 1) ? 1 : 2) : 3);
+  // row sums are accumulated in vectorizable loops, then added to
+  // compensated block sums
 
-  EnzoUnits* enzo_units = enzo::units();
-  const enzo_float kelvin_per_energy_u = enzo_units->kelvin_per_energy_units();
+  CompensatedSum sum[max_turbulence_array - 2];
+  double mind = std::numeric_limits<double>::max();
+  double maxd = - std::numeric_limits<double>::max();
 
-  if (block->is_leaf()) {
+  for (int iz=gz; iz<gz+nz; iz++) {
+    for (int iy=gy; iy<gy+ny; iy++) {
+
+      const int i0 = gx + mx*(iy + my*iz);
+
+      if (norm != 0.0) {
+        enzo_float * e = te + i0;
+        for (int id=0; id<rank; id++) {
+          enzo_float * v = v3[id] + i0;
+          const enzo_float * a = a3[id] + i0;
+          const enzo_float b = bm[id];
+#pragma omp simd
+          for (int ix=0; ix<nx; ix++) {
+            //  e[ix] += v[ix]*a[ix]*norm + 0.5*a[ix]*norm*a[ix]*norm;
+            //  v[ix] += a[ix]*norm;
+            e[ix] += (v[ix]*(a[ix]-b))*norm;
+            v[ix] += (a[ix]-b)*norm;
+          }
+        }
+      }
 
-    for (int iz=0; iz<nz; iz++) {
-      for (int iy=0; iy<ny; iy++) {
-	for (int ix=0; ix<nx; ix++) {
-
-	  int i = (ix+gx) + ndx*((iy+gy) + ndy*(iz+gz));
-
-	  enzo_float d  = density[i];
-	  for (int id=0; id<rank; id++) {
-	    enzo_float v  = velocity[id][i];
-	    enzo_float v2 = v*v;
-	    enzo_float a  = driving[id][i];
-	    enzo_float ti = kelvin_per_energy_u  / temperature[i];
-
-	    g[index_turbulence_vad] +=   v*a*d;
-	    g[index_turbulence_aad] +=   a*a*d;
-	    g[index_turbulence_vvdot] += v2*d*ti;
-	    g[index_turbulence_vvot] +=  v2*ti;
-	    g[index_turbulence_vvd] +=   v2*d;
-	    g[index_turbulence_vv] +=    v2;
-	  }
-	  g[index_turbulence_dd]  +=   d*d;
-	  g[index_turbulence_d]   +=   d;
-	  g[index_turbulence_dax] +=  d*driving[0][i];
-	  g[index_turbulence_day] +=  (rank >= 2) ? d*driving[1][i] : 0.0;
-	  g[index_turbulence_daz] +=  (rank >= 3) ? d*driving[2][i] : 0.0;
-	  g[index_turbulence_dvx] +=  d*velocity[0][i];
-	  g[index_turbulence_dvy] +=  (rank >= 2) ? d*velocity[1][i] : 0.0;
-	  g[index_turbulence_dvz] +=  (rank >= 3) ? d*velocity[2][i] : 0.0;
-	  g[index_turbulence_dlnd] += d*log(d);
-	  g[index_turbulence_zones] += 1;
-	  g[index_turbulence_mind] =
-	    std::min(g[index_turbulence_mind], (double) d);
-	  g[index_turbulence_maxd] =
-	    std::max(g[index_turbulence_maxd], (double) d);
-	}
+      if (g == nullptr) continue;
+
+      const enzo_float * d = density + i0;
+      const enzo_float * t = temperature + i0;
+
+      double vad=0.0, aad=0.0, vvdot=0.0, vvot=0.0, vvd=0.0, vv=0.0;
+      for (int id=0; id<rank; id++) {
+        const enzo_float * v = v3[id] + i0;
+        const enzo_float * a = a3[id] + i0;
+        double da=0.0, dv=0.0;
+#pragma omp simd reduction(+:vad,aad,vvdot,vvot,vvd,vv,da,dv)
+        for (int ix=0; ix<nx; ix++) {
+          const double di = d[ix];
+          const double vi = v[ix];
+          const double ai = a[ix];
+          const double v2 = vi*vi;
+          const double ti = kelvin_per_energy_u / t[ix];
+          vad   += vi*ai*di;
+          aad   += ai*ai*di;
+          vvdot += v2*di*ti;
+          vvot  += v2*ti;
+          vvd   += v2*di;
+          vv    += v2;
+          da    += di*ai;
+          dv    += di*vi;
+        }
+        sum[index_turbulence_dax + id].add(da);
+        sum[index_turbulence_dvx + id].add(dv);
       }
+      sum[index_turbulence_vad].add(vad);
+      sum[index_turbulence_aad].add(aad);
+      sum[index_turbulence_vvdot].add(vvdot);
+      sum[index_turbulence_vvot].add(vvot);
+      sum[index_turbulence_vvd].add(vvd);
+      sum[index_turbulence_vv].add(vv);
+
+      double dd=0.0, ds=0.0, dlnd=0.0;
+#pragma omp simd reduction(+:dd,ds,dlnd) reduction(min:mind) reduction(max:maxd)
+      for (int ix=0; ix<nx; ix++) {
+        const double di = d[ix];
+        dd   += di*di;
+        ds   += di;
+        dlnd += di*log(di);
+        mind = (di < mind) ? di : mind;
+        maxd = (di > maxd) ? di : maxd;
+      }
+      sum[index_turbulence_dd].add(dd);
+      sum[index_turbulence_d].add(ds);
+      sum[index_turbulence_dlnd].add(dlnd);
+      sum[index_turbulence_zones].add(nx);
     }
   }
 
-  CkCallback callback (CkIndex_EnzoBlock::r_method_turbulence_end(NULL),
-		       enzo_block->proxy_array());
-  enzo_block->contribute(n*sizeof(double),g,r_method_turbulence_type,callback);
+  if (g != nullptr) {
+    for (int i=0; i<max_turbulence_array-2; i++) g[i] = sum[i].value();
+    g[index_turbulence_mind] = mind;
+    g[index_turbulence_maxd] = maxd;
+  }
+
+  TRACE_TURBULENCE;
 }
 
 //----------------------------------------------------------------------
@@ -189,23 +384,24 @@ void register_method_turbulence(void)
 
 CkReductionMsg * r_method_turbulence(int n, CkReductionMsg ** msgs)
 {
+  CompensatedSum sum[max_turbulence_array-2];
   double accum[max_turbulence_array];
-  for (int i=0; i<max_turbulence_array; i++) {
-    accum[i] = 0.0;
-  }
   accum[index_turbulence_mind] = std::numeric_limits<double>::max();
   accum[index_turbulence_maxd] = - std::numeric_limits<double>::max();
 
   for (int i=0; i<n; i++) {
     double * values = (double *) msgs[i]->getData();
     for (int ig=0; ig<max_turbulence_array-2; ig++) {
-      accum [ig] += values[ig];
+      sum[ig].add(values[ig]);
     }
     accum [index_turbulence_mind] =
       std::min(accum[index_turbulence_mind],values[index_turbulence_mind]);
     accum [index_turbulence_maxd] =
       std::max(accum[index_turbulence_maxd],values[index_turbulence_maxd]);
   }
+  for (int ig=0; ig<max_turbulence_array-2; ig++) {
+    accum[ig] = sum[ig].value();
+  }
   return CkReductionMsg::buildNew(max_turbulence_array*sizeof(double),accum);
 }
 
@@ -215,7 +411,8 @@ void EnzoBlock::r_method_turbulence_end(CkReductionMsg * msg)
 {
   TRACE_TURBULENCE;
   performance_start_(perf_compute,__FILE__,__LINE__);
-  method()->compute_resume (this,msg);
+  // with overlapping reductions the current method may differ
+  cello::problem()->method("turbulence")->compute_resume (this,msg);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
@@ -366,38 +563,57 @@ void EnzoMethodTurbulence::compute_resume
 		    g[index_turbulence_maxd]);
   }
 
-  if (block->is_leaf()) {
-    compute_resume_(block,msg);
-  }
+  if (! overlap_reduction_) {
 
-  delete msg;
-  block->compute_done();
+    if (block->is_leaf()) {
+      compute_resume_(block,g);
+    }
+
+    delete msg;
+    block->compute_done();
 
+  } else {
+
+    // save sums for the next cycle's forcing, and resume compute() if
+    // it is waiting for them
+
+    double * sums = block->data()->scalar_double().value(i_sums_);
+    for (int i=0; i<max_turbulence_array; i++) sums[i] = g[i];
+    delete msg;
+
+    Scalar<int> scalar = block->data()->scalar_int();
+    *scalar.value(i_received_) = *scalar.value(i_contributed_);
+    if (*scalar.value(i_waiting_)) {
+      compute_overlap_(block);
+    }
+  }
 }
 
 //----------------------------------------------------------------------
 
 void EnzoMethodTurbulence::compute_resume_
-(Block * block, CkReductionMsg * msg) throw()
+(Block * block, const double * g) throw()
 {
-
   TRACE_TURBULENCE;
+
+  update_(block,norm_(block,g),g,nullptr);
+}
+
+//----------------------------------------------------------------------
+
+double EnzoMethodTurbulence::norm_
+(Block * block, const double * g) const throw()
+{
   // Compute normalization
 
   Field field = block->data()->field();
 
-  int mx,my,mz;
   int nx,ny,nz;
-  int gx,gy,gz;
-  field.dimensions (0,&mx,&my,&mz);
-  field.size         (&nx,&ny,&nz);
-  field.ghost_depth(0,&gx,&gy,&gz);
-
-  int n = nx*ny*nz;
+  field.size (&nx,&ny,&nz);
 
-  double * g = (double *)msg->getData();
+  const int n = nx*ny*nz;
 
-  double dt = block->dt();
+  const double dt = block->dt();
 
   double norm = (edot_ != 0.0) ?
     ( sqrt(g[0]*g[0] + 2.0*n*g[1]*dt*edot_) - g[0] ) / g[1] : 0.0;
@@ -407,42 +623,5 @@ void EnzoMethodTurbulence::compute_resume_
   double dt0 = dt;
   norm = (dt/dt0)*norm;
 
-  const int rank = cello::rank();
-
-  enzo_float * te = (enzo_float*) field.values ("total_energy");
-  enzo_float * v3[3] = {
-    (enzo_float*) field.values ("velocity_x"),
-    (enzo_float*) field.values ("velocity_y"),
-    (enzo_float*) field.values ("velocity_z") };
-  enzo_float * a3[3] = {
-    (enzo_float*) field.values ("driving_x"),
-    (enzo_float*) field.values ("driving_y"),
-    (enzo_float*) field.values ("driving_z") };
-
-  // compute bulk momentum
-  const enzo_float bm[3] =
-    { enzo_float(g[index_turbulence_dax]/n),
-      enzo_float(g[index_turbulence_day]/n),
-      enzo_float(g[index_turbulence_daz]/n)};
-
-  //  for (int dim = 0; dim <  MetaData->TopGridRank; dim++)
-  //	bulkMomentum[dim] = GlobVal[7+dim]/numberOfGridZones;
-
-  for (int iz=gz; iz<gz+nz; iz++) {
-    for (int iy=gy; iy<gy+ny; iy++) {
-      for (int ix=gx; ix<gx+nx; ix++) {
-	int i = ix + mx*(iy + my*iz);
-	for (int id=0; id<rank; id++) {
-	  //	  	  te[i] += v3[id][i]*a3[id][i]*norm + 0.5*a3[id][i]*norm*a3[id][i]*norm;
-	  //	  	  v3[id][i] += a3[id][i]*norm;
-	  te[i] += (v3[id][i]*(a3[id][i]-bm[id]))*norm;
-	  v3[id][i] += (a3[id][i]-bm[id])*norm;
-
-	}
-      }
-    }
-  }
-
-  TRACE_TURBULENCE;
-
+  return norm;
 }
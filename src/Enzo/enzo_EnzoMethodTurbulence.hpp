@@ -24,7 +24,10 @@ public: // interface
 		       double density_initial,
 		       double temperature_initial,
 		       double mach_number,
-		       bool comoving_coordinates);
+		       bool comoving_coordinates,
+		       bool overlap_reduction = false,
+		       const EnzoTurbulenceDrivingOU & driving_ou =
+		       EnzoTurbulenceDrivingOU());
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoMethodTurbulence);
@@ -36,7 +39,14 @@ public: // interface
       temperature_initial_(0.0),
       edot_(0.0),
       mach_number_(0.0),
-      comoving_coordinates_(false)
+      comoving_coordinates_(false),
+      overlap_reduction_(false),
+      driving_ou_(),
+      i_sums_(-1),
+      i_contributed_(-1),
+      i_received_(-1),
+      i_waiting_(-1),
+      cycle_first_(-1)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -54,7 +64,25 @@ public: // interface
 
 private: // methods
 
-  void compute_resume_ (Block * block, CkReductionMsg * msg) throw();
+  /// Apply forcing using the given global sums
+  void compute_resume_ (Block * block, const double * g) throw();
+
+  /// Apply forcing from the previous cycle's global sums if
+  /// available, accumulate this block's sums, and contribute them
+  /// without waiting for the reduction (overlap_reduction_ only)
+  void compute_overlap_ (Block * block) throw();
+
+  /// Forcing normalization for the block given the global sums
+  double norm_ (Block * block, const double * g) const throw();
+
+  /// Fused pass over the block's active cells: if norm is non-zero
+  /// apply the forcing with bulk momentum from g_prev, then if g is
+  /// not null accumulate the block's sums of the updated fields into g
+  void update_ (Block * block, double norm, const double * g_prev,
+                double * g) const throw();
+
+  /// Contribute the block's sums to the global reduction
+  void contribute_ (Block * block, double * g) const throw();
 
 private: // attributes
 
@@ -72,6 +100,27 @@ private: // attributes
 
   // Comoving Coordinates
   bool comoving_coordinates_;
+
+  /// Whether the reduction of the global sums overlaps with
+  /// subsequent methods, with forcing lagging by one cycle
+  bool overlap_reduction_;
+
+  /// Ornstein-Uhlenbeck driving field, if it has any modes; otherwise
+  /// the driving field is fixed by the initial conditions
+  EnzoTurbulenceDrivingOU driving_ou_;
+
+  /// Block Scalar indices for overlap_reduction_: the last received
+  /// global sums, the cycle + 1 of the last contribution and of the
+  /// last received reduction, and whether compute() is waiting
+  int i_sums_;
+  int i_contributed_;
+  int i_received_;
+  int i_waiting_;
+
+  /// First cycle computed by this object since it was created or
+  /// restarted, when reductions pending at checkpoint are lost (not
+  /// checkpointed)
+  int cycle_first_;
 };
 
 #endif /* ENZO_ENZO_METHOD_TURBULENCE_HPP */
@@ -645,12 +645,32 @@ Method * EnzoProblem::create_method_
     
   } else if (name == "turbulence") {
 
+    EnzoTurbulenceDrivingOU driving_ou;
+    if (enzo_config->method_turbulence_driving == "ou") {
+      const double correlation_time =
+        enzo_config->method_turbulence_ou_correlation_time;
+      const double update_interval =
+        (enzo_config->method_turbulence_ou_update_interval > 0.0) ?
+        enzo_config->method_turbulence_ou_update_interval :
+        0.1*correlation_time;
+      driving_ou = EnzoTurbulenceDrivingOU
+        (cello::rank(),
+         enzo_config->method_turbulence_ou_k_min,
+         enzo_config->method_turbulence_ou_k_max,
+         correlation_time,
+         update_interval,
+         enzo_config->method_turbulence_ou_solenoidal_fraction,
+         enzo_config->method_random_seed);
+    }
+
     method = new EnzoMethodTurbulence
       (enzo_config->method_turbulence_edot,
        enzo_config->initial_turbulence_density,
        enzo_config->initial_turbulence_temperature,
        enzo_config->method_turbulence_mach_number,
-       enzo_config->physics_cosmology);
+       enzo_config->physics_cosmology,
+       enzo_config->method_turbulence_overlap_reduction,
+       driving_ou);
 
   } else if (name == "cosmology") {
 
@@ -58,15 +58,19 @@ int EnzoRefineShock::apply ( Block * block ) throw ()
 	  "velocity_x field must be defined",
 	 (id_velocity >= 0));
 
-    void * v3[3] = {
-    (rank >= 1) ? field.values("velocity_x") : NULL,
-    (rank >= 2) ? field.values("velocity_y") : NULL,
-    (rank >= 3) ? field.values("velocity_z") : NULL
+  // read-only access, so that derived fields of the block stay cached
+
+  const Field & field_const = field;
+
+  const void * v3[3] = {
+    (rank >= 1) ? field_const.values("velocity_x") : NULL,
+    (rank >= 2) ? field_const.values("velocity_y") : NULL,
+    (rank >= 3) ? field_const.values("velocity_z") : NULL
   };
 
-  void * te = field.values("total_energy");
-  void * de = field.values("density");
-  void * p  = field.values("pressure");
+  const void * te = field_const.values("total_energy");
+  const void * de = field_const.values("density");
+  const void * p  = field_const.values("pressure");
    
   int gx,gy,gz;
   field.ghost_depth(id_velocity, &gx,&gy,&gz);
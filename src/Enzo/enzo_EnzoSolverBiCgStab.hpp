@@ -175,13 +175,13 @@ public: // interface
   void allocate_temporary_(Block * block)
   {
     Field field = block->data()->field();
-    field.allocate_temporary(ir_);
-    field.allocate_temporary(ir0_);
-    field.allocate_temporary(ip_);
-    field.allocate_temporary(iy_);
-    field.allocate_temporary(iv_);
-    field.allocate_temporary(iq_);
-    field.allocate_temporary(iu_);
+    field.allocate_temporary(ir_,memory_category_solver);
+    field.allocate_temporary(ir0_,memory_category_solver);
+    field.allocate_temporary(ip_,memory_category_solver);
+    field.allocate_temporary(iy_,memory_category_solver);
+    field.allocate_temporary(iv_,memory_category_solver);
+    field.allocate_temporary(iq_,memory_category_solver);
+    field.allocate_temporary(iu_,memory_category_solver);
   }
 
   /// Dellocate temporary Fields
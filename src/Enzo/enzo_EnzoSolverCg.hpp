@@ -153,10 +153,10 @@ protected: // methods
   /// Allocate temporary Fields
   void allocate_temporary_(Field field, Block * block = NULL)
   {
-    field.allocate_temporary(id_);
-    field.allocate_temporary(ir_);
-    field.allocate_temporary(iy_);
-    field.allocate_temporary(iz_);
+    field.allocate_temporary(id_,memory_category_solver);
+    field.allocate_temporary(ir_,memory_category_solver);
+    field.allocate_temporary(iy_,memory_category_solver);
+    field.allocate_temporary(iz_,memory_category_solver);
   }
 
   /// Dellocate temporary Fields
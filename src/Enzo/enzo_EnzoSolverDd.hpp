@@ -140,7 +140,7 @@ public: // methods
   void allocate_temporary_(Block * block)
   {
     Field field = block->data()->field();
-    field.allocate_temporary(ixc_);
+    field.allocate_temporary(ixc_,memory_category_solver);
   }
 	      
   /// Dellocate temporary Fields
@@ -77,7 +77,7 @@ void EnzoSolverDiagonal::compute_
 
   if (is_finest_(block)) {
 
-    field.allocate_temporary(id_);
+    field.allocate_temporary(id_,memory_category_solver);
 
     ///   - X = 0
     ///   - R = P = B ( residual with X = 0);
@@ -106,8 +106,8 @@ protected: // methods
   /// Allocate temporary Fields
   void allocate_temporary_(Field field, Block * block = NULL)
   {
-    field.allocate_temporary(id_);
-    field.allocate_temporary(ir_);
+    field.allocate_temporary(id_,memory_category_solver);
+    field.allocate_temporary(ir_,memory_category_solver);
   }
 
   /// Dellocate temporary Fields
@@ -273,8 +273,8 @@ protected: // methods
   void allocate_temporary_(Block * block)
   {
     Field field = block->data()->field();
-    field.allocate_temporary(ir_);
-    field.allocate_temporary(ic_);
+    field.allocate_temporary(ir_,memory_category_solver);
+    field.allocate_temporary(ic_,memory_category_solver);
   }
 	      
   /// Dellocate temporary Fields
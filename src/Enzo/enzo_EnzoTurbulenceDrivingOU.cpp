@@ -0,0 +1,260 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoTurbulenceDrivingOU.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Implementation of the EnzoTurbulenceDrivingOU class
+
+#include "cello.hpp"
+
+#include "enzo.hpp"
+
+//----------------------------------------------------------------------
+
+EnzoTurbulenceDrivingOU::EnzoTurbulenceDrivingOU() throw()
+  : rank_(0),
+    correlation_time_(0.0),
+    update_interval_(0.0),
+    solenoidal_fraction_(0.0),
+    seed_(0),
+    step_(0),
+    k_(),
+    amplitude_()
+{ }
+
+//----------------------------------------------------------------------
+
+EnzoTurbulenceDrivingOU::EnzoTurbulenceDrivingOU
+(int rank,
+ double k_min, double k_max,
+ double correlation_time,
+ double update_interval,
+ double solenoidal_fraction,
+ uint64_t seed) throw()
+  : rank_(rank),
+    correlation_time_(correlation_time),
+    update_interval_(update_interval),
+    solenoidal_fraction_(solenoidal_fraction),
+    seed_(seed),
+    step_(0),
+    k_(),
+    amplitude_()
+{
+  ASSERT2 ("EnzoTurbulenceDrivingOU::EnzoTurbulenceDrivingOU()",
+           "Invalid wave number range [%g,%g]",
+           k_min, k_max, (0.0 < k_max && k_min <= k_max));
+  ASSERT2 ("EnzoTurbulenceDrivingOU::EnzoTurbulenceDrivingOU()",
+           "correlation time %g and update interval %g must be positive",
+           correlation_time, update_interval,
+           (correlation_time > 0.0 && update_interval > 0.0));
+
+  // modes in the half-space kz > 0, or kz == 0 and ky > 0, or kz ==
+  // ky == 0 and kx > 0; the field is real so modes -k are implied
+
+  const int K = int(k_max);
+  const int Ky = (rank >= 2) ? K : 0;
+  const int Kz = (rank >= 3) ? K : 0;
+  for (int kz=0; kz<=Kz; kz++) {
+    for (int ky=-Ky; ky<=Ky; ky++) {
+      for (int kx=-K; kx<=K; kx++) {
+        const bool upper = (kz > 0) || (kz == 0 && (ky > 0 || (ky == 0 && kx > 0)));
+        const double k = sqrt(double(kx*kx + ky*ky + kz*kz));
+        if (upper && k_min <= k && k <= k_max) {
+          k_.push_back(kx);
+          k_.push_back(ky);
+          k_.push_back(kz);
+        }
+      }
+    }
+  }
+
+  ASSERT2 ("EnzoTurbulenceDrivingOU::EnzoTurbulenceDrivingOU()",
+           "No Fourier modes with wave numbers in [%g,%g]",
+           k_min, k_max, num_modes() > 0);
+
+  amplitude_.resize(6*num_modes());
+  initialize_();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoTurbulenceDrivingOU::pup (PUP::er &p)
+{
+  // NOTE: change this function whenever attributes change
+
+  TRACEPUP;
+
+  p | rank_;
+  p | correlation_time_;
+  p | update_interval_;
+  p | solenoidal_fraction_;
+  p | seed_;
+  p | step_;
+  p | k_;
+  p | amplitude_;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoTurbulenceDrivingOU::advance (double time) throw()
+{
+  const long long step = (long long)(std::floor(time / update_interval_));
+
+  // amplitudes are a function of the step only, so can be recomputed
+  // from the start if needed
+
+  if (step < step_) initialize_();
+
+  while (step_ < step) update_();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoTurbulenceDrivingOU::evaluate
+(Block * block, enzo_float * a3[3]) const throw()
+{
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.dimensions (0,&mx,&my,&mz);
+  field.ghost_depth(0,&gx,&gy,&gz);
+
+  double xm,ym,zm;
+  double xp,yp,zp;
+  block->data()->lower(&xm,&ym,&zm);
+  block->data()->upper(&xp,&yp,&zp);
+
+  double hx,hy,hz;
+  field.cell_width(xm,xp,&hx,ym,yp,&hy,zm,zp,&hz);
+
+  double dxm,dym,dzm;
+  double dxp,dyp,dzp;
+  cello::hierarchy()->lower(&dxm,&dym,&dzm);
+  cello::hierarchy()->upper(&dxp,&dyp,&dzp);
+
+  const int m = mx*my*mz;
+  for (int id=0; id<rank_; id++) {
+    std::fill_n(a3[id],m,enzo_float(0.0));
+  }
+
+  // cos and sin of 2 pi k x / L at cell centers for each axis and
+  // wave number -K <= k <= K
+
+  int K = 0;
+  for (size_t i=0; i<k_.size(); i++) K = std::max(K,std::abs(k_[i]));
+  const int nk = 2*K + 1;
+
+  ScratchFrame scratch;
+  const int    m3[3] = { mx, my, mz };
+  const int    g3[3] = { gx, gy, gz };
+  const double x3[3] = { xm, ym, zm };
+  const double h3[3] = { hx, hy, hz };
+  const double l3[3] = { dxp - dxm, dyp - dym, dzp - dzm };
+  const double o3[3] = { dxm, dym, dzm };
+  double * cos3[3];
+  double * sin3[3];
+  for (int axis=0; axis<3; axis++) {
+    const int n = m3[axis];
+    cos3[axis] = scratch.allocate<double>(nk*n);
+    sin3[axis] = scratch.allocate<double>(nk*n);
+    for (int k=-K; k<=K; k++) {
+      double * c = cos3[axis] + (k+K)*n;
+      double * s = sin3[axis] + (k+K)*n;
+      const double w = (axis < rank_) ? 2.0*cello::pi*k/l3[axis] : 0.0;
+      for (int i=0; i<n; i++) {
+        const double x = x3[axis] + (i - g3[axis] + 0.5)*h3[axis] - o3[axis];
+        c[i] = cos(w*x);
+        s[i] = sin(w*x);
+      }
+    }
+  }
+
+  // row values of cos and sin of k.x
+
+  double * c_row = scratch.allocate<double>(mx);
+  double * s_row = scratch.allocate<double>(mx);
+
+  const int num_modes = this->num_modes();
+  for (int mode=0; mode<num_modes; mode++) {
+    const int * k = &k_[3*mode];
+    const double * cx = cos3[0] + (k[0]+K)*mx;
+    const double * sx = sin3[0] + (k[0]+K)*mx;
+    const double * cy = cos3[1] + (k[1]+K)*my;
+    const double * sy = sin3[1] + (k[1]+K)*my;
+    const double * cz = cos3[2] + (k[2]+K)*mz;
+    const double * sz = sin3[2] + (k[2]+K)*mz;
+    const double * A = &amplitude_[6*mode];
+    for (int iz=0; iz<mz; iz++) {
+      for (int iy=0; iy<my; iy++) {
+        const double cyz = cy[iy]*cz[iz] - sy[iy]*sz[iz];
+        const double syz = sy[iy]*cz[iz] + cy[iy]*sz[iz];
+#pragma omp simd
+        for (int ix=0; ix<mx; ix++) {
+          c_row[ix] = cx[ix]*cyz - sx[ix]*syz;
+          s_row[ix] = sx[ix]*cyz + cx[ix]*syz;
+        }
+        const int i0 = mx*(iy + my*iz);
+        for (int id=0; id<rank_; id++) {
+          // a += 2 Re (A exp(i k.x)), including the implied mode -k
+          const double ar = 2.0*A[2*id];
+          const double ai = 2.0*A[2*id+1];
+          enzo_float * a = a3[id] + i0;
+#pragma omp simd
+          for (int ix=0; ix<mx; ix++) {
+            a[ix] += ar*c_row[ix] - ai*s_row[ix];
+          }
+        }
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoTurbulenceDrivingOU::initialize_ () throw()
+{
+  step_ = 0;
+  std::fill(amplitude_.begin(),amplitude_.end(),0.0);
+  add_random_(1.0);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoTurbulenceDrivingOU::update_ () throw()
+{
+  // exact update of the Ornstein-Uhlenbeck process over one interval,
+  // preserving its unit stationary variance
+
+  ++step_;
+  const double f = exp(-update_interval_ / correlation_time_);
+  for (size_t i=0; i<amplitude_.size(); i++) amplitude_[i] *= f;
+  add_random_(sqrt(1.0 - f*f));
+}
+
+//----------------------------------------------------------------------
+
+void EnzoTurbulenceDrivingOU::add_random_ (double scale) throw()
+{
+  const Random random (seed_, Random::stream("turbulence:ou"), step_);
+
+  const double zeta = solenoidal_fraction_;
+  const int num_modes = this->num_modes();
+
+  for (int mode=0; mode<num_modes; mode++) {
+    const int * k = &k_[3*mode];
+    const double k2 = double(k[0]*k[0] + k[1]*k[1] + k[2]*k[2]);
+    double * A = &amplitude_[6*mode];
+    for (int part=0; part<2; part++) {
+      // project onto solenoidal and compressive components
+      double xi[3] = {0.0, 0.0, 0.0};
+      for (int id=0; id<rank_; id++) xi[id] = random.normal(mode,2*id+part);
+      const double kxi = k[0]*xi[0] + k[1]*xi[1] + k[2]*xi[2];
+      for (int id=0; id<rank_; id++) {
+        const double xi_c = k[id]*kxi / k2;
+        const double xi_s = xi[id] - xi_c;
+        A[2*id+part] += scale*(zeta*xi_s + (1.0 - zeta)*xi_c);
+      }
+    }
+  }
+}
@@ -0,0 +1,99 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoTurbulenceDrivingOU.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Enzo] Declaration of the EnzoTurbulenceDrivingOU class
+///
+/// Stochastic turbulence driving field formed from a small set of
+/// Fourier modes whose complex amplitudes evolve by an
+/// Ornstein-Uhlenbeck process.  The process is advanced at a fixed
+/// time interval using counter-based random numbers keyed by the
+/// update step, so every process computes identical amplitudes
+/// without communication, independent of which Blocks it owns or
+/// whether the run was restarted.  The driving field is evaluated
+/// directly on each Block from per-axis sin/cos tables, at a cost
+/// proportional to the number of cells times the number of modes.
+
+#ifndef ENZO_ENZO_TURBULENCE_DRIVING_OU_HPP
+#define ENZO_ENZO_TURBULENCE_DRIVING_OU_HPP
+
+class EnzoTurbulenceDrivingOU {
+
+  /// @class    EnzoTurbulenceDrivingOU
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Ornstein-Uhlenbeck spectral driving field
+
+public: // interface
+
+  /// Create an empty driving field with no modes
+  EnzoTurbulenceDrivingOU() throw();
+
+  /// Create a driving field with modes k_min <= |k| <= k_max, in
+  /// units of the domain fundamental wave number, and the given
+  /// correlation time, update interval, and weight of the
+  /// solenoidal component (1.0 purely solenoidal, 0.0 purely
+  /// compressive)
+  EnzoTurbulenceDrivingOU(int rank,
+                          double k_min, double k_max,
+                          double correlation_time,
+                          double update_interval,
+                          double solenoidal_fraction,
+                          uint64_t seed) throw();
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+  /// Number of Fourier modes
+  int num_modes() const throw()
+  { return k_.size() / 3; }
+
+  /// Advance the mode amplitudes to the given time
+  void advance (double time) throw();
+
+  /// Evaluate the driving field on all cells of the Block, including
+  /// ghost zones
+  void evaluate (Block * block, enzo_float * a3[3]) const throw();
+
+private: // methods
+
+  /// Set amplitudes to a draw from the stationary distribution
+  void initialize_ () throw();
+
+  /// Advance amplitudes by one update interval
+  void update_ () throw();
+
+  /// Add projected random forcing with the given scale to the mode
+  /// amplitudes
+  void add_random_ (double scale) throw();
+
+private: // attributes
+
+  /// Dimensionality of the problem
+  int rank_;
+
+  /// Correlation time of the process
+  double correlation_time_;
+
+  /// Time between amplitude updates
+  double update_interval_;
+
+  /// Weight of the solenoidal component of the random forcing
+  double solenoidal_fraction_;
+
+  /// Seed for the random forcing
+  uint64_t seed_;
+
+  /// Update step of the current amplitudes
+  long long step_;
+
+  /// Integer wave vectors of the modes, 3 per mode
+  std::vector<int> k_;
+
+  /// Complex mode amplitudes: real and imaginary parts of the x, y
+  /// and z components, 6 per mode
+  std::vector<double> amplitude_;
+
+};
+
+#endif /* ENZO_ENZO_TURBULENCE_DRIVING_OU_HPP */
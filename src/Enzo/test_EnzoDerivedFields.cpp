@@ -0,0 +1,119 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoDerivedFields.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Test program for EnzoDerivedFields cache keys
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+#define CK_TEMPLATES_ONLY
+#include "enzo.def.h"
+#undef CK_TEMPLATES_ONLY
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("EnzoDerivedFields");
+
+  FieldDescr * field_descr = new FieldDescr;
+  field_descr->set_default_ghost_depth(1,1,1);
+  const int id_density     = field_descr->insert_permanent("density");
+  const int id_temperature = field_descr->insert_permanent("temperature");
+
+  const int nx = 4, ny = 4, nz = 4;
+  FieldData * field_data = new FieldData(field_descr,nx,ny,nz);
+  field_data->allocate_permanent(field_descr,true);
+
+  Field field (field_descr,field_data);
+
+  int mx,my,mz;
+  field.dimensions(id_density,&mx,&my,&mz);
+  const int m = mx*my*mz;
+  const int i_active = 1 + mx*(1 + my*1);
+
+  // acquire density for writing before computing, as star formation
+  // does before computing temperature and removing mass from cells
+
+  enzo_float * density = (enzo_float *) field.values(id_density);
+  enzo_float * temperature = (enzo_float *) field.values(id_temperature);
+  for (int i=0; i<m; i++) density[i] = 1.0;
+
+  DerivedFieldCache * cache = field.derived_cache();
+  const std::vector<std::string> inputs = { "density", "temperature" };
+
+  // "compute" temperature and cache it
+
+  for (int i=0; i<m; i++) temperature[i] = 100.0*density[i];
+  cache->set_current("temperature",EnzoDerivedFields::key(field,inputs));
+
+  unit_func ("key");
+
+  // const access still hits
+
+  const Field & field_const = field;
+  field_const.values("density");
+  unit_assert (cache->is_current
+               ("temperature",EnzoDerivedFields::key(field,inputs)));
+
+  // writing an input through a pointer acquired before the compute
+  // misses once the Method's declared writes are marked, as Block
+  // does when the Method completes
+
+  density[i_active] *= 0.5;
+  field_data->mark_modified(id_density);
+  unit_assert (! cache->is_current
+               ("temperature",EnzoDerivedFields::key(field,inputs)));
+
+  // recomputing makes it current again
+
+  for (int i=0; i<m; i++) temperature[i] = 100.0*density[i];
+  cache->set_current("temperature",EnzoDerivedFields::key(field,inputs));
+  unit_assert (cache->is_current
+               ("temperature",EnzoDerivedFields::key(field,inputs)));
+
+  // non-const access, e.g. by boundary conditions, misses
+
+  field.values("density");
+  unit_assert (! cache->is_current
+               ("temperature",EnzoDerivedFields::key(field,inputs)));
+  cache->set_current("temperature",EnzoDerivedFields::key(field,inputs));
+
+  // refreshing ghost zones misses
+
+  field.mark_ghosts_modified();
+  unit_assert (! cache->is_current
+               ("temperature",EnzoDerivedFields::key(field,inputs)));
+
+  // undefined input fields are allowed
+
+  unit_assert (EnzoDerivedFields::key(field,{ "density", "undefined" })
+               .size() == 3);
+
+  unit_func ("append_key");
+
+  std::vector<long long> key_1 = EnzoDerivedFields::key(field,inputs);
+  std::vector<long long> key_2 = key_1;
+  EnzoDerivedFields::append_key (key_1, 5.0/3.0);
+  EnzoDerivedFields::append_key (key_2, 1.4);
+  cache->set_current("temperature",key_1);
+  unit_assert (cache->is_current("temperature",key_1));
+  unit_assert (! cache->is_current("temperature",key_2));
+
+  delete field_data;
+  delete field_descr;
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
+
+#include "enzo.def.h"
@@ -0,0 +1,129 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoFeedbackRateTable.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Test program for the EnzoFeedbackRateTable class
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+#define CK_TEMPLATES_ONLY
+#include "enzo.def.h"
+#undef CK_TEMPLATES_ONLY
+
+//----------------------------------------------------------------------
+
+/// Return the maximum relative error of the tabulated rates of
+/// particles with the given ages and metallicities, and whether Type
+/// II rates, which are not tabulated, match exactly
+static double table_error (const EnzoFeedbackRateTable & table,
+                           const std::vector<double> & age,
+                           const std::vector<double> & Z,
+                           bool * snii_match)
+{
+  const int n = age.size();
+  std::vector<double> rate_snii(n), rate_snia(n), wind_factor(n),
+    wind_energy_factor(n), psi_ion(n);
+
+  table.evaluate (n, age.data(), Z.data(),
+                  rate_snii.data(), rate_snia.data(), wind_factor.data(),
+                  wind_energy_factor.data(), psi_ion.data());
+
+  *snii_match = true;
+  for (int i=0; i<n; i++) {
+    *snii_match = *snii_match &&
+      (rate_snii[i] == EnzoFeedbackRateTable::rate_snii_analytic(age[i]));
+  }
+
+  return EnzoFeedbackRateTable::relative_error
+    (n, age.data(), Z.data(), rate_snia.data(), wind_factor.data(),
+     wind_energy_factor.data(), psi_ion.data());
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("EnzoFeedbackRateTable");
+
+  const EnzoFeedbackRateTable * table = EnzoFeedbackRateTable::instance();
+
+  unit_func ("max_relative_error");
+
+  // midpoints between all table nodes
+
+  unit_assert (table->max_relative_error() < 1e-4);
+
+  unit_func ("evaluate");
+
+  bool snii_match = false;
+
+  // ages and metallicities spanning all segments, at log-spaced values
+  // that do not coincide with table nodes
+
+  std::vector<double> age, Z;
+  for (int i=0; i<400; i++) {
+    for (int j=0; j<12; j++) {
+      age.push_back(std::pow(10.0, -4.5 + 10.0*(i + 0.37)/400));
+      Z.push_back(std::pow(10.0, -10.0 + 11.0*(j + 0.61)/12));
+    }
+  }
+  unit_assert (table_error(*table,age,Z,&snii_match) < 1e-4);
+  unit_assert (snii_match);
+
+  // segment boundaries of the piecewise analytic expressions
+
+  age = { 0.0, 0.001, 0.0010001, 0.999999, 1.0, 3.401, 3.4999999, 3.5,
+          10.37, 25.0, 25.000001, 37.53, 37.529999, 99.999999, 100.0 };
+  Z.assign(age.size(), 1.0);
+  unit_assert (table_error(*table,age,Z,&snii_match) < 1e-4);
+  unit_assert (snii_match);
+
+  // values outside the tables use the analytic expressions: young
+  // star winds at very low metallicity (including zero), winds of
+  // stars older than the wind table, and wind energy of stars younger
+  // than the energy table.  Values clamped to the tables would be off
+  // by tens of percent or more
+
+  age = { 1.0, 2.0, 3.4, 2.0,
+          2.0e4, 1.0e5, 1.0e7,
+          0.0, 1.0e-5, 9.9e-5 };
+  Z   = { 1e-12, 1e-9, 1e-15, 0.0,
+          1.0, 0.1, 2.0,
+          1.0, 1.0, 1.0 };
+  unit_assert (table_error(*table,age,Z,&snii_match) < 1e-4);
+  unit_assert (snii_match);
+
+  unit_func ("evaluate_analytic");
+
+  // the analytic path agrees with the table within tolerance
+
+  age = { 0.5, 2.0, 5.0, 12.0, 40.0, 60.0, 500.0 };
+  Z   = { 0.02, 0.5, 1.0, 1.0, 1.0, 1.0, 1.0 };
+  const int n = age.size();
+  std::vector<double> rate_snii(n), rate_snia(n), wind_factor(n),
+    wind_energy_factor(n), psi_ion(n);
+  EnzoFeedbackRateTable::evaluate_analytic
+    (n, age.data(), Z.data(), rate_snii.data(), rate_snia.data(),
+     wind_factor.data(), wind_energy_factor.data(), psi_ion.data());
+  unit_assert (EnzoFeedbackRateTable::relative_error
+               (n, age.data(), Z.data(), rate_snia.data(),
+                wind_factor.data(), wind_energy_factor.data(),
+                psi_ion.data()) == 0.0);
+  unit_assert (table_error(*table,age,Z,&snii_match) < 1e-4);
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
+
+#include "enzo.def.h"
@@ -0,0 +1,500 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoMethodGrackle.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Test program for EnzoMethodGrackle batching, memoization and
+///           cooling time tables
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+#define CK_TEMPLATES_ONLY
+#include "enzo.def.h"
+#undef CK_TEMPLATES_ONLY
+
+//----------------------------------------------------------------------
+
+/// Grackle fields of a grid of nx*ny*nz active cells surrounded by one
+/// layer of ghost zones
+struct GrackleGrid {
+
+  GrackleGrid(int nx, int ny, int nz)
+    : fields(),
+      dimension{nx+2,ny+2,nz+2},
+      start{1,1,1},
+      end{nx,ny,nz},
+      values(num_fields, std::vector<gr_float>((nx+2)*(ny+2)*(nz+2),0.0))
+  {
+    fields.grid_rank      = 3;
+    fields.grid_dimension = dimension;
+    fields.grid_start     = start;
+    fields.grid_end       = end;
+    fields.grid_dx        = 1.0/nx;
+    bind_();
+  }
+
+  GrackleGrid(const GrackleGrid & grid)
+    : GrackleGrid(grid.end[0],grid.end[1],grid.end[2])
+  {
+    values = grid.values;
+    bind_();
+  }
+
+  GrackleGrid & operator= (const GrackleGrid &) = delete;
+
+  static constexpr int num_fields = 11;
+
+  static gr_float * grackle_field_data::* const * members()
+  {
+    static gr_float * grackle_field_data::* const members[num_fields] = {
+      &grackle_field_data::density,
+      &grackle_field_data::internal_energy,
+      &grackle_field_data::x_velocity,
+      &grackle_field_data::y_velocity,
+      &grackle_field_data::z_velocity,
+      &grackle_field_data::HI_density,
+      &grackle_field_data::HII_density,
+      &grackle_field_data::HeI_density,
+      &grackle_field_data::HeII_density,
+      &grackle_field_data::HeIII_density,
+      &grackle_field_data::e_density };
+    return members;
+  }
+
+  void bind_()
+  {
+    for (int k=0; k<num_fields; k++) {
+      fields.*members()[k] = values[k].data();
+    }
+  }
+
+  grackle_field_data fields;
+  int dimension[3];
+  int start[3];
+  int end[3];
+  std::vector< std::vector<gr_float> > values;
+};
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("EnzoMethodGrackle");
+
+  // primordial chemistry without a UV background or metal cooling,
+  // which needs no Grackle data file
+
+  chemistry_data chemistry;
+  set_default_chemistry_parameters(&chemistry);
+  chemistry.use_grackle            = 1;
+  chemistry.with_radiative_cooling = 1;
+  chemistry.primordial_chemistry   = 1;
+  chemistry.metal_cooling          = 0;
+  chemistry.UVbackground           = 0;
+
+  code_units units;
+  units.comoving_coordinates = 0;
+  units.density_units        = 1.67e-24;
+  units.length_units         = 3.086e21;
+  units.time_units           = 3.156e13;
+  units.velocity_units       = units.length_units / units.time_units;
+  units.a_units              = 1.0;
+  units.a_value              = 1.0;
+
+  chemistry_data_storage rates;
+  unit_assert (_initialize_chemistry_data(&chemistry,&rates,&units)
+               == ENZO_SUCCESS);
+
+  unit_func ("batching_supported");
+
+  unit_assert (EnzoMethodGrackle::batching_supported(&chemistry));
+  chemistry.H2_self_shielding = 2;
+  unit_assert (EnzoMethodGrackle::batching_supported(&chemistry));
+  chemistry.H2_self_shielding = 1;
+  unit_assert (! EnzoMethodGrackle::batching_supported(&chemistry));
+  chemistry.H2_self_shielding = 3;
+  unit_assert (! EnzoMethodGrackle::batching_supported(&chemistry));
+  chemistry.H2_self_shielding = 0;
+  chemistry.use_volumetric_heating_rate = 1;
+  unit_assert (! EnzoMethodGrackle::batching_supported(&chemistry));
+  chemistry.use_volumetric_heating_rate = 0;
+
+  unit_func ("solve_chemistry_batched");
+
+  // densities from 0.01 to 1000 cm^-3 and temperatures from about
+  // 1e3 K to 1e7 K, so that some cells need many Grackle subcycles
+  // and others need one
+
+  const int nx = 6, ny = 5, nz = 4;
+  GrackleGrid grid (nx,ny,nz);
+  const int * d3 = grid.dimension;
+  for (int iz=0; iz<d3[2]; iz++) {
+    for (int iy=0; iy<d3[1]; iy++) {
+      for (int ix=0; ix<d3[0]; ix++) {
+        const int i = INDEX(ix,iy,iz,d3[0],d3[1]);
+        const double d = std::pow(10.0, -2.0 + 5.0*ix/(d3[0]-1));
+        const double t = std::pow(10.0, 3.0 + 4.0*(iy + d3[1]*iz)
+                                  / (d3[1]*d3[2]-1));
+        const double x = (t > 2e4) ? 0.99 : 0.01;
+        grid.fields.density[i]         = d;
+        grid.fields.internal_energy[i] = 2.16e-8*t;
+        grid.fields.HI_density[i]      = 0.76*d*(1.0 - x);
+        grid.fields.HII_density[i]     = 0.76*d*x;
+        grid.fields.HeI_density[i]     = 0.24*d;
+        grid.fields.e_density[i]       = 0.76*d*x;
+      }
+    }
+  }
+
+  const double dt = 0.1;
+
+  GrackleGrid grid_3d (grid);
+  GrackleGrid grid_batched (grid);
+
+  std::vector<gr_float> cooling_time (d3[0]*d3[1]*d3[2]);
+  unit_assert (local_calculate_cooling_time
+               (&chemistry,&rates,&units,&grid.fields,cooling_time.data())
+               == ENZO_SUCCESS);
+
+  int num_subcycled = 0, num_cells = 0;
+  for (int iz=1; iz<=nz; iz++) {
+    for (int iy=1; iy<=ny; iy++) {
+      for (int ix=1; ix<=nx; ix++) {
+        const int i = INDEX(ix,iy,iz,d3[0],d3[1]);
+        if (std::abs(cooling_time[i]) < 10.0*dt) ++num_subcycled;
+        ++num_cells;
+      }
+    }
+  }
+  unit_assert (0 < num_subcycled && num_subcycled < num_cells);
+
+  unit_assert (local_solve_chemistry
+               (&chemistry,&rates,&units,&grid_3d.fields,dt)
+               == ENZO_SUCCESS);
+
+  // a batch size that does not divide the number of cells
+
+  unit_assert (EnzoMethodGrackle::solve_chemistry_batched
+               (&chemistry,&rates,&units,&grid_batched.fields,dt,7)
+               == ENZO_SUCCESS);
+
+  // batched and in-place solutions agree, and ghost zones are not
+  // solved
+
+  double max_error = 0.0;
+  bool ghosts_unchanged = true;
+  bool any_changed = false;
+  for (int k=0; k<GrackleGrid::num_fields; k++) {
+    const std::vector<gr_float> & a = grid_3d.values[k];
+    const std::vector<gr_float> & b = grid_batched.values[k];
+    const std::vector<gr_float> & c = grid.values[k];
+    for (int iz=0; iz<d3[2]; iz++) {
+      for (int iy=0; iy<d3[1]; iy++) {
+        for (int ix=0; ix<d3[0]; ix++) {
+          const int i = INDEX(ix,iy,iz,d3[0],d3[1]);
+          const bool ghost = (ix < 1 || ix > nx ||
+                              iy < 1 || iy > ny ||
+                              iz < 1 || iz > nz);
+          if (ghost) {
+            ghosts_unchanged = ghosts_unchanged && (b[i] == c[i]);
+          } else {
+            const double scale = std::max(std::abs(a[i]),1e-30);
+            max_error = std::max(max_error, std::abs(a[i] - b[i])/scale);
+            any_changed = any_changed || (a[i] != c[i]);
+          }
+        }
+      }
+    }
+  }
+
+  unit_assert (any_changed);
+  unit_assert (ghosts_unchanged);
+  unit_assert (max_error < 1e-6);
+
+  //--------------------------------------------------
+
+  unit_class ("EnzoGrackleDerivedField");
+
+  // Block fields, with the precision Grackle expects
+
+  FieldDescr * field_descr = new FieldDescr;
+  field_descr->set_default_ghost_depth(1,1,1);
+  const char * field_names[] = {
+    "density", "internal_energy", "velocity_x", "velocity_y", "velocity_z",
+    "HI_density", "HII_density", "HeI_density", "HeII_density",
+    "HeIII_density", "e_density" };
+  std::vector<int> field_input;
+  for (const char * name : field_names) {
+    const int id_field = field_descr->insert_permanent(name);
+    field_descr->set_precision
+      (id_field, (sizeof(gr_float) == 4) ? precision_single : precision_double);
+    field_input.push_back(id_field);
+  }
+
+  FieldData * field_data = new FieldData(field_descr,4,4,4);
+  field_data->allocate_permanent(field_descr,true);
+  Field field (field_descr,field_data);
+
+  int mx,my,mz;
+  field.dimensions(0,&mx,&my,&mz);
+  const int m = mx*my*mz;
+
+  int field_dimension[3] = {mx,my,mz};
+  int field_start[3]     = {0,0,0};
+  int field_end[3]       = {mx-1,my-1,mz-1};
+  grackle_field_data block_fields = grackle_field_data();
+  block_fields.grid_rank      = 3;
+  block_fields.grid_dimension = field_dimension;
+  block_fields.grid_start     = field_start;
+  block_fields.grid_end       = field_end;
+  block_fields.grid_dx        = 0.25;
+  for (int k=0; k<GrackleGrid::num_fields; k++) {
+    block_fields.*GrackleGrid::members()[k] =
+      (gr_float *) field.values(field_input[k]);
+  }
+
+  for (int i=0; i<m; i++) {
+    const double d = std::pow(10.0, -1.0 + 3.0*i/(m-1));
+    block_fields.density[i]         = d;
+    block_fields.internal_energy[i] = 2.16e-8*std::pow(10.0, 4.0 + 3.0*i/m);
+    block_fields.HI_density[i]      = 0.76*d*0.5;
+    block_fields.HII_density[i]     = 0.76*d*0.5;
+    block_fields.HeI_density[i]     = 0.24*d;
+    block_fields.e_density[i]       = 0.76*d*0.5;
+  }
+
+  // evaluate the cooling time as EnzoMethodGrackle::compute_memoized_()
+  // does, counting evaluations
+
+  grackle_local_property_func func = &local_calculate_cooling_time;
+  EnzoGrackleDerivedField derived;
+  int num_evaluations = 0;
+  auto memoized = [&] (double time) {
+    const std::vector<long long> key =
+      EnzoGrackleDerivedField::make_key(field,field_input);
+    if (! derived.is_current(time,key,m)) {
+      derived.values.resize(m);
+      (*func)(&chemistry,&rates,&units,&block_fields,derived.values.data());
+      derived.key  = key;
+      derived.time = time;
+      ++num_evaluations;
+    }
+    return derived.values;
+  };
+  auto direct = [&] () {
+    std::vector<enzo_float> values (m);
+    (*func)(&chemistry,&rates,&units,&block_fields,values.data());
+    return values;
+  };
+
+  unit_func ("is_current");
+
+  unit_assert (memoized(1.0) == direct());
+  unit_assert (num_evaluations == 1);
+
+  // unchanged inputs, read through const access, reuse values
+
+  const Field & field_const = field;
+  field_const.values("density");
+  unit_assert (memoized(1.0) == direct());
+  unit_assert (num_evaluations == 1);
+
+  // non-const access must be recomputed
+
+  field.values("density");
+  unit_assert (memoized(1.0) == direct());
+  unit_assert (num_evaluations == 2);
+
+  // writes through the bound arrays must be recomputed once marked, as
+  // Block does for fields a Method declares writing when it completes
+
+  const int i_active = 1 + mx*(1 + my*1);
+  block_fields.density[i_active] *= 2.0;
+  field_data->mark_modified(field_input[0]);
+  unit_assert (memoized(1.0) == direct());
+  unit_assert (num_evaluations == 3);
+
+  // refreshed ghost zones must be recomputed, since values include them
+
+  block_fields.internal_energy[0] *= 2.0;
+  field.mark_ghosts_modified();
+  unit_assert (memoized(1.0) == direct());
+  unit_assert (num_evaluations == 4);
+
+  // a new Block time must be recomputed, e.g. for time-dependent units
+
+  unit_assert (memoized(2.0) == direct());
+  unit_assert (num_evaluations == 5);
+
+  delete field_data;
+  delete field_descr;
+
+  _free_chemistry_data(&chemistry,&rates);
+
+  //--------------------------------------------------
+
+  unit_class ("EnzoGrackleCoolingTable");
+
+  unit_func ("supported");
+
+  unit_assert (! EnzoGrackleCoolingTable::supported(&chemistry));
+
+  // tabulated cooling uses Cloudy tables, found as in the answer tests
+
+  const char * data_dir = getenv("GRACKLE_INPUT_DATA_DIR");
+  if (data_dir == nullptr) {
+
+    unit_func ("rate");
+    unit_assert (unit_incomplete);
+
+  } else {
+
+    std::string data_file =
+      std::string(data_dir) + "/CloudyData_UVB=HM2012_shielded.h5";
+
+    chemistry_data chemistry_table;
+    set_default_chemistry_parameters(&chemistry_table);
+    chemistry_table.use_grackle            = 1;
+    chemistry_table.with_radiative_cooling = 1;
+    chemistry_table.primordial_chemistry   = 0;
+    chemistry_table.metal_cooling          = 1;
+    chemistry_table.UVbackground           = 0;
+    chemistry_table.grackle_data_file      = data_file.c_str();
+
+    chemistry_data_storage rates_table;
+    unit_assert (_initialize_chemistry_data
+                 (&chemistry_table,&rates_table,&units) == ENZO_SUCCESS);
+
+    unit_assert (EnzoGrackleCoolingTable::supported(&chemistry_table));
+
+    const double solar = chemistry_table.SolarMetalFractionByMass;
+
+    // direct cooling rates 1/t_cool of cells
+
+    auto direct_rate = [&] (const std::vector<double> & log_density,
+                            const std::vector<double> & log_energy,
+                            const std::vector<double> & metal_fraction) {
+      const int n = log_density.size();
+      std::vector<gr_float> density (n), energy (n), metal (n);
+      std::vector<gr_float> cooling_time (n);
+      for (int i=0; i<n; i++) {
+        density[i] = std::pow(10.0,log_density[i]);
+        energy[i]  = std::pow(10.0,log_energy[i]);
+        metal[i]   = density[i]*metal_fraction[i];
+      }
+      int dimension[3] = {n,1,1};
+      int start[3]     = {0,0,0};
+      int end[3]       = {n-1,0,0};
+      grackle_field_data fields = grackle_field_data();
+      fields.grid_rank       = 1;
+      fields.grid_dimension  = dimension;
+      fields.grid_start      = start;
+      fields.grid_end        = end;
+      fields.density         = density.data();
+      fields.internal_energy = energy.data();
+      fields.metal_density   = metal.data();
+      local_calculate_cooling_time
+        (&chemistry_table,&rates_table,&units,&fields,cooling_time.data());
+      std::vector<double> rate (n);
+      for (int i=0; i<n; i++) rate[i] = 1.0 / cooling_time[i];
+      return rate;
+    };
+
+    // log specific internal energy from about 10^3.5 K to 10^7 K
+
+    EnzoGrackleCoolingTable table;
+    const double range_density[2] = { -2.0, 2.0 };
+    const double range_energy[2]  = { -4.0, -0.5 };
+
+    unit_func ("update");
+
+    table.update (&chemistry_table,&rates_table,units,
+                  range_density,range_energy);
+    const int n_density = table.num_nodes(0);
+    const int n_energy  = table.num_nodes(1);
+    unit_assert (n_density == 6*EnzoGrackleCoolingTable::nodes_per_dex + 1);
+
+    // ranges already covered do not rebuild, larger ones extend it
+
+    const double range_inside[2] = { -1.0, 1.0 };
+    table.update (&chemistry_table,&rates_table,units,
+                  range_inside,range_energy);
+    unit_assert (table.num_nodes(0) == n_density);
+    const double range_outside[2] = { -2.0, 4.5 };
+    table.update (&chemistry_table,&rates_table,units,
+                  range_outside,range_energy);
+    unit_assert (table.num_nodes(0) ==
+                 n_density + 3*EnzoGrackleCoolingTable::nodes_per_dex);
+    unit_assert (table.num_nodes(1) == n_energy);
+
+    unit_func ("rate");
+
+    // at table nodes rates match Grackle for metal-free and solar
+    // metallicity, and are linear in the metal mass fraction between
+
+    std::vector<double> log_density, log_energy, metal_fraction;
+    for (int id=0; id<=32; id+=4) {
+      for (int ie=0; ie<=28; ie++) {
+        for (double z : { 0.0, 0.3, 1.0, 2.0 }) {
+          log_density.push_back(-2.0 + id*0.125);
+          log_energy.push_back(-4.0 + ie*0.125);
+          metal_fraction.push_back(z*solar);
+        }
+      }
+    }
+    std::vector<double> rate =
+      direct_rate(log_density,log_energy,metal_fraction);
+    double max_error = 0.0;
+    for (size_t i=0; i<rate.size(); i++) {
+      const double rate_table = table.rate
+        (log_density[i],log_energy[i],metal_fraction[i]);
+      max_error = std::max
+        (max_error, std::abs(rate_table - rate[i]) / std::abs(rate[i]));
+    }
+    unit_assert (max_error < 1e-3);
+
+    // between nodes, above 10^5.5 K where rates vary smoothly, the
+    // minimum cooling time used for the timestep is accurate to
+    // within the interpolation error
+
+    log_density.clear();
+    log_energy.clear();
+    metal_fraction.clear();
+    for (int i=0; i<64; i++) {
+      log_density.push_back(-2.0 + 4.0*((i*37) % 64)/64.0 + 0.01);
+      log_energy.push_back(-2.1 + 1.5*((i*23) % 64)/64.0 + 0.01);
+      metal_fraction.push_back(solar*((i*11) % 64)/64.0);
+    }
+    rate = direct_rate(log_density,log_energy,metal_fraction);
+    double rate_max = 0.0;
+    double rate_max_table = 0.0;
+    max_error = 0.0;
+    for (size_t i=0; i<rate.size(); i++) {
+      const double rate_table = table.rate
+        (log_density[i],log_energy[i],metal_fraction[i]);
+      rate_max = std::max(rate_max,std::abs(rate[i]));
+      rate_max_table = std::max(rate_max_table,std::abs(rate_table));
+      max_error = std::max
+        (max_error, std::abs(rate_table - rate[i]) / std::abs(rate[i]));
+    }
+    unit_assert (max_error < 0.25);
+    unit_assert (std::abs(rate_max_table - rate_max) < 0.1*rate_max);
+
+    _free_chemistry_data(&chemistry_table,&rates_table);
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
+
+#include "enzo.def.h"
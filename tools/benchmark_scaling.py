@@ -0,0 +1,320 @@
+import argparse
+import json
+import math
+import os.path
+import re
+import statistics
+import subprocess
+import sys
+
+_description = '''\
+Runs the Enzo-E performance benchmark problems in input/Benchmark/ at
+several process counts on the local machine, and collects the time per
+cycle, the breakdown of time by phase, and the memory high-water mark
+of each run into a single report.
+
+In weak scaling mode the number of blocks grows with the number of
+processes, keeping the blocks per process fixed; in strong scaling mode
+the mesh is fixed at the size used for the largest process count and
+divided among the processes.  The number of processes must be a power
+of two in both modes.
+
+The program must be run from the top-level source directory, since the
+benchmark inputs include other files relative to it.
+'''
+
+_epilog = '''\
+Example Usage:
+  benchmark_scaling.py --pes 1,2,4,8 --mode weak --problems hydro,vlct
+  benchmark_scaling.py --pes 1,8 --mode strong --json strong.json
+'''
+
+PROBLEMS = ['hydro', 'vlct', 'collapse', 'cosmology']
+
+# Phases reported by the Performance monitor, in the order they occur
+# within a cycle
+
+PHASES = ['adapt', 'refresh', 'compute', 'output', 'stopping']
+
+parser = argparse.ArgumentParser(
+    description = _description, epilog = _epilog,
+    formatter_class = argparse.RawDescriptionHelpFormatter)
+parser.add_argument(
+    "--charmrun", action = "store", default = "charmrun",
+    help = "path to the charmrun launcher (default: charmrun)")
+parser.add_argument(
+    "--enzo", action = "store", default = "build/bin/enzo-e",
+    help = "path to the enzo-e executable (default: build/bin/enzo-e)")
+parser.add_argument(
+    "--pes", action = "store", default = "1,2,4,8",
+    help = "comma-separated list of process counts (default: 1,2,4,8)")
+parser.add_argument(
+    "--mode", action = "store", default = "weak",
+    choices = ["weak", "strong", "both"],
+    help = "scaling mode (default: weak)")
+parser.add_argument(
+    "--problems", action = "store", default = ','.join(PROBLEMS),
+    help = "comma-separated list of problems from {} (default: all)".format(
+        ', '.join(PROBLEMS)))
+parser.add_argument(
+    "--block-size", action = "store", type = int, default = 32,
+    help = "cells per block along each axis (default: 32)")
+parser.add_argument(
+    "--blocks-per-pe", action = "store", type = int, default = 8,
+    help = ("root-level blocks per process for weak scaling, a power of "
+            "two (default: 8)"))
+parser.add_argument(
+    "--cycles", action = "store", type = int, default = 20,
+    help = "number of cycles to run (default: 20)")
+parser.add_argument(
+    "--skip", action = "store", type = int, default = 2,
+    help = ("number of initial cycles excluded from cycle time "
+            "statistics (default: 2)"))
+parser.add_argument(
+    "--run-dir", action = "store", default = "benchmark-runs",
+    help = ("directory for generated inputs and logs "
+            "(default: benchmark-runs)"))
+parser.add_argument(
+    "--json", action = "store", default = None,
+    help = "also write the report to this file in JSON format")
+parser.add_argument(
+    "--parse-only", action = "store_true",
+    help = "do not run anything; build the report from existing logs")
+
+#----------------------------------------------------------------------
+
+def factor_blocks(num_blocks):
+    """
+    Returns root_blocks, the most nearly cubic 3D arrangement of
+    num_blocks blocks (num_blocks must be a power of two), with any
+    larger extents first along x.
+    """
+    k = int(round(math.log2(num_blocks)))
+    if 2**k != num_blocks:
+        raise ValueError("number of blocks {} is not a power of two".format(
+            num_blocks))
+    blocks = [1, 1, 1]
+    for i in range(k):
+        blocks[i % 3] *= 2
+    return blocks
+
+def write_input(path, problem, root_blocks, block_size, cycles):
+    """Writes an input file that sizes the named benchmark problem"""
+    root_size = [block_size*b for b in root_blocks]
+    with open(path, 'w') as f:
+        f.write('include "input/Benchmark/{}.in"\n\n'.format(problem))
+        f.write('Mesh {{\n   root_size   = [{}, {}, {}];\n'.format(
+            *root_size))
+        f.write('   root_blocks = [{}, {}, {}];\n}}\n\n'.format(
+            *root_blocks))
+        f.write('Stopping {{ cycle = {}; }}\n'.format(cycles))
+
+def run_enzo(args, num_pes, input_path, log_path):
+    """Runs enzo-e on num_pes local processes, writing output to log_path"""
+    command = [args.charmrun, '+p{}'.format(num_pes), '++local',
+               args.enzo, input_path]
+    print(' '.join(command), '>', log_path)
+    sys.stdout.flush()
+    with open(log_path, 'w') as log:
+        exit_code = subprocess.call(command, stdout = log,
+                                    stderr = subprocess.STDOUT)
+    if exit_code != 0:
+        print("  exited with code {}".format(exit_code))
+    return exit_code == 0
+
+#----------------------------------------------------------------------
+
+# Monitor output lines are "<pe> <wall-time> <component> <message>"
+
+_monitor_line = re.compile(r'^\s*\d+\s+(\d+\.\d+)\s+(\S+)\s+(.*)$')
+
+def parse_log(log_path, num_pes, skip):
+    """
+    Returns a dictionary summarizing the Monitor output of a run, or None
+    if the run did not complete any cycles
+    """
+    cycle_wall = {}       # wall-clock time at the start of each cycle
+    region_usec = {}      # last cumulative time-usec of each region
+    bytes_high = 0        # largest per-cycle high-water mark
+    bytes_highest = 0
+    memory_high = {}      # largest per-node sum of per-process high-water
+                          # marks by category
+    methods = {}
+    extra = {}
+
+    with open(log_path) as f:
+        for line in f:
+            match = _monitor_line.match(line)
+            if match is None:
+                continue
+            wall, component, message = match.groups()
+            words = message.split()
+            if component == 'Simulation' and words[:1] == ['cycle']:
+                cycle_wall[int(words[1])] = float(wall)
+            elif component != 'Performance' or len(words) < 3:
+                continue
+            elif words[1] == 'time-usec' and words[0] != 'method':
+                region_usec[words[0]] = int(words[2])
+            elif words[0] == 'cycle' and words[1] == 'bytes-high':
+                bytes_high = max(bytes_high, int(words[2]))
+            elif words[0] == 'cycle' and words[1] == 'bytes-highest':
+                bytes_highest = max(bytes_highest, int(words[2]))
+            elif (words[0] == 'memory' and
+                  words[-2] == 'bytes-high-sum-node-max'):
+                # "memory <category> bytes-total N bytes-node-max N
+                #  bytes-high-sum-node-max N"
+                memory_high[words[1]] = max(memory_high.get(words[1], 0),
+                                            int(words[-1]))
+            elif words[0] == 'method' and words[2] == 'roofline':
+                # "method <name> roofline flops N bytes N ... bound B"
+                values = dict(zip(words[3::2], words[4::2]))
+                bound = values.pop('bound', 'unknown')
+                roofline = {k : float(v) for k, v in values.items()}
+                roofline['bound'] = bound
+                methods.setdefault(words[1], {})['roofline'] = roofline
+            elif words[0] == 'method' and words[2] == 'time-usec':
+                # "method <name> time-usec count N p50 X p90 X p99 X max X"
+                values = dict(zip(words[3::2], words[4::2]))
+                methods.setdefault(words[1], {}).update(
+                    {k : float(v) for k, v in values.items()})
+            elif words[0] == 'simulation' and words[1] in (
+                    'num-leaf-blocks', 'max-proc-blocks',
+                    'max-proc-particles', 'num-particles'):
+                extra[words[1]] = int(words[-1])
+
+    cycles = sorted(cycle_wall)
+    if len(cycles) < 2:
+        return None
+
+    # time per cycle from the wall-clock time between cycle starts
+
+    times = [cycle_wall[b] - cycle_wall[a]
+             for a, b in zip(cycles[:-1], cycles[1:])]
+    timed = times[skip:] if len(times) > skip else times
+    num_cycles = cycles[-1] - cycles[0]
+
+    # region times are summed over processes and cumulative over cycles
+
+    phases = {}
+    for region, usec in region_usec.items():
+        phases[region] = 1e-6*usec / num_pes / max(num_cycles, 1)
+
+    return {
+        'cycles'           : num_cycles,
+        'cycle_time_median': statistics.median(timed),
+        'cycle_time_min'   : min(timed),
+        'cycle_time_max'   : max(timed),
+        'phase_time'       : phases,
+        'bytes_high'       : bytes_high,
+        'bytes_highest'    : bytes_highest,
+        'memory_high_sum_node' : memory_high,
+        'methods'          : methods,
+        'counts'           : extra,
+    }
+
+#----------------------------------------------------------------------
+
+def print_report(report):
+    for mode in ('weak', 'strong'):
+        runs = [r for r in report['runs'] if r['mode'] == mode]
+        if not runs:
+            continue
+        print()
+        print('{} scaling, {}^3 cells per block'.format(
+            mode.capitalize(), report['block_size']))
+        header = '{:<10} {:>4} {:>10} {:>10} {:>6}'.format(
+            'problem', 'pes', 'blocks', 's/cycle', 'eff')
+        for phase in PHASES:
+            header += ' {:>8}'.format(phase)
+        header += ' {:>10}'.format('MB high')
+        print(header)
+        for r in runs:
+            line = '{:<10} {:>4} {:>10}'.format(
+                r['problem'], r['pes'], 'x'.join(map(str, r['root_blocks'])))
+            s = r['summary']
+            if s is None:
+                print(line + '  (failed)')
+                continue
+            line += ' {:>10.4f} {:>6.2f}'.format(
+                s['cycle_time_median'], r['efficiency'])
+            cycle = s['phase_time'].get('cycle', 0.0)
+            for phase in PHASES:
+                t = s['phase_time'].get(phase, 0.0)
+                line += ' {:>7.1f}%'.format(100.0*t/cycle if cycle else 0.0)
+            line += ' {:>10.1f}'.format(s['bytes_high']/2**20)
+            print(line)
+
+def add_efficiency(runs):
+    """
+    Adds parallel efficiency relative to the smallest process count of
+    the same problem and mode
+    """
+    for r in runs:
+        base = [b for b in runs if b['problem'] == r['problem'] and
+                b['mode'] == r['mode'] and b['summary'] is not None]
+        r['efficiency'] = 0.0
+        if r['summary'] is None or not base:
+            continue
+        b = min(base, key = lambda b: b['pes'])
+        t, t0 = r['summary']['cycle_time_median'], \
+                b['summary']['cycle_time_median']
+        if t <= 0.0:
+            continue
+        if r['mode'] == 'weak':
+            r['efficiency'] = t0 / t
+        else:
+            r['efficiency'] = (t0 * b['pes']) / (t * r['pes'])
+
+#----------------------------------------------------------------------
+
+def main(args):
+    pes = [int(p) for p in args.pes.split(',')]
+    problems = args.problems.split(',')
+    for problem in problems:
+        if problem not in PROBLEMS:
+            parser.error("unknown problem {}".format(problem))
+    modes = ['weak', 'strong'] if args.mode == 'both' else [args.mode]
+
+    if not os.path.isdir(args.run_dir):
+        os.makedirs(args.run_dir)
+
+    runs = []
+    for mode in modes:
+        for problem in problems:
+            for num_pes in pes:
+                if mode == 'weak':
+                    root_blocks = factor_blocks(args.blocks_per_pe*num_pes)
+                else:
+                    root_blocks = factor_blocks(args.blocks_per_pe*max(pes))
+                name = '{}-{}-p{:04d}'.format(problem, mode, num_pes)
+                input_path = os.path.join(args.run_dir, name + '.in')
+                log_path = os.path.join(args.run_dir, name + '.log')
+                if not args.parse_only:
+                    write_input(input_path, problem, root_blocks,
+                                args.block_size, args.cycles)
+                    run_enzo(args, num_pes, input_path, log_path)
+                summary = None
+                if os.path.isfile(log_path):
+                    summary = parse_log(log_path, num_pes, args.skip)
+                runs.append({'problem' : problem, 'mode' : mode,
+                             'pes' : num_pes, 'root_blocks' : root_blocks,
+                             'log' : log_path, 'summary' : summary})
+
+    add_efficiency(runs)
+
+    report = {'block_size' : args.block_size,
+              'blocks_per_pe' : args.blocks_per_pe,
+              'cycles' : args.cycles,
+              'runs' : runs}
+    print_report(report)
+
+    if args.json is not None:
+        with open(args.json, 'w') as f:
+            json.dump(report, f, indent = 2)
+        print('\nWrote {}'.format(args.json))
+
+    return all(r['summary'] is not None for r in runs)
+
+if __name__ == '__main__':
+    args = parser.parse_args()
+    sys.exit(0 if main(args) else 1)